@@ -19,393 +19,405 @@
 
 
 /**********   ARINC429 (ARINC 706) Receive messages. Received via RS422 ADC **************/
-ARINC429_RxMsg arincWordsRxFromRS422ADC[] = {
+const ARINC429_LabelConfig arincWordsRxFromRS422ADC[] = {
     {
         /* Label 200 - Airspeed Rate */
-        .msgConfig.label = FormatLabelNumber( 200 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 14,
-        .msgConfig.resolution = 0.00390625f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 200 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 14,
+        .resolution = 0.00390625f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 203 - Pressure Altitude */
     {
-        .msgConfig.label = FormatLabelNumber( 203 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 17,
-        .msgConfig.resolution = 1.0f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 203 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 17,
+        .resolution = 1.0f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 204 - Baro-Corrected Altitude */
     {
-        .msgConfig.label = FormatLabelNumber( 204 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 17,
-        .msgConfig.resolution = 1.0f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 204 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 17,
+        .resolution = 1.0f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 205 - Mach Number  */
     {
-        .msgConfig.label = FormatLabelNumber( 205 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 16,
-        .msgConfig.resolution = 0.0000625f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 205 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 16,
+        .resolution = 0.0000625f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 206 - Equivalent Airspeed */
     {
-        .msgConfig.label = FormatLabelNumber( 206 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 14,
-        .msgConfig.resolution = 0.0625f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 206 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 14,
+        .resolution = 0.0625f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 210 - True Airspeed */
     {
-        .msgConfig.label = FormatLabelNumber( 210 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 15,
-        .msgConfig.resolution = 0.0625f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 210 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 15,
+        .resolution = 0.0625f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 211 - Total Air Temperature */
     {
-        .msgConfig.label = FormatLabelNumber( 211 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 211 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 12,
+        .resolution = 0.125f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 212 - Altitude Rate */
     {
-        .msgConfig.label = FormatLabelNumber( 212 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 11,
-        .msgConfig.resolution = 16.0f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 212 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 11,
+        .resolution = 16.0f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 213 - Static Air Temperature */
     {
-        .msgConfig.label = FormatLabelNumber( 213 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 11,
-        .msgConfig.resolution = 0.25f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 213 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 11,
+        .resolution = 0.25f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 215 - Corrected Impact Pressure */
     {
-        .msgConfig.label = FormatLabelNumber( 215 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 14,
-        .msgConfig.resolution = 0.03125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 215 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 14,
+        .resolution = 0.03125f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 221 - Angle of Attack */
     {
-        .msgConfig.label = FormatLabelNumber( 221 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.043995f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 221 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 12,
+        .resolution = 0.043995f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 222 - Delta P Alpha */
     {
-        .msgConfig.label = FormatLabelNumber( 222 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 18,
-        .msgConfig.resolution = 0.000061035f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 222 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 18,
+        .resolution = 0.000061035f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 223 - Uncorrected Impact Pressure */
     {
-        .msgConfig.label = FormatLabelNumber( 223 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 14,
-        .msgConfig.resolution = 0.03125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 223 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 14,
+        .resolution = 0.03125f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 224 - AOA Rate */
     {
-        .msgConfig.label = FormatLabelNumber( 224 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 13,
-        .msgConfig.resolution = 0.015625f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 224 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 13,
+        .resolution = 0.015625f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 231 - Indicated OAT */
     {
-        .msgConfig.label = FormatLabelNumber( 231 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 231 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 12,
+        .resolution = 0.125f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 235 - Baro Correction */
     {
-        .msgConfig.label = FormatLabelNumber( 235 ),
-        .msgConfig.msgType = ARINC429_STD_BCD_MSG,
-        .msgConfig.numSigBits = 19,
-        .msgConfig.resolution = 0.001f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.numSigDigits = 5,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 235 ),
+        .msgType = ARINC429_STD_BCD_MSG,
+        .numSigBits = 19,
+        .resolution = 0.001f,
+        .numDiscreteBits = 0,
+        .numSigDigits = 5,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 242 - Total Pressure */
     {
-        .msgConfig.label = FormatLabelNumber( 242 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 16,
-        .msgConfig.resolution = 0.03125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 242 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 16,
+        .resolution = 0.03125f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 246 - Static Pressure */
     {
-        .msgConfig.label = FormatLabelNumber( 246 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 16,
-        .msgConfig.resolution = 0.03125f,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65
+        .label = FormatLabelNumber( 246 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 16,
+        .resolution = 0.03125f,
+        .numDiscreteBits = 0,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65
     },
 
     /* Label 271 - STATUS. important label, looped back */
     {
-        .msgConfig.label = FormatLabelNumber( 271 ),
-        .msgConfig.msgType = ARINC429_DISCRETE_MSG,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65,
-        .msgConfig.numDiscreteBits = 18
+        .label = FormatLabelNumber( 271 ),
+        .msgType = ARINC429_DISCRETE_MSG,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65,
+        .numDiscreteBits = 18
 
     },
 
     /* Label 377 - Equipment Identification */
     {
-        .msgConfig.label = FormatLabelNumber( 377 ),
-        .msgConfig.msgType = ARINC429_DISCRETE_MSG,
-        .msgConfig.minTransmitInterval_ms = 30,
-        .msgConfig.maxTransmitInterval_ms = 65,
-        .msgConfig.numDiscreteBits = 10
+        .label = FormatLabelNumber( 377 ),
+        .msgType = ARINC429_DISCRETE_MSG,
+        .minTransmitInterval_ms = 30,
+        .maxTransmitInterval_ms = 65,
+        .numDiscreteBits = 10
     }
 };
 
+static ARINC429_RxMsgState arincADCrxStates[sizeof ( arincWordsRxFromRS422ADC) / sizeof ( ARINC429_LabelConfig)];
+static uint8_t arincADClabelIndex[ARINC429_NUM_LABELS]; /* Label to slot lookup, built at init */
 /* Rx array for ADC words - populated via RS422 */
 ARINC429_RxMsgArray arincADCarray = {
-    .numMsgs = sizeof ( arincWordsRxFromRS422ADC) / sizeof ( ARINC429_RxMsg),
-    .rxMsgs = arincWordsRxFromRS422ADC,
+    .numMsgs = sizeof ( arincWordsRxFromRS422ADC) / sizeof ( ARINC429_LabelConfig),
+    .msgConfigs = arincWordsRxFromRS422ADC,
+    .msgStates = arincADCrxStates,
+    .labelIndex = arincADClabelIndex,
     .maxBusFailureCounts = 30u // 150 ms , 2.5 times the standard receive interval. 
 };
 
 
 /**************** ARINC429 (ARINC 705) received from AHR75 ******************/
-ARINC429_RxMsg arincWordsRxFromAHR75[] = {
+const ARINC429_LabelConfig arincWordsRxFromAHR75[] = {
     {
-        .msgConfig.label = FormatLabelNumber( 270 ),
-        .msgConfig.msgType = ARINC429_DISCRETE_MSG,
-        .msgConfig.numSigBits = 19,
-        .msgConfig.numDiscreteBits = 4,
-        .msgConfig.minTransmitInterval_ms = 450,
-        .msgConfig.maxTransmitInterval_ms = 550
+        .label = FormatLabelNumber( 270 ),
+        .msgType = ARINC429_DISCRETE_MSG,
+        .numSigBits = 19,
+        .numDiscreteBits = 4,
+        .minTransmitInterval_ms = 450,
+        .maxTransmitInterval_ms = 550
     },
     {
-        .msgConfig.label = FormatLabelNumber( 271 ),
-        .msgConfig.msgType = ARINC429_DISCRETE_MSG,
-        .msgConfig.numSigBits = 19,
-        .msgConfig.numDiscreteBits = 1,
-        .msgConfig.minTransmitInterval_ms = 450,
-        .msgConfig.maxTransmitInterval_ms = 550
+        .label = FormatLabelNumber( 271 ),
+        .msgType = ARINC429_DISCRETE_MSG,
+        .numSigBits = 19,
+        .numDiscreteBits = 1,
+        .minTransmitInterval_ms = 450,
+        .maxTransmitInterval_ms = 550
     },
     {
         /* Magnetic Heading */
-        .msgConfig.label = FormatLabelNumber( 320 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 15,
-        .msgConfig.resolution = 0.0055f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
+        .label = FormatLabelNumber( 320 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 15,
+        .resolution = 0.0055f,
+        .minTransmitInterval_ms = 15,
+        .maxTransmitInterval_ms = 25
     },
     {
         /* Pitch Angle */
-        .msgConfig.label = FormatLabelNumber( 324 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 14,
-        .msgConfig.resolution = 0.010986f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
+        .label = FormatLabelNumber( 324 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 14,
+        .resolution = 0.010986f,
+        .minTransmitInterval_ms = 15,
+        .maxTransmitInterval_ms = 25
     },
     {
         /* Roll Angle */
-        .msgConfig.label = FormatLabelNumber( 325 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 14,
-        .msgConfig.resolution = 0.010986f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
+        .label = FormatLabelNumber( 325 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 14,
+        .resolution = 0.010986f,
+        .minTransmitInterval_ms = 15,
+        .maxTransmitInterval_ms = 25
     },
     {
         /* Body Pitch Rate */
-        .msgConfig.label = FormatLabelNumber( 326 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 13,
-        .msgConfig.resolution = 0.015625f,
-        .msgConfig.maxTransmitInterval_ms = 25,
-        .msgConfig.minTransmitInterval_ms = 15
+        .label = FormatLabelNumber( 326 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 13,
+        .resolution = 0.015625f,
+        .maxTransmitInterval_ms = 25,
+        .minTransmitInterval_ms = 15
     },
     {
         /* Body Roll Rate */
-        .msgConfig.label = FormatLabelNumber( 327 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 13,
-        .msgConfig.resolution = 0.015625f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
+        .label = FormatLabelNumber( 327 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 13,
+        .resolution = 0.015625f,
+        .minTransmitInterval_ms = 15,
+        .maxTransmitInterval_ms = 25
     },
     {
         /* Body Yaw Rate */
-        .msgConfig.label = FormatLabelNumber( 330 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 13,
-        .msgConfig.resolution = 0.015625f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
+        .label = FormatLabelNumber( 330 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 13,
+        .resolution = 0.015625f,
+        .minTransmitInterval_ms = 15,
+        .maxTransmitInterval_ms = 25
     },
     {
         /* Body Longitudinal Acceleration */
-        .msgConfig.label = FormatLabelNumber( 331 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.000976563f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
+        .label = FormatLabelNumber( 331 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 12,
+        .resolution = 0.000976563f,
+        .minTransmitInterval_ms = 15,
+        .maxTransmitInterval_ms = 25
     },
     {
         /* Body Lateral Acceleration */
-        .msgConfig.label = FormatLabelNumber( 332 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.000976563f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
+        .label = FormatLabelNumber( 332 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 12,
+        .resolution = 0.000976563f,
+        .minTransmitInterval_ms = 15,
+        .maxTransmitInterval_ms = 25
     },
     {
         /* Body Normal Acceleration */
-        .msgConfig.label = FormatLabelNumber( 333 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.000976563f,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
+        .label = FormatLabelNumber( 333 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 12,
+        .resolution = 0.000976563f,
+        .minTransmitInterval_ms = 15,
+        .maxTransmitInterval_ms = 25
     },
     {
         /* Flight path Acceleration. Used for LS TX flag */
-        .msgConfig.label = FormatLabelNumber( 323 ),
-        .msgConfig.msgType = ARINC429_STD_BNR_MSG,
-        .msgConfig.numSigBits = 12,
-        .msgConfig.resolution = 0.001,
-        .msgConfig.minTransmitInterval_ms = 15,
-        .msgConfig.maxTransmitInterval_ms = 25
+        .label = FormatLabelNumber( 323 ),
+        .msgType = ARINC429_STD_BNR_MSG,
+        .numSigBits = 12,
+        .resolution = 0.001,
+        .minTransmitInterval_ms = 15,
+        .maxTransmitInterval_ms = 25
     }
 };
 
+static ARINC429_RxMsgState arincAHR75rxStates[sizeof ( arincWordsRxFromAHR75) / sizeof ( ARINC429_LabelConfig)];
+static uint8_t arincAHR75labelIndex[ARINC429_NUM_LABELS]; /* Label to slot lookup, built at init */
 /* Rx array for AHR75 words */
 ARINC429_RxMsgArray arincAHR75array = {
-    .numMsgs = sizeof ( arincWordsRxFromAHR75) / sizeof ( ARINC429_RxMsg),
-    .rxMsgs = arincWordsRxFromAHR75,
+    .numMsgs = sizeof ( arincWordsRxFromAHR75) / sizeof ( ARINC429_LabelConfig),
+    .msgConfigs = arincWordsRxFromAHR75,
+    .msgStates = arincAHR75rxStates,
+    .labelIndex = arincAHR75labelIndex,
     .maxBusFailureCounts = 10 // 50 ms, 2.5 times the standard receive interval. 
 };
 
 
 /**************** ARINC429 words received from PFD ************/
-ARINC429_RxMsg arincWordsRxFromPFD[] = {
+const ARINC429_LabelConfig arincWordsRxFromPFD[] = {
     {
         /* Baro Correction */
-        .msgConfig.label = FormatLabelNumber( 235 ),
-        .msgConfig.msgType = ARINC429_STD_BCD_MSG,
-        .msgConfig.numSigBits = 19,
-        .msgConfig.resolution = 0.001,
-        .msgConfig.numDiscreteBits = 0,
-        .msgConfig.numSigDigits = 5,
-        .msgConfig.minTransmitInterval_ms = 40,
-        .msgConfig.maxTransmitInterval_ms = 60
+        .label = FormatLabelNumber( 235 ),
+        .msgType = ARINC429_STD_BCD_MSG,
+        .numSigBits = 19,
+        .resolution = 0.001,
+        .numDiscreteBits = 0,
+        .numSigDigits = 5,
+        .minTransmitInterval_ms = 40,
+        .maxTransmitInterval_ms = 60
     },
     {
         /* Phase of Flight */
-        .msgConfig.label = FormatLabelNumber( 124 ),
-        .msgConfig.msgType = ARINC429_DISCRETE_MSG,
-        .msgConfig.numDiscreteBits = 3,
-        .msgConfig.minTransmitInterval_ms = 180,
-        .msgConfig.maxTransmitInterval_ms = 220
+        .label = FormatLabelNumber( 124 ),
+        .msgType = ARINC429_DISCRETE_MSG,
+        .numDiscreteBits = 3,
+        .minTransmitInterval_ms = 180,
+        .maxTransmitInterval_ms = 220
     },
     {
         /* ADC Status Word - loop around label, rs422 transmitted to ADC */
-        .msgConfig.label = FormatLabelNumber( 270 ),
-        .msgConfig.msgType = ARINC429_DISCRETE_MSG,
-        .msgConfig.minTransmitInterval_ms = 45,
-        .msgConfig.maxTransmitInterval_ms = 55
+        .label = FormatLabelNumber( 270 ),
+        .msgType = ARINC429_DISCRETE_MSG,
+        .minTransmitInterval_ms = 45,
+        .maxTransmitInterval_ms = 55
     },
     {
         /* AHRS Status Word */
-        .msgConfig.label = FormatLabelNumber( 271 ),
-        .msgConfig.msgType = ARINC429_DISCRETE_MSG,
-        .msgConfig.minTransmitInterval_ms = 45,
-        .msgConfig.maxTransmitInterval_ms = 55
+        .label = FormatLabelNumber( 271 ),
+        .msgType = ARINC429_DISCRETE_MSG,
+        .minTransmitInterval_ms = 45,
+        .maxTransmitInterval_ms = 55
     }
 };
 
+static ARINC429_RxMsgState arincPFDrxStates[sizeof ( arincWordsRxFromPFD) / sizeof ( ARINC429_LabelConfig)];
+static uint8_t arincPFDlabelIndex[ARINC429_NUM_LABELS]; /* Label to slot lookup, built at init */
 /* Rx array for PFD Input words */
 ARINC429_RxMsgArray arincPFDarray = {
-    .numMsgs = sizeof ( arincWordsRxFromPFD) / sizeof ( ARINC429_RxMsg),
-    .rxMsgs = arincWordsRxFromPFD,
+    .numMsgs = sizeof ( arincWordsRxFromPFD) / sizeof ( ARINC429_LabelConfig),
+    .msgConfigs = arincWordsRxFromPFD,
+    .msgStates = arincPFDrxStates,
+    .labelIndex = arincPFDlabelIndex,
     .maxBusFailureCounts = 25 // 125 ms, 2.5 times the standard receive interval. 
 };
 
@@ -430,6 +442,24 @@ static const EclipseRS422msgConfig ADCStatusMsg_cfg = {
     .rightDestination = RIGHT_AHRS,
 };
 
+static const EclipseRS422msgConfig ADCSoftwareVersionReplyMsg_cfg = {
+    .cmd = SOFTWARE_VERSION_CMD,
+    .length = ECLIPSE_RS422_ADC_SWVERSION_REPLY_MSG_LENGTH,
+    .leftSource = LEFT_ADC,
+    .rightSource = RIGHT_ADC,
+    .leftDestination = LEFT_AHRS,
+    .rightDestination = RIGHT_AHRS,
+};
+
+static const EclipseRS422msgConfig ADCHardwareVersionReplyMsg_cfg = {
+    .cmd = HARDWARE_SERIAL_NUMBER_CMD,
+    .length = ECLIPSE_RS422_ADC_HWVERSION_REPLY_MSG_LENGTH,
+    .leftSource = LEFT_ADC,
+    .rightSource = RIGHT_ADC,
+    .leftDestination = LEFT_AHRS,
+    .rightDestination = RIGHT_AHRS,
+};
+
 static const EclipseRS422msgConfig AHRSCurrentDataMsgTx_cfg = {
     .cmd = AHRS_CURRENT_DATA_CMD,
     .leftDestination = LEFT_ADC,
@@ -439,7 +469,13 @@ static const EclipseRS422msgConfig AHRSCurrentDataMsgTx_cfg = {
     .length = ECLIPSE_RS422_AHRS_CURRENT_DATA_MSG_LENGTH
 };
 
+/* Version replies are copied out of the receive buffer for SoftwareVersion.c. The ADC reply has twice the "normal" msg length */
+static uint8_t ADCSoftwareVersionReplyData[ECLIPSE_RS422_ADC_SWVERSION_REPLY_MSG_LENGTH - 1];
+static uint8_t ADCHardwareVersionReplyData[ECLIPSE_RS422_ADC_HWVERSION_REPLY_MSG_LENGTH - 1];
+
 /****************** RS422 messages received from ADC ****************/
+/* The data messages must come first - only they are checked for bus failure. They have no data array, 
+ * so verified frames are decoded into ARINC429 words straight from UART1rxCircBuff. */
 EclipseRS422msg ADCRS422rxMsgs[] = {
     /* ADC Computed Data Message */
     {
@@ -454,6 +490,18 @@ EclipseRS422msg ADCRS422rxMsgs[] = {
         .data = NULL,
         .hasBusFailed = true,
         .timeStamp_max_counts = 30u
+    },
+    /* ADC Software Version Reply */
+    {
+        .msgConfig = &ADCSoftwareVersionReplyMsg_cfg,
+        .data = ADCSoftwareVersionReplyData,
+        .hasBusFailed = true
+    },
+    /* ADC Hardware Serial Number Reply */
+    {
+        .msgConfig = &ADCHardwareVersionReplyMsg_cfg,
+        .data = ADCHardwareVersionReplyData,
+        .hasBusFailed = true
     }
 };
 
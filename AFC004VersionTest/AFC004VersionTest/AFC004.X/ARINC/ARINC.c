@@ -17,6 +17,7 @@
 
 /**************  Local Constant(s) *************************/
 static const size_t maxNumRxMsgsInArray = 64; // Maximum number of rx messages that can be defined in a received message array
+static const ARINC429_RxMsgData emptyRxMsgData = { 0 }; // Viewed by ARINC429_GetLatestLabelData when a label cannot be read
 
 
 /**************  Macro Definition(s) ***********************/
@@ -24,47 +25,143 @@ static const size_t maxNumRxMsgsInArray = 64; // Maximum number of rx messages t
 
 
 /**************  Static Function Prototypes (s) ************/
-static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBNRmessage( ARINC429_RxMsg * const thisRxMsg, // Received message, includes message configuration
+static ARINC429_ReadMsgReturnStatus ARINC429_CheckReceivedMessage( const ARINC429_LabelConfig * const msgConfig, // Label configuration
                                                                    const uint32_t ARINCMsg ); // Received ARINC429 message
 
-static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBCDmessage( ARINC429_RxMsg * const thisRxMsg, // Received message, includes message configuration
-                                                                   const uint32_t arincMsg ); // Received ARINC429 message
+static uint32_t ARINC429_GetBCDdataField( const ARINC429_LabelConfig * const msgConfig, // Label configuration
+                                          const uint32_t arincMsg ); // ARINC429 BCD message
 
-static ARINC429_ReadMsgReturnStatus ARINC429_ProcessDiscreteMessage( ARINC429_RxMsg * const thisRxMsg, // Received message, includes message configuration
-                                                                     const uint32_t arincMsg ); // Received ARINC429 message
+static ARINC429_ReadMsgReturnStatus ARINC429_DecodeStdBNRmessage( const ARINC429_LabelConfig * const msgConfig, // Label configuration
+                                                                  ARINC429_RxMsgData * const msgData ); // Received data, decoded from its raw word
 
-static bool ARINC429_IsLabelDataNotBabbling( const uint32_t clock_ms, // current clock count
-                                             const ARINC429_RxMsg * const rxMsg ); // ARINC Rx message
+static ARINC429_ReadMsgReturnStatus ARINC429_DecodeStdBCDmessage( const ARINC429_LabelConfig * const msgConfig, // Label configuration
+                                                                  ARINC429_RxMsgData * const msgData ); // Received data, decoded from its raw word
 
-static bool ARINC429_IsLabelDataFresh( const uint32_t clock_ms, // current clock count 
-                                       const ARINC429_RxMsg * const rxMsg ); // ARINC Rx message
+static ARINC429_ReadMsgReturnStatus ARINC429_DecodeDiscreteMessage( ARINC429_RxMsgData * const msgData ); // Received data, decoded from its raw word
+
+static ARINC429_ReadMsgReturnStatus ARINC429_DecodeRxMsgData( const ARINC429_LabelConfig * const msgConfig, // Label configuration
+                                                              ARINC429_RxMsgState * const msgState ); // Receive state of the label
+
+static bool ARINC429_IsLabelDataNotBabbling( const uint32_t clock_ticks, // current clock count
+                                             const ARINC429_RxMsgState * const msgState ); // ARINC Rx message state
+
+static bool ARINC429_IsLabelDataFresh( const uint32_t clock_ticks, // current clock count 
+                                       const ARINC429_RxMsgState * const msgState ); // ARINC Rx message state
+
+static uint8_t ARINC429_FindRxMsgSlot( const ARINC429_RxMsgArray * const rxMsgArray, // Receive message array to search
+                                       const uint8_t hexFlippedLabel ); // Label to find
+
+static ARINC429_GetLabelDataReturnStatus ARINC429_GetLatestLabelState( const ARINC429_RxMsgArray * const rxMsgArray, // Receive message array to search
+                                                                       const arincLabel hexFlippedLabel, // Label to find
+                                                                       uint8_t * const slot, // Set to the slot of the label
+                                                                       uint8_t * const rxFlags ); // Set to the statuses of the label's data
 
 
 /**************  Static Function Definition(s) *************/
-#ARINC429_ProcessStdBNRmessage
-/* Function: ARINC429_ProcessStdBNRmessage
+#ARINC429_CheckReceivedMessage
+/* Function: ARINC429_CheckReceivedMessage
+ *
+ * Description: Checks a received message against its label configuration
+ *      before it is stored. Only integer checks are made here: the 
+ *      configuration of the message type and, for BCD messages, that every
+ *      digit of the data field is a valid BCD digit. The engineering units 
+ *      are decoded later, when the data is first read. 
+ * 
+ * Return: ARINC429_ReadMsgReturnStatus based on check result 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.002, INT1.0101.S.IOP.4.003, INT1.0101.S.IOP.4.004 
+ */
+static ARINC429_ReadMsgReturnStatus ARINC429_CheckReceivedMessage( const ARINC429_LabelConfig * const msgConfig,
+                                                                   const uint32_t ARINCMsg )
+{
+    ARINC429_ReadMsgReturnStatus readStatus;
+
+    switch (msgConfig->msgType)
+    {
+        case ARINC429_STD_BNR_MSG:
+            readStatus = ((msgConfig->numSigBits < 1) ||
+                    (msgConfig->numSigBits > ARINC429_BNR_STD_MSG_MAX_NUM_SIGBITS)) ?
+                    ARINC429_READ_MSG_ERROR : ARINC429_READ_MSG_SUCCESS; // Error-- shouldn't happen
+            break;
+
+        case ARINC429_STD_BCD_MSG:
+            // Check number of significant digits and verify that discrete bit field does not overlap digit data
+            if ((msgConfig->numSigDigits < 1) ||
+                    (msgConfig->numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS) ||
+                    (((msgConfig->numSigDigits * 4 - 1) + msgConfig->numDiscreteBits) > ARINC429_BCD_STD_DATA_MAX_DATA_FIELD_SIZE))
+            {
+                readStatus = ARINC429_READ_MSG_ERROR_INVALID_MESSAGE; // Error-- Invalid ARINC message configuration
+            }
+            else if (false == ARINC429_BCD_IsBCDvalValid( msgConfig->numSigDigits,
+                                                          ARINC429_GetBCDdataField( msgConfig, ARINCMsg ) ))
+            {
+                readStatus = ARINC429_READ_MSG_ERROR_INVALID_MESSAGE; // Error-- invalid BCD digit in data field
+            }
+            else
+            {
+                readStatus = ARINC429_READ_MSG_SUCCESS;
+            }
+            break;
+
+        case ARINC429_DISCRETE_MSG:
+            readStatus = ((msgConfig->numDiscreteBits < 1) ||
+                    (msgConfig->numDiscreteBits > ARINC429_DISCRETE_MSG_MAX_NUM_BITS)) ?
+                    ARINC429_WRITE_MSG_ERROR_INVALID_MSG_CONFIG : ARINC429_READ_MSG_SUCCESS; // Error-- Invalid ARINC message configuration
+            break;
+
+        default:
+            readStatus = ARINC429_READ_MSG_ERROR; // Error-- Un-handled message type. This should not happen.
+            break;
+    }
+
+    return readStatus;
+}
+#ARINC429_CheckReceivedMessage
+
+#ARINC429_GetBCDdataField
+/* Function: ARINC429_GetBCDdataField
+ *
+ * Description: Extracts the significant digits of a standard BCD message,
+ *      right aligned. 
+ * 
+ * Return: BCD data field 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.004 
+ */
+static uint32_t ARINC429_GetBCDdataField( const ARINC429_LabelConfig * const msgConfig,
+                                          const uint32_t arincMsg )
+{
+    uint32_t bcdData = arincMsg & ARINC429_BCD_DATAFIELDMASK;
+    bcdData >>= ARINC429_BCD_STD_MSG_DATA_FIELD_SHIFT +
+            ARINC429_BCD_BITS_PER_DIGIT * (ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS - msgConfig->numSigDigits);
+    return bcdData;
+}
+#ARINC429_GetBCDdataField
+
+#ARINC429_DecodeStdBNRmessage
+/* Function: ARINC429_DecodeStdBNRmessage
  *
  * Description: Parses the fields of a standard ARINC429 binary message. 
- *      Converts the engineering data to a float and integer. Extract the 
+ *      Converts the engineering data to a float. Extract the 
  *      SSM and SDI bits and stores in the rxMsg data field. 
  * 
  * Return: ARINC429_ReadMsgReturnStatus based on read status 
  * 
  * Requirement Implemented: INT1.0101.S.IOP.4.003 
  */
-static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBNRmessage( ARINC429_RxMsg * const thisRxMsg,
-                                                                   const uint32_t ARINCMsg )
+static ARINC429_ReadMsgReturnStatus ARINC429_DecodeStdBNRmessage( const ARINC429_LabelConfig * const msgConfig,
+                                                                  ARINC429_RxMsgData * const msgData )
 {
-    thisRxMsg->data.rawARINCword = ARINCMsg; // Store raw ARINC word
+    const uint32_t ARINCMsg = msgData->rawARINCword;
 
-    uint32_t rawDataField = ARINCMsg >> (ARINC429_BNR_MAX_DATA_FIELD_SHIFT - thisRxMsg->msgConfig.numSigBits);
-    rawDataField &= (UINT32_MAX >> (NUM_BITS_IN_UINT32 - thisRxMsg->msgConfig.numSigBits - 1)); // Mask includes sign bit
+    uint32_t rawDataField = ARINCMsg >> (ARINC429_BNR_MAX_DATA_FIELD_SHIFT - msgConfig->numSigBits);
+    rawDataField &= (UINT32_MAX >> (NUM_BITS_IN_UINT32 - msgConfig->numSigBits - 1)); // Mask includes sign bit
 
     ARINC429_ReadMsgReturnStatus readStatus;
     float dataEng;
 
-    if (EXIT_FAILURE == ARINC429_BNR_ConvertRawMsgDataToEngUnits( thisRxMsg->msgConfig.numSigBits,
-                                                                  thisRxMsg->msgConfig.resolution,
+    if (EXIT_FAILURE == ARINC429_BNR_ConvertRawMsgDataToEngUnits( msgConfig->numSigBits,
+                                                                  msgConfig->resolution,
                                                                   &dataEng, // result in engineering units
                                                                   rawDataField )) // raw data field (right-aligned)
     {
@@ -73,33 +170,12 @@ static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBNRmessage( ARINC429_RxMs
 
     else
     {
-        thisRxMsg->data.engDataFloat = dataEng;
-
-        // Calculate the nearest int equivalent of the scaled data as some code needs integer values (e.g. TCAS intruder number)
-        // Doing this here helps avoid issues with incorrect conversion of floats to int values in
-        // downstream code (a common novice programmer mistake)
+        msgData->engDataFloat = dataEng;
 
-        double calcValue = (dataEng < 0.0) ? dataEng - 0.5f : dataEng + 0.5f;
-
-        calcValue = clamp( calcValue, INT32_MIN, INT32_MAX ); // avoid issues with integer overflow during cast
-        thisRxMsg->data.engDataInt = (int32_t) calcValue;
-
-        // Extract the discrete bits (if used)
-        if (thisRxMsg->msgConfig.numDiscreteBits > 0)
-        {
-            uint32_t discreteBits = (ARINCMsg >> ARINC429_BNR_BCD_MSG_DISCRETE_BITS_SHIFT_VAL);
-            discreteBits &= (UINT32_MAX >> (NUM_BITS_IN_UINT32 - thisRxMsg->msgConfig.numDiscreteBits));
-            thisRxMsg->data.discreteBits = discreteBits;
-        }
-        else
-        {
-            thisRxMsg->data.discreteBits = 0; // For good measure
-        }
-
-        thisRxMsg->data.SM = ARINC429_ExtractSSMbits( ARINCMsg ); /* Get SSM bits */
+        msgData->SM = ARINC429_ExtractSSMbits( ARINCMsg ); /* Get SSM bits */
 
         /* Get SDI bits. Ignore SDI bits if more than 18 sig bits. */
-        thisRxMsg->data.SDI = (thisRxMsg->msgConfig.numSigBits <= ARINC429_BNR_STD_MSG_NUM_SIGBITS_18) ?
+        msgData->SDI = (msgConfig->numSigBits <= ARINC429_BNR_STD_MSG_NUM_SIGBITS_18) ?
                 ARINC429_ExtractSDIbits( ARINCMsg ) : 0;
 
         readStatus = ARINC429_READ_MSG_SUCCESS;
@@ -107,70 +183,43 @@ static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBNRmessage( ARINC429_RxMs
 
     return readStatus;
 }
-#ARINC429_ProcessStdBNRmessage
+#ARINC429_DecodeStdBNRmessage
 
-#ARINC429_ProcessStdBCDmessage
-/* Function: ARINC429_ProcessStdBCDmessage
+#ARINC429_DecodeStdBCDmessage
+/* Function: ARINC429_DecodeStdBCDmessage
  *
- * Description: Processes the fields of an ARINC429 BCD message. 
+ * Description: Processes the fields of an ARINC429 BCD message. The 
+ *      configuration and digits were checked when the message was received. 
  * 
  * Return: ARINC429_ReadMsgReturnStatus based on process result 
  * 
  * Requirement Implemented: INT1.0101.S.IOP.4.004 
  */
-static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBCDmessage( ARINC429_RxMsg * const thisRxMsg, // Received message, includes message configuration
-                                                                   const uint32_t arincMsg ) // Received ARINC message
+static ARINC429_ReadMsgReturnStatus ARINC429_DecodeStdBCDmessage( const ARINC429_LabelConfig * const msgConfig, // Label configuration
+                                                                  ARINC429_RxMsgData * const msgData ) // Received data, decoded from its raw word
 {
-    // Check number of significant digits and verify that discrete bit field does not overlap digit data
-    if ((thisRxMsg->msgConfig.numSigDigits < 1) ||
-            (thisRxMsg->msgConfig.numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS) ||
-            (((thisRxMsg->msgConfig.numSigDigits * 4 - 1) + thisRxMsg->msgConfig.numDiscreteBits) > ARINC429_BCD_STD_DATA_MAX_DATA_FIELD_SIZE))
-    {
-        return ARINC429_READ_MSG_ERROR_INVALID_MESSAGE; // Error-- Invalid ARINC message configuration
-    }
-
-    uint32_t bcdData = arincMsg & ARINC429_BCD_DATAFIELDMASK;
-    bcdData >>= ARINC429_BCD_STD_MSG_DATA_FIELD_SHIFT +
-            ARINC429_BCD_BITS_PER_DIGIT * (ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS - thisRxMsg->msgConfig.numSigDigits);
+    const uint32_t arincMsg = msgData->rawARINCword;
 
     float dataEng;
-    if (EXIT_FAILURE == ARINC429_BCD_ConvertBCDvalToEngVal( thisRxMsg->msgConfig.numSigDigits,
-                                                            thisRxMsg->msgConfig.resolution,
+    if (EXIT_FAILURE == ARINC429_BCD_ConvertBCDvalToEngVal( msgConfig->numSigDigits,
+                                                            msgConfig->resolution,
                                                             &dataEng, // result in engineering units
-                                                            bcdData ))
+                                                            ARINC429_GetBCDdataField( msgConfig, arincMsg ) ))
     {
         return ARINC429_READ_MSG_ERROR_INVALID_MESSAGE; // Error-- invalid BCD digit in data field
     }
 
-    thisRxMsg->data.engDataFloat = dataEng;
-
-    // Calculate the nearest integer equivalent of the scaled data as some code may need integer values
-    // Doing this here helps avoid issues with incorrect conversion of floats to int values in downstream code (a common novice programmer mistake)
-    double calcValue = dataEng + ((dataEng < 0.0) ? -0.5f : 0.5f); // correct way to do rounding to avoid bias issues
-    calcValue = clamp( calcValue, INT32_MIN, INT32_MAX ); // avoid issues with integer overflow during cast
-    thisRxMsg->data.engDataInt = (int32_t) calcValue;
-
-    // Extract the discrete bits (if used)
-    if (thisRxMsg->msgConfig.numDiscreteBits > 0)
-    {
-        uint32_t discreteBits = arincMsg >> ARINC429_BNR_BCD_MSG_DISCRETE_BITS_SHIFT_VAL;
-        discreteBits &= (UINT32_MAX >> (NUM_BITS_IN_UINT32 - thisRxMsg->msgConfig.numDiscreteBits));
-        thisRxMsg->data.discreteBits = discreteBits;
-    }
-    else
-    {
-        thisRxMsg->data.discreteBits = 0; // For good measure
-    }
+    msgData->engDataFloat = dataEng;
 
-    thisRxMsg->data.SM = ARINC429_ExtractSSMbits( arincMsg ); /* Get SSM bits */
-    thisRxMsg->data.SDI = ARINC429_ExtractSDIbits( arincMsg ); /* Get SDI bits */
+    msgData->SM = ARINC429_ExtractSSMbits( arincMsg ); /* Get SSM bits */
+    msgData->SDI = ARINC429_ExtractSDIbits( arincMsg ); /* Get SDI bits */
 
     return ARINC429_READ_MSG_SUCCESS;
 }
-#ARINC429_ProcessStdBCDmessage
+#ARINC429_DecodeStdBCDmessage
 
-#ARINC429_ProcessDiscreteMessage
-/* Function: ARINC429_ProcessDiscreteMessage
+#ARINC429_DecodeDiscreteMessage
+/* Function: ARINC429_DecodeDiscreteMessage
  *
  * Description: Parses the message fields of a discrete ARINC429 message. 
  * 
@@ -178,52 +227,92 @@ static ARINC429_ReadMsgReturnStatus ARINC429_ProcessStdBCDmessage( ARINC429_RxMs
  * 
  * Requirement Implemented: INT1.0101.S.IOP.4.002 
  */
-static ARINC429_ReadMsgReturnStatus ARINC429_ProcessDiscreteMessage( ARINC429_RxMsg * const thisRxMsg, // Received message, includes message configuration
-                                                                     const uint32_t arincMsg ) // Received ARINC message
+static ARINC429_ReadMsgReturnStatus ARINC429_DecodeDiscreteMessage( ARINC429_RxMsgData * const msgData ) // Received data, decoded from its raw word
+{
+    const uint32_t arincMsg = msgData->rawARINCword;
+
+    msgData->engDataFloat = 0.0f; // Not used with discrete messages
+    msgData->isEngDataInBounds = false; // Not used with discrete messages
+
+    /* The discrete bits are read by the application code from the raw word */
+    msgData->SM = ARINC429_ExtractSSMbits( arincMsg ); /* Get SSM bits */
+    msgData->SDI = ARINC429_ExtractSDIbits( arincMsg ); /* Get SDI bits */
+    return ARINC429_READ_MSG_SUCCESS;
+}
+#ARINC429_DecodeDiscreteMessage
+
+#ARINC429_DecodeRxMsgData
+/* Function: ARINC429_DecodeRxMsgData
+ *
+ * Description: Decodes the latest raw word of a label into its SSM, SDI and
+ *      engineering units, based on the label config type, unless it has 
+ *      already been decoded since it was received. The decoded data is kept
+ *      until the next word of the label arrives. 
+ * 
+ * Return: ARINC429_ReadMsgReturnStatus based on decode result. 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.001
+ */
+static ARINC429_ReadMsgReturnStatus ARINC429_DecodeRxMsgData( const ARINC429_LabelConfig * const msgConfig,
+                                                              ARINC429_RxMsgState * const msgState )
 {
-    if ((thisRxMsg->msgConfig.numDiscreteBits < 1) ||
-            (thisRxMsg->msgConfig.numDiscreteBits > ARINC429_DISCRETE_MSG_MAX_NUM_BITS))
+    ARINC429_ReadMsgReturnStatus readMsgReturnStatus;
+
+    if (msgState->data.isDecoded)
     {
-        return ARINC429_WRITE_MSG_ERROR_INVALID_MSG_CONFIG; // Error-- Invalid ARINC message configuration
+        return ARINC429_READ_MSG_SUCCESS;
     }
 
-    thisRxMsg->data.engDataFloat = 0.0f; // Not used with discrete messages
-    thisRxMsg->data.engDataInt = 0; // Not used with discrete messages
-    thisRxMsg->data.isEngDataInBounds = false; // Not used with discrete messages
+    switch (msgConfig->msgType)
+    {
+        case ARINC429_STD_BNR_MSG:
+            readMsgReturnStatus = ARINC429_DecodeStdBNRmessage( msgConfig, &(msgState->data) );
+            break;
 
-    // Extract the discrete bits (if used)
-    //    uint32_t discreteBits = arincMsg >> ( ARINC429_DISCRETE_MSG_MAX_DATA_FIELD_SHIFT - thisRxMsg->msgConfig.numDiscreteBits + 1 );
-    uint32_t discreteBits = arincMsg >> (10); // temp implementation based on non-standard padding values. All values are padded msb
-    discreteBits &= UINT32_MAX >> (NUM_BITS_IN_UINT32 - thisRxMsg->msgConfig.numDiscreteBits);
-    thisRxMsg->data.discreteBits = discreteBits;
+        case ARINC429_STD_BCD_MSG:
+            readMsgReturnStatus = ARINC429_DecodeStdBCDmessage( msgConfig, &(msgState->data) );
+            break;
 
-    thisRxMsg->data.SM = ARINC429_ExtractSSMbits( arincMsg ); /* Get SSM bits */
-    thisRxMsg->data.SDI = ARINC429_ExtractSDIbits( arincMsg ); /* Get SDI bits */
-    return ARINC429_READ_MSG_SUCCESS;
+        case ARINC429_DISCRETE_MSG:
+            readMsgReturnStatus = ARINC429_DecodeDiscreteMessage( &(msgState->data) );
+            break;
+
+        default:
+            readMsgReturnStatus = ARINC429_READ_MSG_ERROR; // Error-- Un-handled message type. This should not happen.
+            break;
+    }
+
+    if (ARINC429_READ_MSG_SUCCESS == readMsgReturnStatus)
+    {
+        msgState->data.isDecoded = true;
+    }
+    return readMsgReturnStatus;
 }
-#ARINC429_ProcessDiscreteMessage
+#ARINC429_DecodeRxMsgData
+
 #ARINC429_IsLabelDataFresh   
 /* Function: ARINC429_IsLabelDataFresh
  *
  * Description: Reports whether a received message is fresh  (i.e. the maximum 
  *      receive interval has not been exceeded). This function should be
  *      called when the application code is accessing the ARINC data that has 
- *      been transferred from the ARINC chip to the microcontroller.
+ *      been transferred from the ARINC chip to the microcontroller. Compares
+ *      in Timer23 ticks against the interval converted at initialization.
  * 
  * Return: true if message is fresh, false if not fresh 
  * 
  * Requirement Implemented: INT1.0101.S.IOP.4.011
  */
-static bool ARINC429_IsLabelDataFresh( const uint32_t clock_ms,
-                                       const ARINC429_RxMsg * const rxMsg )
+static bool ARINC429_IsLabelDataFresh( const uint32_t clock_ticks,
+                                       const ARINC429_RxMsgState * const msgState )
 {
-    if (NULL == rxMsg)
+    if (NULL == msgState)
     {
         return false; // Error-- invalid function arguments. Assume stale.
     }
 
-    uint32_t elapsedTime_ms = clock_ms - rxMsg->data.sysTimeLastGoodMsg_ms;
-    bool returnVal = (elapsedTime_ms <= rxMsg->msgConfig.maxTransmitInterval_ms);
+    uint32_t elapsedTime_ticks = clock_ticks - msgState->data.sysTimeLastGoodMsg_ticks;
+    bool returnVal = (elapsedTime_ticks <= msgState->maxTransmitInterval_ticks);
 
     return returnVal;
 }
@@ -235,7 +324,7 @@ static bool ARINC429_IsLabelDataFresh( const uint32_t clock_ms,
  * Description: Determines if an rxMsg is babbling (receive interval is faster
  *      than the minimum specified receive interval). If the current timestamp
  *      minus the time since a last good message is greater than the minimum
- *      transmit interval, return true. Function does not require a NULL 
+ *      transmit interval (both in Timer23 ticks), return true. Function does not require a NULL 
  *      pointer check since it is accessed through ProcessReceivedMessage, and 
  *      can never call this function if a null pointer is detected. 
  * 
@@ -244,25 +333,123 @@ static bool ARINC429_IsLabelDataFresh( const uint32_t clock_ms,
  * Requirement Implemented: INT1.0101.S.IOP.4.012 
  */
 
-static bool ARINC429_IsLabelDataNotBabbling( const uint32_t clock_ms,
-                                             const ARINC429_RxMsg * const rxMsg )
+static bool ARINC429_IsLabelDataNotBabbling( const uint32_t clock_ticks,
+                                             const ARINC429_RxMsgState * const msgState )
 {
-//    if (NULL == rxMsg)
+//    if (NULL == msgState)
 //    {
 //        return false; // Error-- invalid function arguments. Assume babbling.
 //    }
 
-    uint32_t elapsedTime = clock_ms - rxMsg->data.sysTimeLastGoodMsg_ms;
-    bool returnVal = (elapsedTime >= rxMsg->msgConfig.minTransmitInterval_ms);
+    uint32_t elapsedTime = clock_ticks - msgState->data.sysTimeLastGoodMsg_ticks;
+    bool returnVal = (elapsedTime >= msgState->minTransmitInterval_ticks);
     return returnVal;
 }
 #ARINC429_IsLabelDataNotBabbling   
+
+#ARINC429_FindRxMsgSlot
+/* Function: ARINC429_FindRxMsgSlot
+ *
+ * Description: Finds the msgConfigs/msgStates slot configured for a label. 
+ *      Uses the array's label index when it has been built by 
+ *      ARINC429_InitializeRxMsgArray, otherwise falls back to a linear search
+ *      of the msgConfigs. The array pointer is checked by the callers. 
+ * 
+ * Return: Slot of the label, ARINC429_LABEL_INDEX_NO_SLOT if the label is not configured. 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.001
+ */
+static uint8_t ARINC429_FindRxMsgSlot( const ARINC429_RxMsgArray * const rxMsgArray,
+                                       const uint8_t hexFlippedLabel )
+{
+    uint8_t slot = ARINC429_LABEL_INDEX_NO_SLOT;
+
+    if ((true == rxMsgArray->isLabelIndexBuilt) &&
+            (NULL != rxMsgArray->labelIndex))
+    {
+        slot = rxMsgArray->labelIndex[hexFlippedLabel];
+    }
+    else
+    {
+        size_t count = 0;
+        while ((count < rxMsgArray->numMsgs) &&
+                (count < maxNumRxMsgsInArray))
+        {
+            if (rxMsgArray->msgConfigs[count].label == hexFlippedLabel)
+            {
+                slot = (uint8_t) count;
+                break;
+            }
+
+            count++;
+        }
+    }
+
+    return slot;
+}
+#ARINC429_FindRxMsgSlot
+
 /**************  Function Definition(s) ********************/
+#ARINC429_InitializeRxMsgArray
+/* Function: ARINC429_InitializeRxMsgArray
+ *
+ * Description: Populates the label index of a receive message array so that
+ *      received words and label reads are matched to their rxMsg with a 
+ *      single table lookup. Every label entry is first cleared to 
+ *      ARINC429_LABEL_INDEX_NO_SLOT, then each configured label is pointed 
+ *      at its msgConfigs/msgStates slot. If a label is configured twice, the first slot is
+ *      kept to match the linear search. Also converts each message's min/max
+ *      transmit intervals to Timer23 ticks for the babbling and freshness 
+ *      checks. Must be called once at init, after Timer23_Initialize and 
+ *      before messages are received. 
+ * 
+ * Return: true if the array was initialized, false if the array is invalid. 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.001
+ */
+bool ARINC429_InitializeRxMsgArray( ARINC429_RxMsgArray * const rxMsgArray )
+{
+    if ((NULL == rxMsgArray) ||
+            (NULL == rxMsgArray->msgConfigs) ||
+            (NULL == rxMsgArray->msgStates) ||
+            (NULL == rxMsgArray->labelIndex) ||
+            (rxMsgArray->numMsgs > maxNumRxMsgsInArray))
+    {
+        return false; // Error-- invalid receive message array
+    }
+
+    rxMsgArray->isLabelIndexBuilt = false;
+
+    size_t count;
+    for (count = 0; count < ARINC429_NUM_LABELS; count++)
+    {
+        rxMsgArray->labelIndex[count] = ARINC429_LABEL_INDEX_NO_SLOT;
+    }
+
+    for (count = 0; count < rxMsgArray->numMsgs; count++)
+    {
+        const ARINC429_LabelConfig * const msgConfig = &(rxMsgArray->msgConfigs[count]);
+        ARINC429_RxMsgState * const msgState = &(rxMsgArray->msgStates[count]);
+        msgState->minTransmitInterval_ticks = Timer23_ConvertMsToTicks( msgConfig->minTransmitInterval_ms );
+        msgState->maxTransmitInterval_ticks = Timer23_ConvertMsToTicks( msgConfig->maxTransmitInterval_ms );
+
+        uint8_t label = msgConfig->label;
+        if (ARINC429_LABEL_INDEX_NO_SLOT == rxMsgArray->labelIndex[label])
+        {
+            rxMsgArray->labelIndex[label] = (uint8_t) count;
+        }
+    }
+
+    rxMsgArray->isLabelIndexBuilt = true;
+    return true;
+}
+#ARINC429_InitializeRxMsgArray
+
 #ARINC429_ProcessReceivedMessage
 /* Function: ARINC429_ProcessReceivedMessage
  *
- * Description: Takes a received ARINC429 message and checks each member of the
- *      rxMsgArray for a matching label. If a label match is found, process the 
+ * Description: Takes a received ARINC429 message and looks up the rxMsg 
+ *      configured for its label. If a label match is found, process the 
  *      received message based on the label config type. If any process message
  *      routine fails, return the status through readMsgReturnStatus. If a message
  *      was successfully processed, timestamp the message and check babbling 
@@ -274,9 +461,30 @@ static bool ARINC429_IsLabelDataNotBabbling( const uint32_t clock_ms,
  */
 ARINC429_ReadMsgReturnStatus ARINC429_ProcessReceivedMessage( ARINC429_RxMsgArray * const rxMsgArray, /* Pointer to receive message array */
                                                               const uint32_t ARINCMsg ) /* ARINC429 word read from hardware */
+{
+    return ARINC429_ProcessReceivedMessageWithTimestamp( rxMsgArray, ARINCMsg, Timer23_GetTimestamp_ticks( ) );
+}
+#ARINC429_ProcessReceivedMessage
+
+#ARINC429_ProcessReceivedMessageWithTimestamp
+/* Function: ARINC429_ProcessReceivedMessageWithTimestamp
+ *
+ * Description: As ARINC429_ProcessReceivedMessage, but the message is 
+ *      timestamped with the given receipt time instead of the time it is 
+ *      processed. Used for words that were read from the transceiver 
+ *      earlier and buffered. 
+ * 
+ * Return: ARINC429_ReadMsgReturnStatus based on read message status 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.001
+ */
+ARINC429_ReadMsgReturnStatus ARINC429_ProcessReceivedMessageWithTimestamp( ARINC429_RxMsgArray * const rxMsgArray, /* Pointer to receive message array */
+                                                                           const uint32_t ARINCMsg, /* ARINC429 word read from hardware */
+                                                                           const uint32_t rxTimestamp_ticks ) /* Timer23 tick at which the word was read */
 {
     if ((NULL == rxMsgArray) ||
-            (NULL == rxMsgArray->rxMsgs))
+            (NULL == rxMsgArray->msgConfigs) ||
+            (NULL == rxMsgArray->msgStates))
     {
         return ARINC429_READ_MSG_ERROR; // Error-- invalid receive message array for specified receiver
     }
@@ -285,72 +493,43 @@ ARINC429_ReadMsgReturnStatus ARINC429_ProcessReceivedMessage( ARINC429_RxMsgArra
 
     ARINC429_ReadMsgReturnStatus readMsgReturnStatus = ARINC429_READ_MSG_SUCCESS;
 
-    /* Look through configured messages and try to match label */
-    size_t count = 0;
-    bool labelMatchFound = false;
+    /* Match the label to its configured message */
+    const uint8_t slot = ARINC429_FindRxMsgSlot( rxMsgArray, msgLabel );
 
-    while ((count < rxMsgArray->numMsgs) &&
-            (count < maxNumRxMsgsInArray) &&
-            (false == labelMatchFound))
+    if (ARINC429_LABEL_INDEX_NO_SLOT == slot)
     {
-        if (rxMsgArray->rxMsgs[count].msgConfig.label == msgLabel)
-        {
-            /* Process the message */
-            ARINC429_RxMsg * const thisRxMsg = &(rxMsgArray->rxMsgs[count]);
-            switch (thisRxMsg->msgConfig.msgType)
-            {
-                case ARINC429_STD_BNR_MSG:
-                    readMsgReturnStatus = ARINC429_ProcessStdBNRmessage( thisRxMsg, // Received message, includes msg config
-                                                                         ARINCMsg ); // Received ARINC message
-                    break;
-
-                case ARINC429_STD_BCD_MSG:
-                    thisRxMsg->data.rawARINCword = ARINCMsg;
-                    readMsgReturnStatus = ARINC429_ProcessStdBCDmessage( thisRxMsg, ARINCMsg );
-                    break;
-
-                case ARINC429_DISCRETE_MSG:
-                    thisRxMsg->data.rawARINCword = ARINCMsg;
-                    readMsgReturnStatus = ARINC429_ProcessDiscreteMessage( thisRxMsg, ARINCMsg );
-                    break;
-                default:
-                    readMsgReturnStatus = ARINC429_READ_MSG_ERROR; // Error-- Un-handled message type. This should not happen.
-                    break;
-            }
-
-            /* If message was successfully processed then update babbling status and record new message receipt time */
-            if (ARINC429_READ_MSG_SUCCESS == readMsgReturnStatus)
-            {
-                uint32_t timestamp_now_ms = Timer23_GetTimestamp_ms( );
+        readMsgReturnStatus = ARINC429_READ_MSG_ERROR_NO_MATCHING_LABEL;
+    }
+    else
+    {
+        const ARINC429_LabelConfig * const msgConfig = &(rxMsgArray->msgConfigs[slot]);
+        ARINC429_RxMsgState * const msgState = &(rxMsgArray->msgStates[slot]);
 
-                thisRxMsg->data.isNotBabbling = ARINC429_IsLabelDataNotBabbling( timestamp_now_ms, // Check for babbling (do this before updating the last message receipt time)
-                                                                                 thisRxMsg );
-                thisRxMsg->data.sysTimeLastGoodMsg_ms = timestamp_now_ms;
-            }
+        /* Check the message. It is decoded when its data is first read. */
+        readMsgReturnStatus = ARINC429_CheckReceivedMessage( msgConfig, ARINCMsg );
 
-            labelMatchFound = true;
-        }
-        else
+        /* If message was successfully processed then update babbling status and record new message receipt time */
+        if (ARINC429_READ_MSG_SUCCESS == readMsgReturnStatus)
         {
-            count++;
+            msgState->data.isNotBabbling = ARINC429_IsLabelDataNotBabbling( rxTimestamp_ticks, // Check for babbling (do this before updating the last message receipt time)
+                                                                             msgState );
+            msgState->data.sysTimeLastGoodMsg_ticks = rxTimestamp_ticks;
+            msgState->data.rawARINCword = ARINCMsg;
+            msgState->data.isDecoded = false; // Decoded data is of the previous word
         }
     }
 
-    if (false == labelMatchFound)
-    {
-        readMsgReturnStatus = ARINC429_READ_MSG_ERROR_NO_MATCHING_LABEL;
-    }
-
     return readMsgReturnStatus;
 }
-#ARINC429_ProcessReceivedMessage
+#ARINC429_ProcessReceivedMessageWithTimestamp
 
 #ARINC429_AssembleStdBNRmessage
 /* Function: ARINC429_AssembleStdBNRmessage
  *
  * Description: Constructs a transmit 32bit ARINC429 word based on the input 
  *      txMsg. Writes the input parameter as the result of the assembled 
- *      ARINC429 word. 
+ *      ARINC429 word. The data is encoded with the txMsg's fixed-point codec
+ *      if it has one. 
  * 
  * Return: ARINC429_WriteMsgReturnStatus based on write status. 
  * 
@@ -370,11 +549,17 @@ ARINC429_WriteMsgReturnStatus ARINC429_AssembleStdBNRmessage( const ARINC429_TxM
     bool isDataClipped = false;
 
     ARINC429_WriteMsgReturnStatus writeMsgReturnStatus;
-    if (EXIT_FAILURE == ARINC429_BNR_ConvertEngValToRawBNRmsgData( txMsg->msgConfig->numSigBits,
-                                                                   txMsg->msgConfig->resolution,
-                                                                   txMsg->engData,
-                                                                   &dataField,
-                                                                   &isDataClipped ))
+    int32_t convertStatus = (NULL != txMsg->codec) ?
+            ARINC429_BNR_ConvertEngValToRawBNRmsgDataFixedPoint( txMsg->codec,
+                                                                 txMsg->engData,
+                                                                 &dataField,
+                                                                 &isDataClipped ) :
+            ARINC429_BNR_ConvertEngValToRawBNRmsgData( txMsg->msgConfig->numSigBits,
+                                                       txMsg->msgConfig->resolution,
+                                                       txMsg->engData,
+                                                       &dataField,
+                                                       &isDataClipped );
+    if (EXIT_FAILURE == convertStatus)
     {
         writeMsgReturnStatus = ARINC429_WRITE_MSG_ERROR; // Error-- shouldn't happen
     }
@@ -477,7 +662,8 @@ ARINC429_WriteMsgReturnStatus ARINC429_AssembleDiscreteMessage( const ARINC429_T
 #ARINC429_AssembleStdBCDmessage
 /* Function: ARINC429_AssembleStdBCDmessage
  *
- * Description: Assembles a standard BCD ARINC429 message. 
+ * Description: Assembles a standard BCD ARINC429 message. The data is 
+ *      encoded with the txMsg's fixed-point codec if it has one. 
  * 
  * Return: See ARINC429_ReadMsgReturnStatus enum for return values
  * 
@@ -509,12 +695,18 @@ ARINC429_WriteMsgReturnStatus ARINC429_AssembleStdBCDmessage( const ARINC429_TxM
     uint32_t dataField = 0;
     bool isDataClipped = false;
 
-    if (EXIT_FAILURE == ARINC429_BCD_ConvertEngValToBCD( txMsg->msgConfig->numSigDigits,
-                                                         txMsg->msgConfig->resolution,
-                                                         ARINC429_BCD_STD_MSG_MAX_NUM_BITS_MSC,
-                                                         txMsg->engData,
-                                                         &dataField,
-                                                         &isDataClipped ))
+    int32_t convertStatus = (NULL != txMsg->codec) ?
+            ARINC429_BCD_ConvertEngValToBCDfixedPoint( txMsg->codec,
+                                                       txMsg->engData,
+                                                       &dataField,
+                                                       &isDataClipped ) :
+            ARINC429_BCD_ConvertEngValToBCD( txMsg->msgConfig->numSigDigits,
+                                             txMsg->msgConfig->resolution,
+                                             ARINC429_BCD_STD_MSG_MAX_NUM_BITS_MSC,
+                                             txMsg->engData,
+                                             &dataField,
+                                             &isDataClipped );
+    if (EXIT_FAILURE == convertStatus)
     {
         return ARINC429_WRITE_MSG_ERROR; // Error-- shouldn't happen
     }
@@ -558,27 +750,96 @@ ARINC429_WriteMsgReturnStatus ARINC429_AssembleStdBCDmessage( const ARINC429_TxM
  * Description: Checks the upper and lower bounds of ARINC binary engineering 
  *      data. If the  engineering data is out of bounds, the function returns 
  *      an SSM of 00. If data is valid, the function will return a valid SSM (11).
+ *      With a codec, the data is rounded to its raw data field value and 
+ *      checked against the codec's raw valid range in integer arithmetic, 
+ *      so the bounds apply to the value that is transmitted. 
  * 
  * Return: ARINC429_SM failure warning if out of bounds, normal operation if valid. 
  * 
  * Requirement Implemented: INT1.0101.S.IOP.4.008 
  */
 ARINC429_SM ARINC429_CheckValidityOfARINC_BNR_Data( const float engData,
-                                                    const ARINC429_LabelConfig * const lblCfg )
+                                                    const ARINC429_LabelConfig * const lblCfg,
+                                                    const ARINC429_LabelCodec * const codec ) // Fixed-point codec of lblCfg, or NULL
 {
-    return ((engData < lblCfg->minValidValue) || (engData > lblCfg->maxValidValue)) ?
-            ARINC429_SSM_BNR_FAILURE_WARNING : ARINC429_SSM_BNR_NORMAL_OPERATION;
+    bool isInRange;
+    if (NULL != codec)
+    {
+        isInRange = ARINC429_BNR_IsEngValInValidRangeFixedPoint( codec, engData );
+    }
+    else
+    {
+        isInRange = !((engData < lblCfg->minValidValue) || (engData > lblCfg->maxValidValue));
+    }
+    return isInRange ? ARINC429_SSM_BNR_NORMAL_OPERATION : ARINC429_SSM_BNR_FAILURE_WARNING;
 }
 #ARINC429_CheckValidityOfARINC_BNR_Data
 
+#ARINC429_GetLatestLabelState
+/* Function: ARINC429_GetLatestLabelState
+ *
+ * Description: Looks up the slot in an rxMsg array matching a label. If a 
+ *      label match is found, timestamps the time and determines if the 
+ *      message is fresh. Sets the rxFlags parameter to the freshness status 
+ *      of the message along with its stored babbling and bounds statuses. 
+ * 
+ * Return: ARINC429_GetLabelDataReturnStatus status of lookup. 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.010 
+ */
+static ARINC429_GetLabelDataReturnStatus ARINC429_GetLatestLabelState( const ARINC429_RxMsgArray * const rxMsgArray,
+                                                                       const arincLabel hexFlippedLabel,
+                                                                       uint8_t * const slot,
+                                                                       uint8_t * const rxFlags )
+{
+    if ((NULL == rxMsgArray) ||
+            (NULL == rxMsgArray->msgConfigs) ||
+            (NULL == rxMsgArray->msgStates))
+    {
+        return ARINC429_GET_LABEL_DATA_ERROR_INVALID_ARGUMENT; // Error-- invalid function arguments
+    }
+
+    /* Lookup label. Labels wider than 8 bits can never be configured. */
+    *slot = (hexFlippedLabel < ARINC429_NUM_LABELS) ?
+            ARINC429_FindRxMsgSlot( rxMsgArray, (uint8_t) hexFlippedLabel ) : ARINC429_LABEL_INDEX_NO_SLOT;
+
+    if (ARINC429_LABEL_INDEX_NO_SLOT == *slot)
+    {
+        return ARINC429_GET_LABEL_DATA_ERROR_NO_MATCHING_LABEL; // Error-- no matching data could be found for the provided label
+    }
+
+    const ARINC429_RxMsgState * const msgState = &(rxMsgArray->msgStates[*slot]);
+    uint32_t current_time_ticks = Timer23_GetTimestamp_ticks( );
+    uint8_t flags = 0;
+
+    if (true == ARINC429_IsLabelDataFresh( current_time_ticks, msgState ))
+    {
+        flags |= ARINC429_RX_FLAG_FRESH;
+    }
+    if (msgState->data.isNotBabbling)
+    {
+        flags |= ARINC429_RX_FLAG_NOT_BABBLING;
+    }
+    if (msgState->data.isEngDataInBounds)
+    {
+        flags |= ARINC429_RX_FLAG_ENG_DATA_IN_BOUNDS;
+    }
+
+    *rxFlags = flags;
+    return ARINC429_GET_LABEL_DATA_MSG_SUCCESS;
+}
+#ARINC429_GetLatestLabelState
+
 #ARINC429_GetLatestLabelData
 /* Function: ARINC429_GetLatestLabelData
  *
- * Description: Searches an rxMsg array for a matching label. If a label
- *      match is found, set the input return parameter to the data found
- *      in the label match. Timestamps the time and determines if the 
- *      message is fresh. Sets the rxMsgData's isDataFresh parameter 
- *      to the freshness status of the message. 
+ * Description: Looks up the rxMsg in an rxMsg array matching a label. If a 
+ *      label match is found, decodes its latest word if that has not been 
+ *      done since it was received, and points the input return parameter at 
+ *      the data found in the label match, without copying it. Sets the 
+ *      rxFlags parameter to the freshness, babbling and bounds statuses of 
+ *      the message. If no match is found, or the word cannot be decoded, the
+ *      data parameter points at an empty record and no flags are set. 
  * 
  * Return: ARINC429_GetLabelDataReturnStatus status of read. 
  * 
@@ -586,40 +847,36 @@ ARINC429_SM ARINC429_CheckValidityOfARINC_BNR_Data( const float engData,
  */
 ARINC429_GetLabelDataReturnStatus ARINC429_GetLatestLabelData( const ARINC429_RxMsgArray * const rxMsgArray,
                                                                const arincLabel hexFlippedLabel, // The label number of the ARINC data to be retrieved
-                                                               ARINC429_RxMsgData * const rxMsgData ) // The latest received data corresponding to the given label and rx number
+                                                               const ARINC429_RxMsgData ** const rxMsgData, // Set to the latest received data corresponding to the given label and rx number
+                                                               uint8_t * const rxFlags ) // Set to the statuses of the data
 {
-    ARINC429_GetLabelDataReturnStatus getLabelDataReturnStatus;
-
-    if ((NULL == rxMsgArray) ||
-            (NULL == rxMsgData))
+    if ((NULL == rxMsgData) ||
+            (NULL == rxFlags))
     {
-        getLabelDataReturnStatus = ARINC429_GET_LABEL_DATA_ERROR_INVALID_ARGUMENT; // Error-- invalid function arguments
+        return ARINC429_GET_LABEL_DATA_ERROR_INVALID_ARGUMENT; // Error-- invalid function arguments
     }
-    else
+
+    *rxMsgData = &emptyRxMsgData;
+    *rxFlags = 0;
+
+    uint8_t slot;
+    uint8_t flags;
+    ARINC429_GetLabelDataReturnStatus getLabelDataReturnStatus = ARINC429_GetLatestLabelState( rxMsgArray,
+                                                                                               hexFlippedLabel,
+                                                                                               &slot,
+                                                                                               &flags );
+    if (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == getLabelDataReturnStatus)
     {
-        /* Lookup label */
-        size_t count = 0;
-        bool labelMatchFound = false;
-        while ((count < rxMsgArray->numMsgs) &&
-                (count < maxNumRxMsgsInArray))
-        {
-            if (rxMsgArray->rxMsgs[count].msgConfig.label == hexFlippedLabel)
-            {
-                labelMatchFound = true;
-                *rxMsgData = rxMsgArray->rxMsgs[count].data;
-                uint32_t current_time_ms = Timer23_GetTimestamp_ms( );
-                rxMsgData->isDataFresh = ARINC429_IsLabelDataFresh( current_time_ms,
-                                                                    &(rxMsgArray->rxMsgs[count]) );
-                getLabelDataReturnStatus = ARINC429_GET_LABEL_DATA_MSG_SUCCESS; // Success!
-                break;
-            }
+        ARINC429_RxMsgState * const msgState = &(rxMsgArray->msgStates[slot]);
 
-            count++;
+        if (ARINC429_READ_MSG_SUCCESS != ARINC429_DecodeRxMsgData( &(rxMsgArray->msgConfigs[slot]), msgState ))
+        {
+            getLabelDataReturnStatus = ARINC429_GET_LABEL_DATA_ERROR_CONDITIONS_NOT_CORRECT; // Error-- word could not be decoded
         }
-
-        if (false == labelMatchFound)
+        else
         {
-            getLabelDataReturnStatus = ARINC429_GET_LABEL_DATA_ERROR_NO_MATCHING_LABEL; // Error-- no matching data could be found for the provided label
+            *rxMsgData = &(msgState->data);
+            *rxFlags = flags;
         }
     }
 
@@ -627,11 +884,53 @@ ARINC429_GetLabelDataReturnStatus ARINC429_GetLatestLabelData( const ARINC429_Rx
 }
 #ARINC429_GetLatestLabelData
 
+#ARINC429_GetLatestRawLabelData
+/* Function: ARINC429_GetLatestRawLabelData
+ *
+ * Description: As ARINC429_GetLatestLabelData, but does not decode the 
+ *      latest word. Only the raw word, its receipt time and the rxFlags of 
+ *      the data are current; SM, SDI and engDataFloat may belong to an 
+ *      earlier word. For labels which are only retransmitted as-is. 
+ * 
+ * Return: ARINC429_GetLabelDataReturnStatus status of read. 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.010 
+ */
+ARINC429_GetLabelDataReturnStatus ARINC429_GetLatestRawLabelData( const ARINC429_RxMsgArray * const rxMsgArray,
+                                                                  const arincLabel hexFlippedLabel, // The label number of the ARINC data to be retrieved
+                                                                  const ARINC429_RxMsgData ** const rxMsgData, // Set to the latest received data corresponding to the given label and rx number
+                                                                  uint8_t * const rxFlags ) // Set to the statuses of the data
+{
+    if ((NULL == rxMsgData) ||
+            (NULL == rxFlags))
+    {
+        return ARINC429_GET_LABEL_DATA_ERROR_INVALID_ARGUMENT; // Error-- invalid function arguments
+    }
+
+    *rxMsgData = &emptyRxMsgData;
+    *rxFlags = 0;
+
+    uint8_t slot;
+    uint8_t flags;
+    ARINC429_GetLabelDataReturnStatus getLabelDataReturnStatus = ARINC429_GetLatestLabelState( rxMsgArray,
+                                                                                               hexFlippedLabel,
+                                                                                               &slot,
+                                                                                               &flags );
+    if (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == getLabelDataReturnStatus)
+    {
+        *rxMsgData = &(rxMsgArray->msgStates[slot].data);
+        *rxFlags = flags;
+    }
+
+    return getLabelDataReturnStatus;
+}
+#ARINC429_GetLatestRawLabelData
+
 #ARINC429_GetLatestARINC429Word
 /* Function: ARINC429_GetLatestARINC429Word
  *
  * Description: Searches an rxMessageArray for a matching label. If 
- *      ARINC429_GetLatestLabelData finds a matching label, and the 
+ *      ARINC429_GetLatestRawLabelData finds a matching label, and the 
  *      data is fresh and is not babbling, return the ARINC word. 
  *      Otherwise, return false. This function should not directly
  *      set an ARINC429 word, and should use the return status as 
@@ -654,15 +953,16 @@ bool ARINC429_GetLatestARINC429Word( const ARINC429_RxMsgArray * const rxMsgArra
         return false; //error
     }
 
-    ARINC429_RxMsgData data;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray,
-                                                                            FormatLabelNumber( octalStdLabel ),
-                                                                            &data );
+    const ARINC429_RxMsgData * data;
+    uint8_t rxFlags;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestRawLabelData( rxMsgArray,
+                                                                               FormatLabelNumber( octalStdLabel ),
+                                                                               &data,
+                                                                               &rxFlags );
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-            (true == data.isDataFresh) &&
-            (true == data.isNotBabbling))
+            ARINC429_AreRxFlagsValid( rxFlags ))
     {
-        *arincWord = data.rawARINCword;
+        *arincWord = data->rawARINCword;
         return true;
     }
     else
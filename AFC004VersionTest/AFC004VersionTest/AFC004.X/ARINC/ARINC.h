@@ -46,10 +46,19 @@ extern "C" {
 
     /**************  Function Definitions ************************/
 
+    /* Builds the label to slot lookup table of a receive message array and converts its transmit
+     * intervals to timer ticks. Call once after Timer23_Initialize. Returns true on success. */
+    bool ARINC429_InitializeRxMsgArray(ARINC429_RxMsgArray * const rxMsgArray);
+
     /* Processes a received message. See ARINC429_ReadMsgReturnStatus for return types. */
     ARINC429_ReadMsgReturnStatus ARINC429_ProcessReceivedMessage(ARINC429_RxMsgArray * const rxMsgArray,
             const uint32_t ARINCMsg);
 
+    /* As ARINC429_ProcessReceivedMessage, with the Timer23 tick at which the word was read from the transceiver */
+    ARINC429_ReadMsgReturnStatus ARINC429_ProcessReceivedMessageWithTimestamp(ARINC429_RxMsgArray * const rxMsgArray,
+            const uint32_t ARINCMsg,
+            const uint32_t rxTimestamp_ticks);
+
     ARINC429_WriteMsgReturnStatus ARINC429_AssembleStdBNRmessage(const ARINC429_TxMsg * const txMsg,
             uint32_t * const ARINCMsg);
 
@@ -59,16 +68,26 @@ extern "C" {
     ARINC429_WriteMsgReturnStatus ARINC429_AssembleDiscreteMessage(const ARINC429_TxMsg * const txMsg, // Message to transmit, includes message configuration
             uint32_t * const arincMsg); // Assembled ARINC message
 
-    /* ARINC 429 Check data validity. Returns SSM */
+    /* ARINC 429 Check data validity, in fixed point when the label has a codec. Returns SSM */
     ARINC429_SM ARINC429_CheckValidityOfARINC_BNR_Data(const float engData,
-            const ARINC429_LabelConfig * const lblCfg);
+            const ARINC429_LabelConfig * const lblCfg,
+            const ARINC429_LabelCodec * const codec); // Fixed-point codec of lblCfg. If NULL the range is checked in floating point.
 
-    /* Reports whether a received message is fresh (i.e. the maximum receive interval has not been exceeded). This function should be
+    /* Gives a read-only view of the latest data received for a label and its ARINC429_RX_FLAG_ statuses, including
+     * whether it is fresh (i.e. the maximum receive interval has not been exceeded). This function should be
      * called when the application code is accessing the ARINC data that has been transferred from the ARINC chip to the microcontroller.
-     * */
+     * If the label cannot be read the view is of an empty record and no flags are set. */
     ARINC429_GetLabelDataReturnStatus ARINC429_GetLatestLabelData(const ARINC429_RxMsgArray * const rxMsgArray,
             const arincLabel label, // The label number of the ARINC data to be retrieved
-            ARINC429_RxMsgData * const rxMsgData); // The latest received data corresponding to the given label and rx number
+            const ARINC429_RxMsgData ** const rxMsgData, // Set to the latest received data corresponding to the given label and rx number
+            uint8_t * const rxFlags); // Set to the statuses of the data
+
+    /* As ARINC429_GetLatestLabelData, but does not decode the latest word. Only rawARINCword, sysTimeLastGoodMsg_ticks
+     * and the flags are current. For labels which are only retransmitted as-is. */
+    ARINC429_GetLabelDataReturnStatus ARINC429_GetLatestRawLabelData(const ARINC429_RxMsgArray * const rxMsgArray,
+            const arincLabel label, // The label number of the ARINC data to be retrieved
+            const ARINC429_RxMsgData ** const rxMsgData, // Set to the latest received data, not decoded
+            uint8_t * const rxFlags); // Set to the statuses of the data
 
     bool ARINC429_GetLatestARINC429Word(const ARINC429_RxMsgArray * const rxMsgArray,
             const arincLabel octalStdLabel,
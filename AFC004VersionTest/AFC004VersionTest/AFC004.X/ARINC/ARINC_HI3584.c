@@ -18,10 +18,31 @@
 
 /**************  Include Files  ************************/
 #include "ARINC_HI3584.h"
+#include "Timer23.h"
 
 /**************  Macro Definition(s) ***********************/
 #define MAX_NUM_REGOCNIZED_LABELS 16 //label filter setup 
 
+/* Data bus ownership. Every bus transaction is bracketed by these so that an 
+ * interrupt servicing the receivers can tell when the bus is mid-transaction. 
+ * Calls may nest (e.g. LoadCtrlReg reading back the control register). */
+#define ACQUIRE_DATA_BUS( ) (dataBusBusyDepth++)
+#define RELEASE_DATA_BUS( ) (dataBusBusyDepth--)
+
+/* Wait for DR2 to deassert after the second EN2 rising edge of a FIFO read. The HI-3584 datasheet gives
+ * tD/R (delay, 2nd EN rising to DR rising) as 200 ns max. Timer23 runs at 114 ticks per ms with a 1:256
+ * prescale, i.e. Fcy is about 29.2 MHz and Tcy 34.3 ns, so 6 instruction cycles (206 ns) cover it before
+ * DR2 is sampled again, without counting on the instructions the compiler places in between. */
+#define WAIT_FOR_DR2_UPDATE( ) \
+    do { \
+        Nop( ); \
+        Nop( ); \
+        Nop( ); \
+        Nop( ); \
+        Nop( ); \
+        Nop( ); \
+    } while (0)
+
 /**************  Type Definition(s) ************************/
 typedef enum ARINC429_HI3584_DataBusDir_t
 {
@@ -29,14 +50,79 @@ typedef enum ARINC429_HI3584_DataBusDir_t
     ARINC429_HI3584_DATA_DIR_INPUT /* Specifies the data bus direction as output */
 } ARINC429_HI3584_DataBusDir;
 
+/* Run of data bus bits wired to consecutive pins of one port */
+typedef struct ARINC429_HI3584_DataBusRun_t
+{
+    uint16_t busMask; /* Data bus bits carried by this run */
+    int16_t pinShift; /* Left shift from data bus bit position to port pin position (negative shifts right) */
+} ARINC429_HI3584_DataBusRun;
+
+/* Data bus pins on one port. Runs that are not used have a busMask of 0. */
+typedef struct ARINC429_HI3584_DataBusPort_t
+{
+    volatile uint16_t * lat; /* Port latch register, written when driving the bus */
+    volatile uint16_t * port; /* Port register, read when reading the bus */
+    volatile uint16_t * tris; /* Port direction register */
+    uint16_t pinMask; /* All port pins used by the data bus */
+    ARINC429_HI3584_DataBusRun runs[2];
+} ARINC429_HI3584_DataBusPort;
+
 /**************  Local Constant(s) *************************/
 static const size_t txvrRxFIFOsize = 32; //32 ; // Size of each HI3584 receiver buffers
 static const uint32_t lpTestData = 0xA5A5A500; // Loop back test data
 static const uint32_t lpTestRx1ReadbackVal = 0xA5A5A500; // Loop back test rx1 expected read-back value 
 static const uint32_t lpTestRx2ReadbackVal = 0xDA5A5AFF; // Loop back test rx2 expected read-back value
-static const uint32_t lpTestMaxDelay = 50000; // Software delay for loop back test
+static const uint32_t lpTestMaxWait_ms = 15; // Longest wait for a test word to loop back (about the old 50000 count spin)
 static const size_t lpTestNumCycles = 50; // Number of cycles to perform during loop back test
 
+/* Data bus pin map grouped by port - see the DBxx pin definitions in ARINC_HI3584.h.
+ * A 16-bit bus transfer is one read-modify-write (or read) per port. */
+static const ARINC429_HI3584_DataBusPort dataBusPortMap[] = {
+    {
+        /* DB00-DB03 on RC1-RC4 */
+        .lat = &LATC,
+        .port = &PORTC,
+        .tris = &TRISC,
+        .pinMask = 0x001E,
+        .runs =
+        {
+            { .busMask = 0x000F, .pinShift = 1 },
+            { .busMask = 0x0000, .pinShift = 0 }
+        }
+    },
+    {
+        /* DB04-DB05 on RA12-RA13, DB08-DB09 on RA9-RA10 */
+        .lat = &LATA,
+        .port = &PORTA,
+        .tris = &TRISA,
+        .pinMask = 0x3600,
+        .runs =
+        {
+            { .busMask = 0x0030, .pinShift = 8 },
+            { .busMask = 0x0300, .pinShift = 1 }
+        }
+    },
+    {
+        /* DB06-DB07 on RB6-RB7, DB10-DB15 on RB8-RB13 */
+        .lat = &LATB,
+        .port = &PORTB,
+        .tris = &TRISB,
+        .pinMask = 0x3FC0,
+        .runs =
+        {
+            { .busMask = 0x00C0, .pinShift = 0 },
+            { .busMask = 0xFC00, .pinShift = -2 }
+        }
+    }
+};
+
+static const size_t dataBusNumPorts = sizeof (dataBusPortMap) / sizeof (ARINC429_HI3584_DataBusPort);
+static const size_t dataBusNumRunsPerPort = sizeof (dataBusPortMap[0].runs) / sizeof (ARINC429_HI3584_DataBusRun);
+
+
+/**************  Local Variable(s) *************************/
+static volatile uint16_t dataBusBusyDepth = 0; /* Non-zero while a data bus transaction is in progress */
+
 
 /**************  Static Function Definition(s) *************/
 
@@ -55,6 +141,11 @@ static uint16_t ARINC429_HI3584_txvrA_ReadBackControlRegister( );
 /* Reads back the value of transceiver B control register*/
 static uint16_t ARINC429_HI3584_txvrB_ReadBackControlRegister( );
 
+/* Tells whether a transceiver's loop back test still has cycles to run */
+static bool IsLoopbackTestRunning( const size_t counter,
+                                   const uint32_t rx1readback,
+                                   const uint32_t rx2readback );
+
 
 /**********************   Functions     ***************************/
 
@@ -168,11 +259,28 @@ void ARINC429_HI3584_txvrB_Initialize( )
     return;
 }
 
+/* Function: ARINC429_HI3584_IsDataBusBusy
+ * 
+ * Description: Reports whether a data bus transaction is in progress. An 
+ * interrupt that reads the transceivers must not touch the data bus or 
+ * control lines while this is true, as it may have interrupted a transaction
+ * in the main line code. 
+ *
+ * Return: True if the data bus is in use, false if otherwise. 
+ * 
+ * Requirement(s) Implemented: INT1.0101.S.IOP.1.001
+ */
+bool ARINC429_HI3584_IsDataBusBusy( void )
+{
+    return (0 != dataBusBusyDepth);
+}
+
 /* Function: Config16bitDataBusDirection
  * 
  * Description: This function configures the direction of the 16-bit data bus signals. 
  * The direction of the data bus can be configured as digital output/input for either 
- * sending or receiving data from the ARINC device.
+ * sending or receiving data from the ARINC device. The data bus pins of each port
+ * are set with a single read-modify-write of the port's TRIS register.
  *
  * Return: None 
  * 
@@ -180,23 +288,19 @@ void ARINC429_HI3584_txvrB_Initialize( )
  */
 static void Config16bitDataBusDirection( const ARINC429_HI3584_DataBusDir busDirection ) /* Data Bus Configuration Register. */
 {
-    uint16_t trisVal = (ARINC429_HI3584_DATA_DIR_INPUT == busDirection) ? 1 : 0;
-    DB00_TRIS = trisVal;
-    DB01_TRIS = trisVal;
-    DB02_TRIS = trisVal;
-    DB03_TRIS = trisVal;
-    DB04_TRIS = trisVal;
-    DB05_TRIS = trisVal;
-    DB06_TRIS = trisVal;
-    DB07_TRIS = trisVal;
-    DB08_TRIS = trisVal;
-    DB09_TRIS = trisVal;
-    DB10_TRIS = trisVal;
-    DB11_TRIS = trisVal;
-    DB12_TRIS = trisVal;
-    DB13_TRIS = trisVal;
-    DB14_TRIS = trisVal;
-    DB15_TRIS = trisVal;
+    size_t portIdx;
+    for (portIdx = 0; portIdx < dataBusNumPorts; portIdx++)
+    {
+        const ARINC429_HI3584_DataBusPort * const busPort = &dataBusPortMap[portIdx];
+        if (ARINC429_HI3584_DATA_DIR_INPUT == busDirection)
+        {
+            *(busPort->tris) |= busPort->pinMask;
+        }
+        else
+        {
+            *(busPort->tris) &= ~(busPort->pinMask);
+        }
+    }
     return;
 }
 
@@ -205,6 +309,7 @@ static void Config16bitDataBusDirection( const ARINC429_HI3584_DataBusDir busDir
  *
  * Description:
  * The data word is loaded into the 16 bus signals interfaced with the ARINC devices.
+ * Each port's data bus pins are updated with a single read-modify-write of its LAT register.
  * 
  * Return: None 
  * 
@@ -212,52 +317,53 @@ static void Config16bitDataBusDirection( const ARINC429_HI3584_DataBusDir busDir
  */
 static void WriteDataTo16bitDataBus( const uint16_t dataBusWriteValue ) /* Write data to be loaded into the data bus. */
 {
-    DB00_WRITE = dataBusWriteValue & 1;
-    DB01_WRITE = ((dataBusWriteValue >> 1) & 1);
-    DB02_WRITE = ((dataBusWriteValue >> 2) & 1);
-    DB03_WRITE = ((dataBusWriteValue >> 3) & 1);
-    DB04_WRITE = ((dataBusWriteValue >> 4) & 1);
-    DB05_WRITE = ((dataBusWriteValue >> 5) & 1);
-    DB06_WRITE = ((dataBusWriteValue >> 6) & 1);
-    DB07_WRITE = ((dataBusWriteValue >> 7) & 1);
-    DB08_WRITE = ((dataBusWriteValue >> 8) & 1);
-    DB09_WRITE = ((dataBusWriteValue >> 9) & 1);
-    DB10_WRITE = ((dataBusWriteValue >> 10) & 1);
-    DB11_WRITE = ((dataBusWriteValue >> 11) & 1);
-    DB12_WRITE = ((dataBusWriteValue >> 12) & 1);
-    DB13_WRITE = ((dataBusWriteValue >> 13) & 1);
-    DB14_WRITE = ((dataBusWriteValue >> 14) & 1);
-    DB15_WRITE = ((dataBusWriteValue >> 15) & 1);
+    size_t portIdx;
+    for (portIdx = 0; portIdx < dataBusNumPorts; portIdx++)
+    {
+        const ARINC429_HI3584_DataBusPort * const busPort = &dataBusPortMap[portIdx];
+
+        /* Merge the data bus bits of each run into their pin positions */
+        uint16_t pinVal = 0;
+        size_t runIdx;
+        for (runIdx = 0; runIdx < dataBusNumRunsPerPort; runIdx++)
+        {
+            const ARINC429_HI3584_DataBusRun * const run = &(busPort->runs[runIdx]);
+            uint16_t busBits = dataBusWriteValue & run->busMask;
+            pinVal |= (run->pinShift >= 0) ? (busBits << run->pinShift) : (busBits >> -(run->pinShift));
+        }
+
+        *(busPort->lat) = (*(busPort->lat) & ~(busPort->pinMask)) | pinVal;
+    }
     return;
 }
 
 /* Function: ReadDataFrom16bitDataBus
  * 
  * Description: The data bus signals are read and returned as a 16 bit word.
+ * Each port used by the data bus is read once.
  *
- * Return: None 
+ * Return: 16 bit data bus value 
  * 
  * Requirement(s) Implemented: INT1.0102.S.IOP.6.003.D02
  */
 static uint16_t ReadDataFrom16bitDataBus( void )
 {
-    /* Read data bus pins bit-by-bit */
-    uint16_t busRead = (DB15_READ & 1);
-    busRead = (busRead << 1) | (DB14_READ & 1);
-    busRead = (busRead << 1) | (DB13_READ & 1);
-    busRead = (busRead << 1) | (DB12_READ & 1);
-    busRead = (busRead << 1) | (DB11_READ & 1);
-    busRead = (busRead << 1) | (DB10_READ & 1);
-    busRead = (busRead << 1) | (DB09_READ & 1);
-    busRead = (busRead << 1) | (DB08_READ & 1);
-    busRead = (busRead << 1) | (DB07_READ & 1);
-    busRead = (busRead << 1) | (DB06_READ & 1);
-    busRead = (busRead << 1) | (DB05_READ & 1);
-    busRead = (busRead << 1) | (DB04_READ & 1);
-    busRead = (busRead << 1) | (DB03_READ & 1);
-    busRead = (busRead << 1) | (DB02_READ & 1);
-    busRead = (busRead << 1) | (DB01_READ & 1);
-    busRead = (busRead << 1) | (DB00_READ & 1);
+    uint16_t busRead = 0;
+    size_t portIdx;
+    for (portIdx = 0; portIdx < dataBusNumPorts; portIdx++)
+    {
+        const ARINC429_HI3584_DataBusPort * const busPort = &dataBusPortMap[portIdx];
+        uint16_t pinVal = *(busPort->port); /* Read the port once */
+
+        /* Move the pins of each run back to their data bus bit positions */
+        size_t runIdx;
+        for (runIdx = 0; runIdx < dataBusNumRunsPerPort; runIdx++)
+        {
+            const ARINC429_HI3584_DataBusRun * const run = &(busPort->runs[runIdx]);
+            uint16_t busBits = (run->pinShift >= 0) ? (pinVal >> run->pinShift) : (pinVal << -(run->pinShift));
+            busRead |= busBits & run->busMask;
+        }
+    }
     return busRead;
 }
 
@@ -272,6 +378,8 @@ static uint16_t ReadDataFrom16bitDataBus( void )
  */
 uint32_t ARINC429_HI3584_txvrA_rx1_ReadWord( void )
 {
+    ACQUIRE_DATA_BUS( );
+
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
 
     ARINC429_HI3584_TXVRA_EN1 = 1; /* Set to default state */
@@ -286,6 +394,7 @@ uint32_t ARINC429_HI3584_txvrA_rx1_ReadWord( void )
     ARINCwordRead |= ((uint32_t) ReadDataFrom16bitDataBus( )) << 16; /* Read the upper 16 bits of the ARINC message */
     ARINC429_HI3584_TXVRA_EN1 = 1; /* Set back to default state */
 
+    RELEASE_DATA_BUS( );
     return ARINCwordRead;
 }
 
@@ -300,6 +409,8 @@ uint32_t ARINC429_HI3584_txvrA_rx1_ReadWord( void )
  */
 uint32_t ARINC429_HI3584_txvrA_rx2_ReadWord( void )
 {
+    ACQUIRE_DATA_BUS( );
+
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
 
     ARINC429_HI3584_TXVRA_EN1 = 1; /* Set to default state */
@@ -314,9 +425,59 @@ uint32_t ARINC429_HI3584_txvrA_rx2_ReadWord( void )
     ARINCwordRead |= ((uint32_t) ReadDataFrom16bitDataBus( )) << 16; /* Read the upper 16 bits of the ARINC message */
     ARINC429_HI3584_TXVRA_EN2 = 1; /* Set back to default state */
 
+    RELEASE_DATA_BUS( );
     return ARINCwordRead;
 }
 
+/* Function: ARINC429_HI3584_txvrA_rx2_ReadFIFO
+ *
+ * Description: Burst reads the receiver 2 FIFO of transceiver A. The data bus
+ * direction and the enable lines are set up once, then words are read 
+ * while DR2 is asserted (low) by pulsing EN2 twice per word, with SEL 
+ * selecting the lower and upper 16 bits. Words are only stored into the 
+ * caller's array; decoding is left to the caller once the FIFO is drained.
+ *
+ * Return: Number of words written to rxWords (at most maxNumWords)
+ *
+ * Requirement(s) Implemented: INT1.0101.S.IOP.1.010
+ */
+size_t ARINC429_HI3584_txvrA_rx2_ReadFIFO( uint32_t * const rxWords, /* Array to receive the raw ARINC words */
+                                           const size_t maxNumWords ) /* Size of rxWords */
+{
+    if (NULL == rxWords)
+    {
+        return 0;
+    }
+
+    ACQUIRE_DATA_BUS( );
+
+    Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
+
+    ARINC429_HI3584_TXVRA_EN1 = 1; /* Set to default state */
+    ARINC429_HI3584_TXVRA_EN2 = 1; /* Set to default state */
+
+    size_t numWordsRead = 0;
+    while ((0 == ARINC429_HI3584_TXVRA_DR2) && (numWordsRead < maxNumWords))
+    {
+        ARINC429_HI3584_TXVRA_SEL = 0; /* Select the lower 16 bits for read operation. */
+        ARINC429_HI3584_TXVRA_EN2 = 0; /* Loads the data bus with the lower 16-bits of the received ARINC Message. */
+        uint32_t ARINCwordRead = ReadDataFrom16bitDataBus( ); /* Read the lower 16 bits of the ARINC message */
+
+        ARINC429_HI3584_TXVRA_EN2 = 1; /* Set back to default state */
+        ARINC429_HI3584_TXVRA_SEL = 1; /* Select the upper 16 bits for read operation. */
+        ARINC429_HI3584_TXVRA_EN2 = 0; /* Loads the data bus with the upper 16-bits of the received ARINC Message. */
+        ARINCwordRead |= ((uint32_t) ReadDataFrom16bitDataBus( )) << 16; /* Read the upper 16 bits of the ARINC message */
+        ARINC429_HI3584_TXVRA_EN2 = 1; /* Set back to default state */
+
+        rxWords[numWordsRead] = ARINCwordRead;
+        numWordsRead++;
+        WAIT_FOR_DR2_UPDATE( ); /* tD/R, 200 ns, before DR2 is sampled again */
+    }
+
+    RELEASE_DATA_BUS( );
+    return numWordsRead;
+}
+
 /* Function: ARINC429_HI3584_txvrA_TransmitWord
  *
  * Description: The data is loaded into the ARINC device by pulsing the PL1 
@@ -328,6 +489,8 @@ uint32_t ARINC429_HI3584_txvrA_rx2_ReadWord( void )
  */
 void ARINC429_HI3584_txvrA_TransmitWord( const uint32_t ARINCword ) /* 32-bit ARINC word to transmit */
 {
+    ACQUIRE_DATA_BUS( );
+
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_BUS_DIR_OUTPUT );
     WriteDataTo16bitDataBus( (uint16_t) (ARINCword & 0xFFFF) ); /* Output lower 16 bits of the ARINC message */
 
@@ -343,6 +506,7 @@ void ARINC429_HI3584_txvrA_TransmitWord( const uint32_t ARINCword ) /* 32-bit AR
 
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
 
+    RELEASE_DATA_BUS( );
     return;
 }
 
@@ -358,6 +522,8 @@ void ARINC429_HI3584_txvrA_TransmitWord( const uint32_t ARINCword ) /* 32-bit AR
  */
 bool ARINC429_HI3584_txvrA_LoadCtrlReg( const uint16_t ctrlRegVal ) /* transceiver control register value */
 {
+    ACQUIRE_DATA_BUS( );
+
     /* Write Control Register */
     ARINC429_HI3584_TXVRA_SEL = 0; /* Select the configuration data load operation */
     ARINC429_HI3584_TXVRA_CWSTR = 0; /* Release the data bus */
@@ -367,6 +533,7 @@ bool ARINC429_HI3584_txvrA_LoadCtrlReg( const uint16_t ctrlRegVal ) /* transceiv
 
     /* Read Control Register */
     uint16_t readBack = ARINC429_HI3584_txvrA_ReadBackControlRegister( );
+    RELEASE_DATA_BUS( );
     return (ctrlRegVal == readBack);
 }
 
@@ -382,12 +549,15 @@ bool ARINC429_HI3584_txvrA_LoadCtrlReg( const uint16_t ctrlRegVal ) /* transceiv
 
 static uint16_t ARINC429_HI3584_txvrA_ReadBackControlRegister( )
 {
+    ACQUIRE_DATA_BUS( );
+
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
     ARINC429_HI3584_TXVRA_SEL = 1; /* Select configuration data read operation. */
     ARINC429_HI3584_TXVRA_RSR = 0; /* Load the 16-bit data bus with the control register data from the ARINC transceiver */
     uint16_t controlRegReadback = ReadDataFrom16bitDataBus( ); /* Read the control register value from the 16-bit data bus. */
     ARINC429_HI3584_TXVRA_RSR = 1; /* Signal the ARINC transceiver to release the 16-bit data bus. */
     ARINC429_HI3584_TXVRA_SEL = 0; /* Set back to default state. */
+    RELEASE_DATA_BUS( );
     return controlRegReadback;
 }
 
@@ -402,6 +572,8 @@ static uint16_t ARINC429_HI3584_txvrA_ReadBackControlRegister( )
  */
 uint32_t ARINC429_HI3584_txvrB_rx1_ReadWord( void )
 {
+    ACQUIRE_DATA_BUS( );
+
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
 
     ARINC429_HI3584_TXVRB_EN1 = 1; /* Set to default state */
@@ -416,6 +588,7 @@ uint32_t ARINC429_HI3584_txvrB_rx1_ReadWord( void )
     ARINCwordRead |= ((uint32_t) ReadDataFrom16bitDataBus( )) << 16; /* Read the upper 16 bits of the ARINC message */
     ARINC429_HI3584_TXVRB_EN1 = 1; /* Set back to default state */
 
+    RELEASE_DATA_BUS( );
     return ARINCwordRead;
 }
 
@@ -430,6 +603,8 @@ uint32_t ARINC429_HI3584_txvrB_rx1_ReadWord( void )
  */
 uint32_t ARINC429_HI3584_txvrB_rx2_ReadWord( void )
 {
+    ACQUIRE_DATA_BUS( );
+
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
 
     ARINC429_HI3584_TXVRB_EN1 = 1; /* Set to default state */
@@ -444,9 +619,59 @@ uint32_t ARINC429_HI3584_txvrB_rx2_ReadWord( void )
     ARINCwordRead |= ((uint32_t) ReadDataFrom16bitDataBus( )) << 16; /* Read the upper 16 bits of the ARINC message */
     ARINC429_HI3584_TXVRB_EN2 = 1; /* Set back to default state */
 
+    RELEASE_DATA_BUS( );
     return ARINCwordRead;
 }
 
+/* Function: ARINC429_HI3584_txvrB_rx2_ReadFIFO
+ *
+ * Description: Burst reads the receiver 2 FIFO of transceiver B. The data bus
+ * direction and the enable lines are set up once, then words are read 
+ * while DR2 is asserted (low) by pulsing EN2 twice per word, with SEL 
+ * selecting the lower and upper 16 bits. Words are only stored into the 
+ * caller's array; decoding is left to the caller once the FIFO is drained.
+ *
+ * Return: Number of words written to rxWords (at most maxNumWords)
+ *
+ * Requirement(s) Implemented: INT1.0101.S.IOP.1.017
+ */
+size_t ARINC429_HI3584_txvrB_rx2_ReadFIFO( uint32_t * const rxWords, /* Array to receive the raw ARINC words */
+                                           const size_t maxNumWords ) /* Size of rxWords */
+{
+    if (NULL == rxWords)
+    {
+        return 0;
+    }
+
+    ACQUIRE_DATA_BUS( );
+
+    Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
+
+    ARINC429_HI3584_TXVRB_EN1 = 1; /* Set to default state */
+    ARINC429_HI3584_TXVRB_EN2 = 1; /* Set to default state */
+
+    size_t numWordsRead = 0;
+    while ((0 == ARINC429_HI3584_TXVRB_DR2) && (numWordsRead < maxNumWords))
+    {
+        ARINC429_HI3584_TXVRB_SEL = 0; /* Select the lower 16 bits for read operation. */
+        ARINC429_HI3584_TXVRB_EN2 = 0; /* Loads the data bus with the lower 16-bits of the received ARINC Message. */
+        uint32_t ARINCwordRead = ReadDataFrom16bitDataBus( ); /* Read the lower 16 bits of the ARINC message */
+
+        ARINC429_HI3584_TXVRB_EN2 = 1; /* Set back to default state */
+        ARINC429_HI3584_TXVRB_SEL = 1; /* Select the upper 16 bits for read operation. */
+        ARINC429_HI3584_TXVRB_EN2 = 0; /* Loads the data bus with the upper 16-bits of the received ARINC Message. */
+        ARINCwordRead |= ((uint32_t) ReadDataFrom16bitDataBus( )) << 16; /* Read the upper 16 bits of the ARINC message */
+        ARINC429_HI3584_TXVRB_EN2 = 1; /* Set back to default state */
+
+        rxWords[numWordsRead] = ARINCwordRead;
+        numWordsRead++;
+        WAIT_FOR_DR2_UPDATE( ); /* tD/R, 200 ns, before DR2 is sampled again */
+    }
+
+    RELEASE_DATA_BUS( );
+    return numWordsRead;
+}
+
 /* Function: ARINC429_HI3584_txvrB_TransmitWord
  * 
  * Description: The data is loaded into the ARINC device by pulsing the PL1 
@@ -458,6 +683,8 @@ uint32_t ARINC429_HI3584_txvrB_rx2_ReadWord( void )
  */
 void ARINC429_HI3584_txvrB_TransmitWord( const uint32_t ARINCword ) /* 32-bit ARINC word to transmit */
 {
+    ACQUIRE_DATA_BUS( );
+
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_BUS_DIR_OUTPUT );
     WriteDataTo16bitDataBus( (uint16_t) (ARINCword & 0xFFFF) ); /* Output lower 16 bits of the ARINC message */
 
@@ -473,6 +700,7 @@ void ARINC429_HI3584_txvrB_TransmitWord( const uint32_t ARINCword ) /* 32-bit AR
 
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
 
+    RELEASE_DATA_BUS( );
     return;
 }
 
@@ -488,6 +716,8 @@ void ARINC429_HI3584_txvrB_TransmitWord( const uint32_t ARINCword ) /* 32-bit AR
  */
 bool ARINC429_HI3584_txvrB_LoadCtrlReg( const uint16_t ctrlRegVal ) /* control register value */
 {
+    ACQUIRE_DATA_BUS( );
+
     /* Write Control Register.*/
     ARINC429_HI3584_TXVRB_SEL = 0; /* Select the configuration data load operation */
     ARINC429_HI3584_TXVRB_CWSTR = 0; /* Release the data bus. */
@@ -497,6 +727,7 @@ bool ARINC429_HI3584_txvrB_LoadCtrlReg( const uint16_t ctrlRegVal ) /* control r
 
     /* Read Control Register.*/
     uint16_t readBackValue = ARINC429_HI3584_txvrB_ReadBackControlRegister( );
+    RELEASE_DATA_BUS( );
     return (ctrlRegVal == readBackValue);
 }
 
@@ -510,6 +741,8 @@ bool ARINC429_HI3584_txvrB_LoadCtrlReg( const uint16_t ctrlRegVal ) /* control r
  */
 static uint16_t ARINC429_HI3584_txvrB_ReadBackControlRegister( )
 {
+    ACQUIRE_DATA_BUS( );
+
     /* Read Control Register.*/
     Config16bitDataBusDirection( ARINC429_HI3584_DATA_DIR_INPUT );
     ARINC429_HI3584_TXVRB_SEL = 1; /* Select configuration data read operation */
@@ -517,118 +750,122 @@ static uint16_t ARINC429_HI3584_txvrB_ReadBackControlRegister( )
     uint16_t controlRegReadback = ReadDataFrom16bitDataBus( ); /* Read the control register value from the 16-bit data bus. */
     ARINC429_HI3584_TXVRB_RSR = 1; /* Pull the RSR pin high to release the 16 bit data bus by the ARINC device. */
     ARINC429_HI3584_TXVRB_SEL = 0; /* Pull the SEL pin low to its default state. */
+    RELEASE_DATA_BUS( );
     return controlRegReadback;
 }
 
-/* Function: ARINC429_HI3584_txvrA_LoopbackTest
+/* Function: ARINC429_HI3584_LoopbackTest
  *
- * Description: Loop back test is performed by sending a known Message on 
- *      the ARINC transmit and verifying the received values.
+ * Description: Loop back test is performed on both transceivers at once by 
+ *      sending a known Message on each ARINC transmitter and verifying the 
+ *      values received by both of its receivers. Each transceiver runs its 
+ *      own cycles and stops on its own first mismatch, as if tested alone. 
+ *      Timer23 must be initialized, as it times out the wait for a test word. 
+ * 
+ *      While waiting for the test words to loop back, waitTask is called 
+ *      repeatedly, if not NULL, so other startup work can use the time. It 
+ *      must not use the data bus and should return quickly, as the data ready 
+ *      pins are only checked between calls. 
  *
- * Return: True if loopback test was successful, false if otherwise.
+ * Return: True if the loopback test of both transceivers was successful, false if otherwise.
  *
- * Requirement(s) Implemented: INT1.0101.S.IOP.1.006
+ * Requirement(s) Implemented: INT1.0101.S.IOP.1.006, INT1.0101.S.IOP.1.013
  */
-bool ARINC429_HI3584_txvrA_LoopbackTest( void )
+bool ARINC429_HI3584_LoopbackTest( void( *waitTask )( void ) ) /* Work to do while test words loop back, or NULL */
 {
-    uint16_t currentCtrRegValue = ARINC429_HI3584_txvrA_ReadBackControlRegister( );
-    bool status = ARINC429_HI3584_txvrA_LoadCtrlReg( 0x8000 ); /* Enable self test (i.e. loop back) mode */
+    ACQUIRE_DATA_BUS( );
+
+    uint16_t currentCtrRegValueA = ARINC429_HI3584_txvrA_ReadBackControlRegister( );
+    uint16_t currentCtrRegValueB = ARINC429_HI3584_txvrB_ReadBackControlRegister( );
+    bool statusA = ARINC429_HI3584_txvrA_LoadCtrlReg( 0x8000 ); /* Enable self test (i.e. loop back) mode */
+    bool statusB = ARINC429_HI3584_txvrB_LoadCtrlReg( 0x8000 );
 
     // Flush receiver FIFOs first before sending test words
     size_t currFIFOflushCount = 0;
     while (currFIFOflushCount <= txvrRxFIFOsize)
     {
         ARINC429_HI3584_txvrA_rx1_ReadWord( );
-        currFIFOflushCount++;
-    }
-
-    currFIFOflushCount = 0;
-    while (currFIFOflushCount <= txvrRxFIFOsize)
-    {
         ARINC429_HI3584_txvrA_rx2_ReadWord( );
+        ARINC429_HI3584_txvrB_rx1_ReadWord( );
+        ARINC429_HI3584_txvrB_rx2_ReadWord( );
         currFIFOflushCount++;
     }
 
     // Send test words and verify read-back value
-    size_t counter = 0;
-    uint32_t rx1readback = lpTestRx1ReadbackVal;
-    uint32_t rx2readback = lpTestRx2ReadbackVal;
-    while ( (counter < lpTestNumCycles) &&
-            ( ( (lpTestRx1ReadbackVal == rx1readback) && (lpTestRx2ReadbackVal == rx2readback) ) || (1 == counter) ) ) // Ignores 1st readback 
+    const uint32_t maxWait_ticks = Timer23_ConvertMsToTicks( lpTestMaxWait_ms );
+    size_t counterA = 0;
+    size_t counterB = 0;
+    uint32_t rx1readbackA = lpTestRx1ReadbackVal;
+    uint32_t rx2readbackA = lpTestRx2ReadbackVal;
+    uint32_t rx1readbackB = lpTestRx1ReadbackVal;
+    uint32_t rx2readbackB = lpTestRx2ReadbackVal;
+    bool isTestRunningA = IsLoopbackTestRunning( counterA, rx1readbackA, rx2readbackA );
+    bool isTestRunningB = IsLoopbackTestRunning( counterB, rx1readbackB, rx2readbackB );
+
+    while (isTestRunningA || isTestRunningB)
+    {
+        if (isTestRunningA)
         {
             ARINC429_HI3584_txvrA_TransmitWord( lpTestData );
+        }
+        if (isTestRunningB)
+        {
+            ARINC429_HI3584_txvrB_TransmitWord( lpTestData );
+        }
 
-            uint32_t delayCounter = 0;
-            while (((1 == ARINC429_HI3584_TXVRA_DR1) || (1 == ARINC429_HI3584_TXVRA_DR2)) && (delayCounter < lpTestMaxDelay))
+        /* Data ready pins are active low. Wait until every receiver under test has its word. */
+        const uint32_t waitStart_ticks = Timer23_GetTimestamp_ticks( );
+        while (((isTestRunningA && ((1 == ARINC429_HI3584_TXVRA_DR1) || (1 == ARINC429_HI3584_TXVRA_DR2))) ||
+                (isTestRunningB && ((1 == ARINC429_HI3584_TXVRB_DR1) || (1 == ARINC429_HI3584_TXVRB_DR2)))) &&
+                ((Timer23_GetTimestamp_ticks( ) - waitStart_ticks) < maxWait_ticks))
+        {
+            if (NULL != waitTask)
             {
-                delayCounter++;
+                waitTask( );
             }
-            rx1readback = ARINC429_HI3584_txvrA_rx1_ReadWord( );
-            rx2readback = ARINC429_HI3584_txvrA_rx2_ReadWord( );
-            counter++;
         }
 
-    status &= ((lpTestRx1ReadbackVal == rx1readback) && (lpTestRx2ReadbackVal == rx2readback)) ? true : false;
-            ARINC429_HI3584_txvrA_LoadCtrlReg( currentCtrRegValue );
+        if (isTestRunningA)
+        {
+            rx1readbackA = ARINC429_HI3584_txvrA_rx1_ReadWord( );
+            rx2readbackA = ARINC429_HI3584_txvrA_rx2_ReadWord( );
+            counterA++;
+            isTestRunningA = IsLoopbackTestRunning( counterA, rx1readbackA, rx2readbackA );
+        }
+        if (isTestRunningB)
+        {
+            rx1readbackB = ARINC429_HI3584_txvrB_rx1_ReadWord( );
+            rx2readbackB = ARINC429_HI3584_txvrB_rx2_ReadWord( );
+            counterB++;
+            isTestRunningB = IsLoopbackTestRunning( counterB, rx1readbackB, rx2readbackB );
+        }
+    }
+
+    statusA &= ((lpTestRx1ReadbackVal == rx1readbackA) && (lpTestRx2ReadbackVal == rx2readbackA)) ? true : false;
+    statusB &= ((lpTestRx1ReadbackVal == rx1readbackB) && (lpTestRx2ReadbackVal == rx2readbackB)) ? true : false;
+    ARINC429_HI3584_txvrA_LoadCtrlReg( currentCtrRegValueA );
+    ARINC429_HI3584_txvrB_LoadCtrlReg( currentCtrRegValueB );
 
-    return status;
+    RELEASE_DATA_BUS( );
+    return (statusA && statusB);
 }
 
-/* Function: ARINC429_HI3584_txvrB_LoopbackTest
+/* Function: IsLoopbackTestRunning
  * 
- * Description: Loop back test is performed by sending a known Message 
- *      on the ARINC transmit and verifying the received values.
+ * Description: A transceiver's loop back test runs for lpTestNumCycles cycles, 
+ *      or until a cycle reads back the wrong values. The first read-back is 
+ *      ignored. 
  *
- * Return: True if loopback test succeeded, false if otherwise. 
+ * Return: True if the transceiver needs another loop back test cycle. 
  * 
- * Requirement(s) Implemented: INT1.0101.S.IOP.1.013
+ * Requirement(s) Implemented: INT1.0101.S.IOP.1.006, INT1.0101.S.IOP.1.013
  */
-bool ARINC429_HI3584_txvrB_LoopbackTest( void )
+static bool IsLoopbackTestRunning( const size_t counter, /* Cycles run so far */
+                                   const uint32_t rx1readback, /* Last receiver 1 read-back */
+                                   const uint32_t rx2readback ) /* Last receiver 2 read-back */
 {
-    uint16_t currentCtrRegValue = ARINC429_HI3584_txvrB_ReadBackControlRegister( );
-            bool status = ARINC429_HI3584_txvrB_LoadCtrlReg( 0x8000 ); /* Enable self test (i.e. loop back) mode */
-
-            // Flush receiver FIFOs before sending test words
-            size_t currFIFOflushCount = 0;
-    while (currFIFOflushCount <= txvrRxFIFOsize)
-    {
-        ARINC429_HI3584_txvrB_rx1_ReadWord( );
-                currFIFOflushCount++;
-    }
-
-    currFIFOflushCount = 0;
-    while (currFIFOflushCount <= txvrRxFIFOsize)
-    {
-        ARINC429_HI3584_txvrB_rx2_ReadWord( );
-                currFIFOflushCount++;
-    }
-
-    // Send test words and verify read-back value
-    uint32_t counter = 0;
-            uint32_t rx1readback = lpTestRx1ReadbackVal;
-            uint32_t rx2readback = lpTestRx2ReadbackVal;
-
-    while ( (counter < lpTestNumCycles) &&
-            ( ( (lpTestRx1ReadbackVal == rx1readback) && (lpTestRx2ReadbackVal == rx2readback) ) || (1 == counter) ) ) // Ignores 1st readback 
-        {
-            ARINC429_HI3584_txvrB_TransmitWord( lpTestData );
-
-            uint32_t delayCounter = 0;
-            //        while (delayCounter < lpTestMaxDelay)
-            while (((1 == ARINC429_HI3584_TXVRB_DR1) || (1 == ARINC429_HI3584_TXVRB_DR2)) && (delayCounter < lpTestMaxDelay))
-            {
-                delayCounter++;
-            }
-
-            rx1readback = ARINC429_HI3584_txvrB_rx1_ReadWord( );
-            rx2readback = ARINC429_HI3584_txvrB_rx2_ReadWord( );
-            counter++;
-        }
-
-    status &= ((lpTestRx1ReadbackVal == rx1readback) && (lpTestRx2ReadbackVal == rx2readback)) ? true : false;
-            ARINC429_HI3584_txvrB_LoadCtrlReg( currentCtrRegValue );
-
-    return status;
+    return ((counter < lpTestNumCycles) &&
+            (((lpTestRx1ReadbackVal == rx1readback) && (lpTestRx2ReadbackVal == rx2readback)) || (1 == counter))) ? true : false;
 }
 
 /* Function: ARINC429_HI3584_SetupLabelFiltersTxrA
@@ -650,11 +887,13 @@ bool ARINC429_HI3584_SetupLabelFiltersTxvrA( const ARINC429_RxMsgArray * const m
         return false;
     }
 
+    ACQUIRE_DATA_BUS( );
+
     uint16_t rxLabelsTxrA[MAX_NUM_REGOCNIZED_LABELS]; // Note: These labels are written in hex-flipped format. 
             size_t counter;
     for (counter = 0; counter < msgs->numMsgs; counter++)
     {
-        rxLabelsTxrA[counter] = msgs->rxMsgs[counter].msgConfig.label;
+        rxLabelsTxrA[counter] = msgs->msgConfigs[counter].label;
     }
     for (; counter < MAX_NUM_REGOCNIZED_LABELS; counter++)
     {
@@ -726,6 +965,7 @@ bool ARINC429_HI3584_SetupLabelFiltersTxvrA( const ARINC429_RxMsgArray * const m
 
     ARINC429_HI3584_txvrA_LoadCtrlReg( currentControlReg ); // Restore the original control register value 
 
+    RELEASE_DATA_BUS( );
     return isReadBackValid;
 }
 
@@ -749,11 +989,13 @@ bool ARINC429_HI3584_SetupLabelFiltersTxvrB( const ARINC429_RxMsgArray * const m
         return false;
     }
 
+    ACQUIRE_DATA_BUS( );
+
     uint8_t rxLabelsTxrB[MAX_NUM_REGOCNIZED_LABELS]; // Note: These labels are written in hex-flipped format. 
             size_t counter;
     for (counter = 0; counter < msgs->numMsgs; counter++)
     {
-        rxLabelsTxrB[counter] = msgs->rxMsgs[counter].msgConfig.label;
+        rxLabelsTxrB[counter] = msgs->msgConfigs[counter].label;
     }
     for (; counter < MAX_NUM_REGOCNIZED_LABELS; counter++)
     {
@@ -824,6 +1066,7 @@ bool ARINC429_HI3584_SetupLabelFiltersTxvrB( const ARINC429_RxMsgArray * const m
     }
 
     ARINC429_HI3584_txvrB_LoadCtrlReg( currentControlReg ); // Restore the original control register value 
+    RELEASE_DATA_BUS( );
     return isReadBackValid;
 }
 /* end ARINC-HI3584.c source file */
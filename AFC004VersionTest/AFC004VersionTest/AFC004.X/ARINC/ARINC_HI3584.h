@@ -220,6 +220,10 @@ uint32_t ARINC429_HI3584_txvrA_rx1_ReadWord(void);
 /* Reads one ARINC message from ARINC transceiver A, receiver 2. */
 uint32_t ARINC429_HI3584_txvrA_rx2_ReadWord(void);
 
+/* Reads every available message (up to maxNumWords) from ARINC transceiver A, receiver 2. Returns the number of words read. */
+size_t ARINC429_HI3584_txvrA_rx2_ReadFIFO(uint32_t * const rxWords, /* Array to receive the raw ARINC words */
+        const size_t maxNumWords); /* Size of rxWords */
+
 /* Loads data into the ARINC transmit buffer of ARINC transceiver A. */
 void ARINC429_HI3584_txvrA_TransmitWord(const uint32_t ARINCword); /* 32-bit ARINC word to transmit */
 
@@ -232,17 +236,21 @@ uint32_t ARINC429_HI3584_txvrB_rx1_ReadWord(void);
 /* Reads one ARINC message from ARINC transceiver B, receiver 2. */
 uint32_t ARINC429_HI3584_txvrB_rx2_ReadWord(void);
 
+/* Reads every available message (up to maxNumWords) from ARINC transceiver B, receiver 2. Returns the number of words read. */
+size_t ARINC429_HI3584_txvrB_rx2_ReadFIFO(uint32_t * const rxWords, /* Array to receive the raw ARINC words */
+        const size_t maxNumWords); /* Size of rxWords */
+
 /* Loads data into the ARINC transmit buffer of ARINC transceiver A. */
 void ARINC429_HI3584_txvrB_TransmitWord(const uint32_t ARINCword); /* 32-bit ARINC word to transmit */
 
 /* Loads configuration data into ARINC transceiver B. */
 bool ARINC429_HI3584_txvrB_LoadCtrlReg(const uint16_t ctrlRegVal); /* transceiver control register value */
 
-/* Performs a loop back test on ARINC transceiver A, receiver 2. */
-bool ARINC429_HI3584_txvrA_LoopbackTest(void);
+/* Performs the loop back tests of ARINC transceivers A and B concurrently, calling waitTask while test words loop back. */
+bool ARINC429_HI3584_LoopbackTest(void( *waitTask )(void)); /* Work to do while test words loop back, or NULL */
 
-/* Performs a loop back test on ARINC transceiver B, receiver 2. */
-bool ARINC429_HI3584_txvrB_LoopbackTest(void);
+/* Reports whether a data bus transaction is in progress (e.g. when interrupted by an ISR). */
+bool ARINC429_HI3584_IsDataBusBusy(void);
 
 /* Configures label filters for both transceivers from configuration data */
 bool ARINC429_HI3584_SetupLabelFiltersTxvrB(const ARINC429_RxMsgArray * const msgs);
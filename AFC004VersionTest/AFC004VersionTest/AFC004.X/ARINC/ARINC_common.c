@@ -18,7 +18,497 @@
 #include <math.h>
 
 
+/**************  Macro Definitions  ********************/
+/* IEEE 754 single precision fields, as used by the fixed-point conversions */
+#define FLOAT_SIGN_BIT_MASK       0x80000000UL
+#define FLOAT_EXP_FIELD_SHIFT     23
+#define FLOAT_EXP_FIELD_MASK      0xFFu
+#define FLOAT_EXP_FIELD_MAX       0xFFu       // Infinity or NaN
+#define FLOAT_MANT_FIELD_MASK     0x007FFFFFUL
+#define FLOAT_MANT_HIDDEN_BIT     0x00800000UL
+#define FLOAT_NUM_MANT_BITS       24          // Including the hidden bit
+#define FLOAT_EXP_BIAS_AND_SHIFT  150         // Exponent bias (127) plus mantissa field bits (23)
+
+#define BCD_PAIR_INVALID     0xFFu        // BCD pair to binary table entry of a byte holding a non-BCD digit
+#define BCD_PAIR_RADIX       100u         // Two BCD digits per byte
+#define BCD_DIGITS_PER_PAIR  2
+
+#define INV_RESOLUTION_DIVIDEND_SHIFT  55     // (2^55 - 1) / (24 bit mantissa) gives a 32 bit Q-format inverse resolution
+
+
+/**************  Type Definitions  ************************/
+typedef union
+{
+    float value;
+    uint32_t bits;
+} ARINC429_FloatBits;
+
+
+/**************  Variable Definitions  ********************/
+/* Packed BCD byte (two digits) to binary, BCD_PAIR_INVALID if either digit is not a BCD digit. 
+ * Const data is kept in program memory and read through the PSV window. Both pair tables are
+ * checked entry by entry against the one digit conversion by AFC004.X/HostTest/ArincBCDTableTest.c. */
+static const uint8_t bcdPairToBinary[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+/* Binary 0-99 to packed BCD byte (two digits) */
+static const uint8_t binaryToBCDpair[BCD_PAIR_RADIX] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+    0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x60, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95,
+    0x96, 0x97, 0x98, 0x99
+};
+
+
+/**************  Static Function Prototypes  ************/
+static uint8_t ARINC429_BitLength( uint32_t value );
+
+static float ARINC429_MultiplyByResolution( const int32_t rawValue,
+                                            const float resolution );
+
+static uint32_t ARINC429_ScaleEngValToRawMagnitude( const ARINC429_LabelCodec * const codec,
+                                                    const float dataEng,
+                                                    const bool isSumRoundedToFloat,
+                                                    bool * const isNegative );
+
+static int32_t ARINC429_ScaleEngValToClippedRaw( const ARINC429_LabelCodec * const codec,
+                                                 const float dataEng );
+
+static uint32_t ARINC429_BCD_ConvertIntToBCD( const size_t numDigits,
+                                              uint32_t value );
+
+static uint32_t ARINC429_BCD_GetMaxValue( const size_t numSigDigits,
+                                          const size_t numBitsMSC );
+
+
+/**************  Static Function Definition(s)  *************/
+#ARINC429_BitLength
+/* Function: ARINC429_BitLength
+ *
+ * Description: Finds the number of bits needed to hold a value, i.e. the 
+ *      position of its most significant set bit plus one. 
+ * 
+ * Return: Bit length of value, 0 if value is 0 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.016 
+ */
+static uint8_t ARINC429_BitLength( uint32_t value )
+{
+    uint8_t length = 0;
+
+    if (value >> 16)
+    {
+        length += 16;
+        value >>= 16;
+    }
+    if (value >> 8)
+    {
+        length += 8;
+        value >>= 8;
+    }
+    if (value >> 4)
+    {
+        length += 4;
+        value >>= 4;
+    }
+    if (value >> 2)
+    {
+        length += 2;
+        value >>= 2;
+    }
+    if (value >> 1)
+    {
+        length += 1;
+        value >>= 1;
+    }
+    return length + (uint8_t) value;
+}
+#ARINC429_BitLength
+
+#ARINC429_MultiplyByResolution
+/* Function: ARINC429_MultiplyByResolution
+ *
+ * Description: Computes (float) rawValue * resolution in integer arithmetic.
+ *      The exact product of the raw value and the resolution's mantissa is
+ *      rounded to the nearest float, ties to even, which is what the float 
+ *      multiply does, so the result is bit-identical to it. Cases the 
+ *      integer path does not cover (zero, raw values too wide to convert to 
+ *      float exactly, and resolutions or results outside the normal float 
+ *      range) use the float multiply. 
+ * 
+ * Return: rawValue * resolution 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.016 
+ */
+static float ARINC429_MultiplyByResolution( const int32_t rawValue,
+                                            const float resolution )
+{
+    ARINC429_FloatBits result;
+    ARINC429_FloatBits res;
+    res.value = resolution;
+
+    const uint16_t resExpField = (uint16_t) ((res.bits >> FLOAT_EXP_FIELD_SHIFT) & FLOAT_EXP_FIELD_MASK);
+    const uint32_t magnitude = (rawValue < 0) ? (0u - (uint32_t) rawValue) : (uint32_t) rawValue;
+
+    if ((0 == magnitude) ||
+            (magnitude > FLOAT_MANT_HIDDEN_BIT * 2u) || // Not exactly representable as a float
+            (0 == resExpField) ||
+            (FLOAT_EXP_FIELD_MAX == resExpField))
+    {
+        return (float) rawValue * resolution;
+    }
+
+    /* rawValue * resolution = product * 2^(resExpField - bias - 23) */
+    uint64_t product = (uint64_t) magnitude * ((res.bits & FLOAT_MANT_FIELD_MASK) | FLOAT_MANT_HIDDEN_BIT);
+
+    /* The mantissa's top bit is bit 23, so the product is either (length of magnitude + 23) or + 24 bits long */
+    uint8_t productLength = ARINC429_BitLength( magnitude ) + (FLOAT_NUM_MANT_BITS - 1);
+    if (0 != (product >> productLength))
+    {
+        productLength++;
+    }
+
+    /* Round the product to 24 bits, nearest with ties to even */
+    uint8_t shift = productLength - FLOAT_NUM_MANT_BITS;
+    uint32_t mantissa = (uint32_t) (product >> shift);
+    if (shift > 0)
+    {
+        const uint64_t remainder = product & (((uint64_t) 1 << shift) - 1u);
+        const uint64_t half = (uint64_t) 1 << (shift - 1);
+        if ((remainder > half) ||
+                ((remainder == half) && (0 != (mantissa & 0x1u))))
+        {
+            mantissa++;
+            if (mantissa == (FLOAT_MANT_HIDDEN_BIT << 1))
+            {
+                mantissa >>= 1;
+                shift++;
+            }
+        }
+    }
+
+    const int16_t expField = (int16_t) resExpField + shift;
+    if (expField >= (int16_t) FLOAT_EXP_FIELD_MAX)
+    {
+        return (float) rawValue * resolution; // Overflow
+    }
+
+    result.bits = ((uint32_t) expField << FLOAT_EXP_FIELD_SHIFT) | (mantissa & FLOAT_MANT_FIELD_MASK);
+    result.bits |= (res.bits ^ ((rawValue < 0) ? FLOAT_SIGN_BIT_MASK : 0u)) & FLOAT_SIGN_BIT_MASK;
+    return result.value;
+}
+#ARINC429_MultiplyByResolution
+
+#ARINC429_ScaleEngValToRawMagnitude
+/* Function: ARINC429_ScaleEngValToRawMagnitude
+ *
+ * Description: Divides a value in engineering units by the resolution of a
+ *      label and rounds the magnitude half away from zero, in integer 
+ *      arithmetic, giving the same result as the float conversions. Those 
+ *      divide in float, so the quotient of the mantissas is estimated with 
+ *      the codec's Q-format inverse resolution, corrected with its exact 
+ *      remainder and rounded to a float mantissa, nearest with ties to even.
+ *      Half is then added, exactly, or rounded to float as a float add does 
+ *      when isSumRoundedToFloat is set, and the result is truncated. 
+ *      Quotients of 2^23 and above, infinities and NaNs saturate. 
+ * 
+ * Return: Rounded magnitude of dataEng / resolution, or UINT32_MAX if saturated 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.015 
+ */
+static uint32_t ARINC429_ScaleEngValToRawMagnitude( const ARINC429_LabelCodec * const codec,
+                                                    const float dataEng,
+                                                    const bool isSumRoundedToFloat, // Half is added in float rather than exactly
+                                                    bool * const isNegative )
+{
+    ARINC429_FloatBits eng;
+    eng.value = dataEng;
+
+    const int16_t expField = (int16_t) ((eng.bits >> FLOAT_EXP_FIELD_SHIFT) & FLOAT_EXP_FIELD_MASK);
+    *isNegative = (0 != (eng.bits & FLOAT_SIGN_BIT_MASK));
+
+    if ((int16_t) FLOAT_EXP_FIELD_MAX == expField)
+    {
+        return UINT32_MAX; // Infinity or NaN
+    }
+    if ((0 == expField) ||
+            (0 == codec->resolutionMant))
+    {
+        return 0; // Zero or denormal data, or zero resolution
+    }
+
+    /* Quotient of the mantissas, as quotientMant in [2^23, 2^24) */
+    const uint32_t engMant = (eng.bits & FLOAT_MANT_FIELD_MASK) | FLOAT_MANT_HIDDEN_BIT;
+    const uint8_t dividendShift = (engMant >= codec->resolutionMant) ? (FLOAT_NUM_MANT_BITS - 1) : FLOAT_NUM_MANT_BITS;
+    const uint64_t dividend = (uint64_t) engMant << dividendShift;
+
+    uint32_t quotientMant = (uint32_t) (((uint64_t) engMant * codec->invResolutionMant) >> (INV_RESOLUTION_DIVIDEND_SHIFT - dividendShift));
+    uint64_t remainder = dividend - (uint64_t) quotientMant * codec->resolutionMant;
+    while (remainder >= codec->resolutionMant) // Estimate is at most low
+    {
+        quotientMant++;
+        remainder -= codec->resolutionMant;
+    }
+
+    /* dataEng / resolution in float = quotientMant * 2^quotientExp */
+    int16_t quotientExp = expField - codec->resolutionExp - dividendShift;
+    if (((remainder << 1) > codec->resolutionMant) ||
+            (((remainder << 1) == codec->resolutionMant) && (0 != (quotientMant & 0x1u))))
+    {
+        quotientMant++;
+        if (quotientMant == (FLOAT_MANT_HIDDEN_BIT << 1))
+        {
+            quotientMant >>= 1;
+            quotientExp++;
+        }
+    }
+
+    if (quotientExp >= 0)
+    {
+        return UINT32_MAX; // At least 2^23
+    }
+    if (quotientExp < -(FLOAT_NUM_MANT_BITS + 1))
+    {
+        return 0; // Less than a quarter
+    }
+
+    /* Add one half, in units of 2^quotientExp, and truncate */
+    uint32_t sum = quotientMant + ((uint32_t) 0x1 << (-quotientExp - 1));
+    if (isSumRoundedToFloat &&
+            (sum >= (FLOAT_MANT_HIDDEN_BIT << 1)) &&
+            (0 != (sum & 0x1u)))
+    {
+        /* 25 bit sum is a tie between two floats. Round to the even one. */
+        sum = ((sum >> 1) + ((sum >> 1) & 0x1u)) << 1;
+    }
+    return sum >> -quotientExp;
+}
+#ARINC429_ScaleEngValToRawMagnitude
+
+#ARINC429_ScaleEngValToClippedRaw
+/* Function: ARINC429_ScaleEngValToClippedRaw
+ *
+ * Description: Scales a value in engineering units to a signed raw data 
+ *      field value, rounded as the BNR encode rounds it, and clips it to the 
+ *      smallest and largest values of the data field. 
+ * 
+ * Return: Rounded raw value of dataEng, clipped to [minRaw, maxRaw] 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.008 
+ */
+static int32_t ARINC429_ScaleEngValToClippedRaw( const ARINC429_LabelCodec * const codec,
+                                                 const float dataEng )
+{
+    bool isNegative;
+    const uint32_t magnitude = ARINC429_ScaleEngValToRawMagnitude( codec, dataEng, false, &isNegative );
+
+    if (isNegative)
+    {
+        return (magnitude > (uint32_t) -codec->minRaw) ? codec->minRaw : -(int32_t) magnitude;
+    }
+    return (magnitude > (uint32_t) codec->maxRaw) ? codec->maxRaw : (int32_t) magnitude;
+}
+#ARINC429_ScaleEngValToClippedRaw
+
+#ARINC429_BCD_ConvertIntToBCD
+/* Function: ARINC429_BCD_ConvertIntToBCD
+ *
+ * Description: Converts a value to BCD, two digits per table lookup. The 
+ *      value must fit in numDigits decimal digits (callers clip it first). 
+ * 
+ * Return: BCD value 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.014 
+ */
+static uint32_t ARINC429_BCD_ConvertIntToBCD( const size_t numDigits,
+                                              uint32_t value )
+{
+    uint32_t asBCD = 0;
+    size_t count = 0;
+    while ((value > 0) &&
+            (count < numDigits))
+    {
+        const uint32_t upperPairs = value / BCD_PAIR_RADIX;
+        asBCD |= (uint32_t) binaryToBCDpair[value - upperPairs * BCD_PAIR_RADIX] << (ARINC429_BCD_BITS_PER_DIGIT * count);
+        value = upperPairs;
+        count += BCD_DIGITS_PER_PAIR;
+    }
+    return asBCD;
+}
+#ARINC429_BCD_ConvertIntToBCD
+
+#ARINC429_BCD_GetMaxValue
+/* Function: ARINC429_BCD_GetMaxValue
+ *
+ * Description: Finds the largest value a BCD data field can hold: every 
+ *      digit 9, except the most significant character which is limited by 
+ *      its number of bits. 
+ * 
+ * Return: Largest value of the BCD data field 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.014 
+ */
+static uint32_t ARINC429_BCD_GetMaxValue( const size_t numSigDigits,
+                                          const size_t numBitsMSC )
+{
+    uint32_t maxValue = UINT32_MAX >> (NUM_BITS_IN_UINT32 - numBitsMSC);
+    if (maxValue > ARINC429_BCD_MAX_DIGIT_VAL)
+    {
+        maxValue = ARINC429_BCD_MAX_DIGIT_VAL;
+    }
+
+    size_t count;
+    for (count = 1; count < numSigDigits; count++)
+    {
+        maxValue = maxValue * 10 + ARINC429_BCD_MAX_DIGIT_VAL;
+    }
+    return maxValue;
+}
+#ARINC429_BCD_GetMaxValue
+
+
 /**************  Function Definition(s) ********************/
+#ARINC429_InitializeLabelCodec
+/* Function: ARINC429_InitializeLabelCodec
+ *
+ * Description: Precomputes the fixed-point codec of a BNR or BCD label from
+ *      its configuration: the mantissa and exponent of its resolution, the
+ *      inverse of the mantissa in Q-format, the smallest and largest 
+ *      values its data field can hold, and its valid range as raw values. 
+ *      This is the only division; encoding and range checking with the 
+ *      codec are done in integer arithmetic. Call once at init. 
+ * 
+ * Return: EXIT_SUCCESS if the codec was initialized. EXIT_FAILURE if the 
+ *          arguments are invalid or the resolution is negative, not finite 
+ *          or denormal. 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.015 
+ */
+int32_t ARINC429_InitializeLabelCodec( const ARINC429_LabelConfig * const lblCfg,
+                                       ARINC429_LabelCodec * const codec )
+{
+    if ((NULL == lblCfg) ||
+            (NULL == codec))
+    {
+        return EXIT_FAILURE;
+    }
+
+    switch (lblCfg->msgType)
+    {
+        case ARINC429_STD_BNR_MSG:
+            if ((lblCfg->numSigBits < 1) ||
+                    (lblCfg->numSigBits > ARINC429_BNR_STD_MSG_MAX_NUM_SIGBITS))
+            {
+                return EXIT_FAILURE;
+            }
+            codec->minRaw = -((int32_t) 0x1 << lblCfg->numSigBits);
+            codec->maxRaw = ((int32_t) 0x1 << lblCfg->numSigBits) - 1;
+            break;
+
+        case ARINC429_STD_BCD_MSG:
+            if ((lblCfg->numSigDigits < 1) ||
+                    (lblCfg->numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS))
+            {
+                return EXIT_FAILURE;
+            }
+            codec->minRaw = 0;
+            codec->maxRaw = (int32_t) ARINC429_BCD_GetMaxValue( lblCfg->numSigDigits, ARINC429_BCD_STD_MSG_MAX_NUM_BITS_MSC );
+            break;
+
+        default:
+            return EXIT_FAILURE; // Discrete messages have no resolution
+    }
+
+    ARINC429_FloatBits res;
+    res.value = lblCfg->resolution;
+    const uint16_t resExpField = (uint16_t) ((res.bits >> FLOAT_EXP_FIELD_SHIFT) & FLOAT_EXP_FIELD_MASK);
+
+    codec->numSigBits = lblCfg->numSigBits;
+    codec->numSigDigits = lblCfg->numSigDigits;
+
+    if (0.0f == lblCfg->resolution)
+    {
+        codec->resolutionMant = 0; // Everything encodes as zero, as with the float conversions
+        codec->invResolutionMant = 0;
+        codec->resolutionExp = 0;
+    }
+    else if ((0 != (res.bits & FLOAT_SIGN_BIT_MASK)) ||
+            (0 == resExpField) ||
+            (FLOAT_EXP_FIELD_MAX == resExpField))
+    {
+        return EXIT_FAILURE; // Negative, denormal or not finite
+    }
+    else
+    {
+        codec->resolutionMant = (res.bits & FLOAT_MANT_FIELD_MASK) | FLOAT_MANT_HIDDEN_BIT;
+        codec->invResolutionMant = (uint32_t) ((((uint64_t) 1 << INV_RESOLUTION_DIVIDEND_SHIFT) - 1u) / codec->resolutionMant);
+        codec->resolutionExp = (int16_t) resExpField;
+    }
+
+    /* Valid range as raw values: the raw values whose engineering values, decoded as a receive does, are within it */
+    codec->minValidRaw = ARINC429_ScaleEngValToClippedRaw( codec, lblCfg->minValidValue );
+    if (ARINC429_MultiplyByResolution( codec->minValidRaw, lblCfg->resolution ) < lblCfg->minValidValue)
+    {
+        codec->minValidRaw++; // Rounded below the limit
+    }
+    codec->maxValidRaw = ARINC429_ScaleEngValToClippedRaw( codec, lblCfg->maxValidValue );
+    if (ARINC429_MultiplyByResolution( codec->maxValidRaw, lblCfg->resolution ) > lblCfg->maxValidValue)
+    {
+        codec->maxValidRaw--; // Rounded above the limit
+    }
+
+    return EXIT_SUCCESS;
+}
+#ARINC429_InitializeLabelCodec
+
+#ARINC429_BNR_IsEngValInValidRangeFixedPoint
+/* Function: ARINC429_BNR_IsEngValInValidRangeFixedPoint
+ *
+ * Description: Checks a value in engineering units against the valid range of 
+ *      a BNR label in integer arithmetic. The value is rounded to its raw data 
+ *      field value, as the encode does, and compared with the codec's raw 
+ *      valid range, so the check is made on the value that is transmitted. 
+ *      Values outside the data field, infinities and NaNs are out of range. 
+ * 
+ * Return: true if the transmitted value is within the valid range, false if not 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.008 
+ */
+bool ARINC429_BNR_IsEngValInValidRangeFixedPoint( const ARINC429_LabelCodec * const codec,
+                                                  const float dataEng )
+{
+    bool isNegative;
+    const uint32_t magnitude = ARINC429_ScaleEngValToRawMagnitude( codec, dataEng, false, &isNegative ); // Half is added in double, as in the encode
+
+    if (isNegative ? (magnitude > (uint32_t) -codec->minRaw) : (magnitude > (uint32_t) codec->maxRaw))
+    {
+        return false; // Outside the data field, and clipped when encoded
+    }
+
+    const int32_t rawValue = isNegative ? -(int32_t) magnitude : (int32_t) magnitude;
+    return (rawValue >= codec->minValidRaw) && (rawValue <= codec->maxValidRaw);
+}
+#ARINC429_BNR_IsEngValInValidRangeFixedPoint
+
 
 #ARINC429_BNR_ConvertEngValToRawBNRmsgData
 /* Function: ARINC429_BNR_ConvertEngValToRawBNRmsgData
@@ -88,6 +578,70 @@ int32_t ARINC429_BNR_ConvertEngValToRawBNRmsgData( const size_t numSigBits,
 }
 #ARINC429_BNR_ConvertEngValToRawBNRmsgData
 
+#ARINC429_BNR_ConvertEngValToRawBNRmsgDataFixedPoint
+/* Function: ARINC429_BNR_ConvertEngValToRawBNRmsgDataFixedPoint
+ *
+ * Description: Converts a value from engineering units to raw data field 
+ *      values, as ARINC429_BNR_ConvertEngValToRawBNRmsgData does, using the 
+ *      label's precomputed codec instead of a floating point division. The 
+ *      result and clipping are the same as the float conversion's. 
+ * 
+ * Return: EXIT_SUCCESS if conversion is successful. Returns EXIT_FAILURE if 
+ *          the input arguments are invalid
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.015 
+ */
+int32_t ARINC429_BNR_ConvertEngValToRawBNRmsgDataFixedPoint( const ARINC429_LabelCodec * const codec,
+                                                             const float dataEng,
+                                                             uint32_t * const result,
+                                                             bool * const isDataClipped )
+{
+    if ((NULL == codec) ||
+            (NULL == result) ||
+            (NULL == isDataClipped) ||
+            (codec->numSigBits < 1) ||
+            (codec->numSigBits > ARINC429_BNR_STD_MSG_MAX_NUM_SIGBITS))
+    {
+        return EXIT_FAILURE;
+    }
+
+    bool isNegative;
+    const uint32_t magnitude = ARINC429_ScaleEngValToRawMagnitude( codec, dataEng, false, &isNegative ); // Half is added in double
+
+    bool isClipped = false;
+    uint32_t rawValue;
+    if (isNegative)
+    {
+        if (magnitude > (uint32_t) -codec->minRaw)
+        {
+            /* Negative Overflow:  Sets sign bit to 1 and all other bits to 0 which equates to min data field value*/
+            rawValue = (uint32_t) 0x1 << codec->numSigBits;
+            isClipped = true;
+        }
+        else
+        {
+            rawValue = 0u - magnitude;
+        }
+    }
+    else
+    {
+        if (magnitude > (uint32_t) codec->maxRaw)
+        {
+            rawValue = (uint32_t) codec->maxRaw; // Max possible data field value
+            isClipped = true;
+        }
+        else
+        {
+            rawValue = magnitude;
+        }
+    }
+
+    *isDataClipped = isClipped;
+    *result = rawValue;
+    return EXIT_SUCCESS;
+}
+#ARINC429_BNR_ConvertEngValToRawBNRmsgDataFixedPoint
+
 #ARINC429_BNR_ConvertRawMsgDataToEngUnits
 /* Function: ARINC429_BNR_ConvertRawMsgDataToEngUnits
  *
@@ -122,7 +676,7 @@ int32_t ARINC429_BNR_ConvertRawMsgDataToEngUnits( const uint8_t numSigBits,
         }
 
         int32_t msgDataAsInt = (int32_t) rawMsgData_SignExt;
-        *dataEng = (float) msgDataAsInt * resolution;
+        *dataEng = ARINC429_MultiplyByResolution( msgDataAsInt, resolution );
     }
 
     return success;
@@ -189,37 +743,77 @@ int32_t ARINC429_BCD_ConvertBCDvalToEngVal( const size_t numSigDigits,
         uint32_t calcValue = 0;
         uint32_t tempVal = rawBCDdata;
 
-        size_t count = 0; // Number of digits processed
-        uint32_t multVal = 1;
-        uint32_t thisDigit;
-        while ((tempVal > 0) &&
-                (count < numSigDigits))
+        if (0 != (tempVal >> (ARINC429_BCD_BITS_PER_DIGIT * numSigDigits)))
+        {
+            tempVal = 0xFF; // Error-- more digits than numSigDigits. This will result in EXIT_FAILURE return status.
+        }
+        else
         {
-            // Extract next digit
-            thisDigit = tempVal & 0xF;
-            if (thisDigit > ARINC429_BCD_MAX_DIGIT_VAL) // Verify that the BCD digit is valid
+            uint32_t multVal = 1;
+            uint8_t thisPair;
+            while (tempVal > 0)
             {
-                break; // Error-- unexpected digit in BCD data. This will result in EXIT_FAILURE return status.
-            }
+                // Look up next two digits
+                thisPair = bcdPairToBinary[tempVal & 0xFF];
+                if (BCD_PAIR_INVALID == thisPair) // Verify that the BCD digits are valid
+                {
+                    break; // Error-- unexpected digit in BCD data. This will result in EXIT_FAILURE return status.
+                }
 
-            // Add digit to result
-            calcValue += multVal * thisDigit;
-            tempVal >>= ARINC429_BCD_BITS_PER_DIGIT;
-            multVal *= 10;
-            count++;
+                // Add digits to result
+                calcValue += multVal * thisPair;
+                tempVal >>= (ARINC429_BCD_BITS_PER_DIGIT * BCD_DIGITS_PER_PAIR);
+                multVal *= BCD_PAIR_RADIX;
+            }
         }
 
         success = (0 == tempVal) ? EXIT_SUCCESS : EXIT_FAILURE;
-        *dataEng = (0 == tempVal) ? (float) calcValue * resolution : 0.0f;
+        *dataEng = (0 == tempVal) ? ARINC429_MultiplyByResolution( (int32_t) calcValue, resolution ) : 0.0f;
     }
     return success;
 }
 #ARINC429_BCD_ConvertBCDvalToEngVal
 
+#ARINC429_BCD_IsBCDvalValid
+/* Function: ARINC429_BCD_IsBCDvalValid
+ *
+ * Description: Checks that standard BCD data can be converted by
+ *          ARINC429_BCD_ConvertBCDvalToEngVal, i.e. that it has no more than
+ *          numSigDigits digits and every digit is a valid BCD digit. Does not
+ *          convert the data.
+ * 
+ * Return: true if the BCD data is valid, false otherwise
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.013 
+ */
+bool ARINC429_BCD_IsBCDvalValid( const size_t numSigDigits,
+                                 const uint32_t rawBCDdata ) // BCD data
+{
+    if ((numSigDigits < 1) ||
+            (numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS) ||
+            (0 != (rawBCDdata >> (ARINC429_BCD_BITS_PER_DIGIT * numSigDigits)))) // Data wider than its digits
+    {
+        return false;
+    }
+
+    uint32_t tempVal = rawBCDdata;
+    while (tempVal > 0)
+    {
+        if (BCD_PAIR_INVALID == bcdPairToBinary[tempVal & 0xFF])
+        {
+            return false; // Error-- unexpected digit in BCD data
+        }
+        tempVal >>= (ARINC429_BCD_BITS_PER_DIGIT * BCD_DIGITS_PER_PAIR);
+    }
+    return true;
+}
+#ARINC429_BCD_IsBCDvalValid
+
 #ARINC429_BCD_ConvertEngValToBCD
 /* Function: ARINC429_BCD_ConvertEngValToBCD
  *
- * Description: Converts a BCD engineering value into BCD data format 
+ * Description: Converts a BCD engineering value into BCD data format, two
+ *      digits per table lookup 
  * 
  * Return: EXIT_SUCCESS for successful process, EXIT_FAULIRE for invalid parameters 
  * 
@@ -249,26 +843,12 @@ int32_t ARINC429_BCD_ConvertEngValToBCD( const size_t numSigDigits,
         uint32_t asBCD = 0;
         size_t count = 0;
         uint32_t thisDigit;
-        while ((tempValue > 0) &&
-                (count < numSigDigits))
-        {
-            thisDigit = tempValue % 10;
-
-            if ((numSigDigits == (count + 1)) &&
-                    (thisDigit > (UINT32_MAX >> (NUM_BITS_IN_UINT32 - numBitsMSC))))
-            {
-                break; // Attempting to use out-of-bounds bits
-            }
 
-            asBCD += thisDigit << (ARINC429_BCD_BITS_PER_DIGIT * count);
-            tempValue /= 10;
-            count++;
-        }
-#ARINC429_BCD_ConvertEngValToBCD
-        // Check for data clipping
-        if (0 == tempValue)
+        // Check for data clipping (too many digits, or most significant character uses out-of-bounds bits)
+        if (tempValue <= ARINC429_BCD_GetMaxValue( numSigDigits, numBitsMSC ))
         {
             *isDataClipped = false;
+            asBCD = ARINC429_BCD_ConvertIntToBCD( numSigDigits, tempValue );
         }
         else
         {
@@ -289,5 +869,52 @@ int32_t ARINC429_BCD_ConvertEngValToBCD( const size_t numSigDigits,
 
     return success;
 }
+#ARINC429_BCD_ConvertEngValToBCD
+
+#ARINC429_BCD_ConvertEngValToBCDfixedPoint
+/* Function: ARINC429_BCD_ConvertEngValToBCDfixedPoint
+ *
+ * Description: Converts a BCD engineering value into BCD data format, as
+ *      ARINC429_BCD_ConvertEngValToBCD does with a standard most significant
+ *      character, using the label's precomputed codec instead of a floating 
+ *      point division. Values above the largest the digits can hold are 
+ *      clipped to it. Negative values convert as zero; the sign is carried by
+ *      the SSM. 
+ * 
+ * Return: EXIT_SUCCESS for successful process, EXIT_FAILURE for invalid parameters 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.014 
+ */
+int32_t ARINC429_BCD_ConvertEngValToBCDfixedPoint( const ARINC429_LabelCodec * const codec,
+                                                   const float dataEng, // Input value in engineering units
+                                                   uint32_t * const rawBCDdata, // result
+                                                   bool * const isDataClipped ) // Indicates whether data was clipped
+{
+    if ((NULL == codec) ||
+            (NULL == rawBCDdata) ||
+            (NULL == isDataClipped) ||
+            (codec->numSigDigits < 1) ||
+            (codec->numSigDigits > ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS))
+    {
+        return EXIT_FAILURE;
+    }
+
+    bool isNegative;
+    uint32_t value = ARINC429_ScaleEngValToRawMagnitude( codec, dataEng, true, &isNegative ); // Half is added in float
+    if (isNegative)
+    {
+        value = 0;
+    }
+
+    *isDataClipped = (value > (uint32_t) codec->maxRaw);
+    if (*isDataClipped)
+    {
+        value = (uint32_t) codec->maxRaw; // Data clipped so set to maximum value
+    }
+
+    *rawBCDdata = ARINC429_BCD_ConvertIntToBCD( codec->numSigDigits, value );
+    return EXIT_SUCCESS;
+}
+#ARINC429_BCD_ConvertEngValToBCDfixedPoint
 
 /* End of ARINC_common.c source file. */
@@ -96,6 +96,15 @@ extern "C" {
             uint32_t * const result,
             bool * const isDataClipped);
 
+    /* Converts a value from engineering units to raw data field values, as ARINC429_BNR_ConvertEngValToRawBNRmsgData,
+     * in integer arithmetic using a codec from ARINC429_InitializeLabelCodec.
+     * 
+     * Returns EXIT_SUCCESS if conversion was successful. Returns EXIT_FAILURE otherwise if the input arguments are invalid. */
+    int32_t ARINC429_BNR_ConvertEngValToRawBNRmsgDataFixedPoint(const ARINC429_LabelCodec * const codec,
+            const float dataEng,
+            uint32_t * const result,
+            bool * const isDataClipped);
+
     /* Converts a raw ARINC message field data value to engineering units.
      * 
      * Returns EXIT_SUCCESS if conversion was successful. Returns EXIT_FAILURE if function arguments were invalid. */
@@ -104,6 +113,19 @@ extern "C" {
             float * const dataEng,
             const uint32_t rawMsgData);
 
+    /* Precomputes the fixed-point codec (inverse resolution and data field bounds) of a BNR or BCD label. Call once at init.
+     * 
+     * Returns EXIT_SUCCESS if the codec was initialized. Returns EXIT_FAILURE if the label configuration cannot be encoded in fixed point. */
+    int32_t ARINC429_InitializeLabelCodec(const ARINC429_LabelConfig * const lblCfg,
+            ARINC429_LabelCodec * const codec);
+
+    /* Checks a value in engineering units against the valid range of a BNR label, after rounding it to its raw data field
+     * value, in integer arithmetic using a codec from ARINC429_InitializeLabelCodec.
+     * 
+     * Returns true if the value is within the valid range, false if not. */
+    bool ARINC429_BNR_IsEngValInValidRangeFixedPoint(const ARINC429_LabelCodec * const codec,
+            const float dataEng);
+
     /* Extracts the source/destination identifier bits from a message. */
     uint8_t ARINC429_ExtractSDIbits(uint32_t ARINCMsg);
 
@@ -117,11 +139,21 @@ extern "C" {
             uint32_t * const rawBCDdata, // result
             bool * const isDataClipped);
 
+    /* Converts a value from engineering units to BCD, as ARINC429_BCD_ConvertEngValToBCD with a standard most significant
+     * character, in integer arithmetic using a codec from ARINC429_InitializeLabelCodec. */
+    int32_t ARINC429_BCD_ConvertEngValToBCDfixedPoint(const ARINC429_LabelCodec * const codec,
+            const float dataEng, // Input value in engineering units
+            uint32_t * const rawBCDdata, // result
+            bool * const isDataClipped);
+
     int32_t ARINC429_BCD_ConvertBCDvalToEngVal(const size_t numSigDigits,
             const float resolution,
             float * const dataEng, // Converted result in engineering units.
             const uint32_t rawBCDdata); // BCD data
 
+    bool ARINC429_BCD_IsBCDvalValid(const size_t numSigDigits,
+            const uint32_t rawBCDdata); // BCD data
+
 #ifdef	__cplusplus
 }
 #endif
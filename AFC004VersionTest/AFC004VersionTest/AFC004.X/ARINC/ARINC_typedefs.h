@@ -11,6 +11,10 @@
 extern "C" {
 #endif
 
+    /**************  Macro Definitions ************************/
+#define ARINC429_NUM_LABELS 256u /* Number of possible (8-bit) label values */
+#define ARINC429_LABEL_INDEX_NO_SLOT 0xFFu /* Label index entry for a label that is not configured in the array */
+
     /**************  Type Definitions ************************/
     typedef uint16_t arincLabel; // Holds an ARINC 429 label ()
 
@@ -48,22 +52,29 @@ extern "C" {
         ARINC429_SSM_DIS_FAILURE_WARNING = 3,
     } ARINC429_SM;
 
-    /* ARINC 429 received message data and statuses. */
+    /* ARINC 429 received message data and statuses, packed for the 16-bit core (14 bytes). Read through the
+     * const view returned by ARINC429_GetLatestLabelData(). Discrete bits are read from the raw word. */
     typedef struct ARINC429_RxMsgData_t {
         uint32_t rawARINCword;
+        uint32_t sysTimeLastGoodMsg_ticks; // the system time (in Timer23 ticks) when the last valid message was received
+        float engDataFloat; // BCD/BNR message data field converted to engineering units (float). For BCD messages, this will always be positive.
         uint8_t SM : 2; // Status matrix. For BCD messages, the sign of the data may be indicated with this field and should be processed accordingly by the application code.
         uint8_t SDI : 2; // Source/destination identifier
-        float engDataFloat; // BCD/BNR message data field converted to engineering units (float). For BCD messages, this will always be positive.
-        int32_t engDataInt; // BCD/BNR message data field converted to engineering units (expressed as nearest integer)
-        uint32_t discreteBits; // Discrete bits from the data field (starting from bit 11 for BCD/BNR, shifted fully left in Discrete message), if any are specified.
-        uint32_t sysTimeLastGoodMsg_ms; // the system time (in ms) when the last valid message was received
-        bool isEngDataInBounds; // Indicates whether the BCD/BNR data is within the specified maximum and minimum valid values.
-        bool isNotBabbling; // Set to TRUE if the time between the two most recent data receive events is >= the minimum transmit interval. FALSE otherwise.
-        bool isDataFresh; /* Indicates whether the time expired since the most recent data was received has exceeded the maximum
-                          * transmit interval time. This property is determined when the data is read by the application code using
-                          * the ARINC429_GetLatestLabelData() method */
+        uint8_t isNotBabbling : 1; // Set if the time between the two most recent data receive events is >= the minimum transmit interval.
+        uint8_t isEngDataInBounds : 1; // Indicates whether the BCD/BNR data is within the specified maximum and minimum valid values.
+        uint8_t isDecoded : 1; // Set once SM, SDI and engDataFloat have been decoded from rawARINCword. Cleared when a new word is received.
     } ARINC429_RxMsgData;
 
+    /* Status flags returned with the data view by ARINC429_GetLatestLabelData(). Freshness (the time expired since the most
+     * recent data was received has not exceeded the maximum transmit interval) is determined when the data is read. */
+#define ARINC429_RX_FLAG_FRESH 0x01u
+#define ARINC429_RX_FLAG_NOT_BABBLING 0x02u
+#define ARINC429_RX_FLAG_ENG_DATA_IN_BOUNDS 0x04u
+#define ARINC429_RX_FLAGS_VALID (ARINC429_RX_FLAG_FRESH | ARINC429_RX_FLAG_NOT_BABBLING)
+
+    /* True if the flags mark the data as fresh and not babbling */
+#define ARINC429_AreRxFlagsValid(rxFlags) ((ARINC429_RX_FLAGS_VALID & (rxFlags)) == ARINC429_RX_FLAGS_VALID)
+
     /* ARINC 429 Message Types */
     typedef enum ARINC429_MsgType_t {
         ARINC429_STD_BNR_MSG, // Denotes a standard ARINC 429 BNR (two's-complement binary) message
@@ -110,16 +121,42 @@ extern "C" {
         uint16_t maxTransmitInterval_ms; // Maximum transmit interval, in ms
     } ARINC429_LabelConfig;
 
-    /* Top-level structure for ARINC 429 received messages. Includes configuration, statuses and message data. */
-    typedef struct ARINC429_RxMsg_t {
-        const ARINC429_LabelConfig msgConfig; /* configuration */
+    /* Fixed-point codec of a BNR or BCD label, precomputed from its label configuration at init by 
+     * ARINC429_InitializeLabelCodec() so that the label is encoded and range checked without floating point division. */
+    typedef struct ARINC429_LabelCodec_t {
+        uint32_t resolutionMant; // Resolution mantissa, including the hidden bit. 0 if the resolution is 0.
+        uint32_t invResolutionMant; // (2^55 - 1) / resolutionMant, the inverse of the mantissa in Q-format
+        int16_t resolutionExp; // Resolution biased exponent field
+        uint8_t numSigBits; // BNR messages
+        uint8_t numSigDigits; // BCD messages
+        int32_t minRaw; // Smallest data field value. BNR: -2^numSigBits, BCD: 0
+        int32_t maxRaw; // Largest data field value. BNR: 2^numSigBits - 1, BCD: all digits 9 but the most significant character
+        int32_t minValidRaw; // Smallest data field value whose engineering value is at least minValidValue
+        int32_t maxValidRaw; // Largest data field value whose engineering value is at most maxValidValue
+    } ARINC429_LabelCodec;
+
+    /* ARINC 429 receive state of one configured label. Kept in RAM, in a table parallel to the
+     * label configurations of its receive message array. */
+    typedef struct ARINC429_RxMsgState_t {
         ARINC429_RxMsgData data; /* received message data and statuses */
-    } ARINC429_RxMsg;
 
-    /* Holds an array of received messages and the length of the array */
+        /* Config transmit intervals converted to Timer23 ticks by ARINC429_InitializeRxMsgArray() */
+        uint32_t minTransmitInterval_ticks;
+        uint32_t maxTransmitInterval_ticks;
+    } ARINC429_RxMsgState;
+
+    /* Holds the received messages as two parallel tables of numMsgs entries. The label configurations 
+     * are const, so they stay in program memory (read through PSV) and need no data init at reset. 
+     * The receive states are the only per-label RAM and start cleared. */
     typedef struct ARINC429_RxMsgArray_t {
         const size_t numMsgs;
-        ARINC429_RxMsg * const rxMsgs;
+        const ARINC429_LabelConfig * const msgConfigs;
+        ARINC429_RxMsgState * const msgStates;
+
+        /* Label to msgConfigs[]/msgStates[] slot lookup table (ARINC429_NUM_LABELS entries, indexed by the hex-flipped label).
+         * Populated once at init by ARINC429_InitializeRxMsgArray(). Searched linearly until built. */
+        uint8_t * const labelIndex;
+        bool isLabelIndexBuilt;
 
         /* Added these "bus failure" values back to update status msg. */
         const uint32_t maxBusFailureCounts;
@@ -130,6 +167,7 @@ extern "C" {
     /* ARINC 429 transmitted message data and statuses. */
     typedef struct ARINC429_TxMsg_t {
         const ARINC429_LabelConfig* msgConfig;
+        const ARINC429_LabelCodec* codec; // Fixed-point codec of msgConfig. If NULL the data is encoded in floating point.
         ARINC429_SM SM; // Status matrix. For BCD messages this should include the sign when appropriate.
         uint8_t SDI : 2; // SDI
         float engData; // Message data field converted to engineering units
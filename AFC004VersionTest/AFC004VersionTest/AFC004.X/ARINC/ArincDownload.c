@@ -16,19 +16,204 @@
 #include "ARINC_HI3584.h"
 #include "ARINC.h"
 #include "ArincDownload.h"
+#include "ArincLatencyTrace.h"
+#include "Timer23.h"
 
 
 /**************  Macro Definition(s) ***********************/
 #define MAX_NUM_RX_MSGS 32u 
 #define MAX_OCTAL_LABEL_VALUE 377
 
+#ifdef ARINC429_RX_INTERRUPT_DRIVEN
+#define ARINC_RX_RING_SIZE 64u /* Raw words per receiver ring. Must be a power of two. */
+#define ARINC_RX_RING_MASK (ARINC_RX_RING_SIZE - 1u)
+#define ARINC_RX_DISCARD_BURST 8u /* Words read per burst when discarding FIFO words on a full ring */
+
+
+/**************  Type Definition(s) ************************/
+/* Single producer (service interrupt), single consumer (main loop) ring of raw ARINC words,
+ * each with the Timer23 tick at which it was drained from the FIFO. head is only written by 
+ * the interrupt and tail only by the main loop. Both run freely and are masked on access. */
+typedef struct
+{
+    uint32_t words[ARINC_RX_RING_SIZE];
+    uint32_t drain_ticks[ARINC_RX_RING_SIZE];
+    volatile uint16_t head;
+    volatile uint16_t tail;
+    volatile uint16_t droppedWordCount; /* Words read from the FIFO and discarded because the ring was full, saturates */
+} ArincRxRing;
+
+
+/**************  Local Variable(s) *************************/
+static ArincRxRing txvrArx2Ring;
+static ArincRxRing txvrBrx2Ring;
+#endif
+
+
+/**************  Static Function Prototypes (s) ************/
+static void ProcessDownloadedARINCWords( ARINC429_RxMsgArray * const ARINCMsgArray, // Array to process the words into
+                                         const uint32_t * const rxWords, // Raw words read from a receiver FIFO
+                                         const uint32_t * const rxTicks, // Timer23 tick each word was read at, NULL to timestamp them now
+                                         const size_t numWords ); // Number of words in rxWords
+
+#ifdef ARINC429_RX_INTERRUPT_DRIVEN
+static void ArincRx_DrainFIFOToRing( ArincRxRing * const ring, // Ring to fill
+                                     size_t( *readFIFO )( uint32_t * const, const size_t ) ); // Transceiver FIFO burst read
+
+static void ArincRx_ProcessRing( ArincRxRing * const ring, // Ring to empty
+                                 ARINC429_RxMsgArray * const ARINCMsgArray ); // Array to process the words into
+#endif
+
+
+/**************  Static Function Definition(s) *************/
+#ProcessDownloadedARINCWords
+/* Function: ProcessDownloadedARINCWords
+ * 
+ * Description: Processes raw ARINC words drained from a transceiver FIFO 
+ *      into the input ARINC429_RxMsgArray. If a parity error is detected, 
+ *      discard the message. If a valid message is processed, reset the 
+ *      arinc array's bus counts to zero. Words are timestamped with their
+ *      rxTicks entry, or with the time they are processed if rxTicks is NULL.
+ * 
+ * Return: None (void)
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.3.001
+ */
+static void ProcessDownloadedARINCWords( ARINC429_RxMsgArray * const ARINCMsgArray,
+                                         const uint32_t * const rxWords,
+                                         const uint32_t * const rxTicks,
+                                         const size_t numWords )
+{
+    size_t count;
+    for (count = 0; count < numWords; count++)
+    {
+        if (rxWords[count] & 0x80000000u)
+        {
+            ; // Parity error check 
+        }
+        else if (ARINC429_READ_MSG_SUCCESS == ARINC429_ProcessReceivedMessageWithTimestamp( ARINCMsgArray,
+                                                                                            rxWords[count],
+                                                                                            (NULL != rxTicks) ? rxTicks[count] : Timer23_GetTimestamp_ticks( ) ))
+        {
+            ARINCMsgArray->currentCounts = 0;
+        }
+        else
+        {
+            ; // Nothing 
+        }
+    }
+    return;
+}
+#ProcessDownloadedARINCWords
+
+#ifdef ARINC429_RX_INTERRUPT_DRIVEN
+#ArincRx_DrainFIFOToRing
+/* Function: ArincRx_DrainFIFOToRing
+ * 
+ * Description: Burst reads a receiver FIFO straight into the free space of
+ *      a raw word ring. The free space may wrap, so it is filled in at most
+ *      two contiguous reads. Each word read is stamped with the tick of its
+ *      read. The head index is only advanced once the words and their ticks
+ *      are in place. If the ring fills before the FIFO is empty, the remaining 
+ *      FIFO words are read and discarded, and only those are added to the 
+ *      ring's dropped word count. A FIFO that exactly fills the ring drops 
+ *      nothing. Called from the service interrupt. 
+ * 
+ * Return: None (void)
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.3.001
+ */
+static void ArincRx_DrainFIFOToRing( ArincRxRing * const ring,
+                                     size_t( *readFIFO )( uint32_t * const, const size_t ) )
+{
+    uint16_t head = ring->head;
+    uint16_t freeWords = ARINC_RX_RING_SIZE - (uint16_t) (head - ring->tail);
+
+    while (freeWords > 0)
+    {
+        uint16_t headIdx = head & ARINC_RX_RING_MASK;
+        uint16_t contiguousWords = ARINC_RX_RING_SIZE - headIdx;
+        if (contiguousWords > freeWords)
+        {
+            contiguousWords = freeWords;
+        }
+
+        uint16_t numWordsRead = (uint16_t) readFIFO( &(ring->words[headIdx]), contiguousWords );
+        const uint32_t drain_ticks = Timer23_GetTimestampFromInterrupt_ticks( );
+        uint16_t wordIdx;
+        for (wordIdx = headIdx; wordIdx < (headIdx + numWordsRead); wordIdx++)
+        {
+            ring->drain_ticks[wordIdx] = drain_ticks;
+        }
+        head += numWordsRead;
+        freeWords -= numWordsRead;
+        ring->head = head; /* Publish the words to the main loop */
+
+        if (numWordsRead < contiguousWords)
+        {
+            return; /* FIFO is empty */
+        }
+    }
+
+    /* Ring is full. Discard what is left in the FIFO, so the transceiver does not overflow uncounted */
+    uint32_t discardedWords[ARINC_RX_DISCARD_BURST];
+    uint16_t numWordsDiscarded;
+    do
+    {
+        numWordsDiscarded = (uint16_t) readFIFO( discardedWords, ARINC_RX_DISCARD_BURST );
+        const uint16_t droppedWordCount = ring->droppedWordCount;
+        ring->droppedWordCount = (numWordsDiscarded >= (uint16_t) (UINT16_MAX - droppedWordCount))
+                ? UINT16_MAX : (uint16_t) (droppedWordCount + numWordsDiscarded);
+    } while (ARINC_RX_DISCARD_BURST == numWordsDiscarded);
+    return;
+}
+#ArincRx_DrainFIFOToRing
+
+#ArincRx_ProcessRing
+/* Function: ArincRx_ProcessRing
+ * 
+ * Description: Decodes every raw word published to a ring into the input 
+ *      ARINC429_RxMsgArray, in contiguous segments, and then releases the
+ *      space back to the service interrupt. Each word is timestamped with 
+ *      its drain tick rather than the time it is decoded. Called from the 
+ *      main loop. 
+ * 
+ * Return: None (void)
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.3.001
+ */
+static void ArincRx_ProcessRing( ArincRxRing * const ring,
+                                 ARINC429_RxMsgArray * const ARINCMsgArray )
+{
+    uint16_t head = ring->head; /* Snapshot - words published after this are handled next pass */
+    uint16_t tail = ring->tail;
+
+    while (tail != head)
+    {
+        uint16_t tailIdx = tail & ARINC_RX_RING_MASK;
+        uint16_t contiguousWords = ARINC_RX_RING_SIZE - tailIdx;
+        if (contiguousWords > (uint16_t) (head - tail))
+        {
+            contiguousWords = (uint16_t) (head - tail);
+        }
+
+        ProcessDownloadedARINCWords( ARINCMsgArray, &(ring->words[tailIdx]), &(ring->drain_ticks[tailIdx]), contiguousWords );
+        tail += contiguousWords;
+        ring->tail = tail; /* Release the space to the service interrupt */
+    }
+    return;
+}
+#ArincRx_ProcessRing
+#endif
+
+
 /**************  Function Definition(s) ********************/
 #DownloadMessagesFromARINCtxvrArx2
 /* Function: DownloadMessagesFromARINCtxvrArx2
  * 
  * Return: None 
  * 
- * Description: Retrieves all messages from transceiver A FIFO and processes
+ * Description: Burst reads all messages from transceiver A FIFO, then processes
  *      every message into the input ARINC429_RxMsgArray. If a parity error
  *      is detected, discard the message. If a valid message is processed, 
  *      reset the arinc array's bus counts to zero.  
@@ -42,30 +227,11 @@ void DownloadMessagesFromARINCtxvrArx2( ARINC429_RxMsgArray * const ARINCMsgArra
         return;
     }
 
-    uint8_t numWordsProcessed = 0;
-    uint32_t thisARINCRxMsg;
-
-    while ((ARINC429_HI3584_TXVRA_DR2 == 0) && (numWordsProcessed < MAX_NUM_RX_MSGS))
-    {
-        thisARINCRxMsg = ARINC429_HI3584_txvrA_rx2_ReadWord( );
-      
-        if (thisARINCRxMsg & 0x80000000u)
-        {
-            ; // Parity error check 
-        }
-        
-        else if (ARINC429_READ_MSG_SUCCESS == ARINC429_ProcessReceivedMessage( ARINCMsgArray,
-                                                                          thisARINCRxMsg ))
-        {
-            ARINCMsgArray->currentCounts = 0;
-        }
-        else
-        {
-            ; // Nothing 
-        }
+    /* Drain the FIFO first, then decode the words */
+    uint32_t rxWords[MAX_NUM_RX_MSGS];
+    size_t numWordsRead = ARINC429_HI3584_txvrA_rx2_ReadFIFO( rxWords, MAX_NUM_RX_MSGS );
 
-        numWordsProcessed++;
-    }
+    ProcessDownloadedARINCWords( ARINCMsgArray, rxWords, NULL, numWordsRead );
     return;
 }
 #DownloadMessagesFromARINCtxvrArx2
@@ -94,7 +260,7 @@ bool ProcessARINCBusFailure( ARINC429_RxMsgArray * ARINCMsgArray )
 #DownloadMessagesFromARINCtxvrBrx2
 /* Function: DownloadMessagesFromARINCtxvrBrx2
  *
- * Description: Retrieves all messages from transceiver B FIFO and processes
+ * Description: Burst reads all messages from transceiver B FIFO, then processes
  *      every message into the input ARINC429_RxMsgArray. If a parity error
  *      is detected, discard the message. If a valid message is processed, 
  *      reset the arinc array's bus counts to zero.  
@@ -110,27 +276,11 @@ void DownloadMessagesFromARINCtxvrBrx2( ARINC429_RxMsgArray * const ARINCMsgArra
         return;
     }
 
-    uint8_t numWordsProcessed = 0;
-    uint32_t thisARINCRxMsg;
-    while ((ARINC429_HI3584_TXVRB_DR2 == 0) && (numWordsProcessed < MAX_NUM_RX_MSGS))
-    {
-        thisARINCRxMsg = ARINC429_HI3584_txvrB_rx2_ReadWord( );
+    /* Drain the FIFO first, then decode the words */
+    uint32_t rxWords[MAX_NUM_RX_MSGS];
+    size_t numWordsRead = ARINC429_HI3584_txvrB_rx2_ReadFIFO( rxWords, MAX_NUM_RX_MSGS );
 
-        if (thisARINCRxMsg & 0x80000000u)
-        {
-            ; // parity error 
-        }
-        else if (ARINC429_READ_MSG_SUCCESS == ARINC429_ProcessReceivedMessage( ARINCMsgArray,
-                                                                          thisARINCRxMsg ))
-        {
-            ARINCMsgArray->currentCounts = 0;
-        }
-        else
-        {
-            ;
-        }
-        numWordsProcessed++;
-    }
+    ProcessDownloadedARINCWords( ARINCMsgArray, rxWords, NULL, numWordsRead );
     return;
 }
 #DownloadMessagesFromARINCtxvrBrx2
@@ -159,29 +309,157 @@ void TransmitLatestARINCMsgIfValid( ARINC429_RxMsgArray * const rxMsgArray,
     {
         return;
     }
-    ARINC429_RxMsgData data;
+    const ARINC429_RxMsgData * data;
+    uint8_t rxFlags;
     const uint16_t hexFlippedLabel = FormatLabelNumber( octalStdLabel );
-    ARINC429_GetLabelDataReturnStatus readStatus = ARINC429_GetLatestLabelData( rxMsgArray,
-                                                                                hexFlippedLabel,
-                                                                                &data );
-    if ((true == data.isDataFresh) &&
-            (true == data.isNotBabbling) &&
+    ARINC429_GetLabelDataReturnStatus readStatus = ARINC429_GetLatestRawLabelData( rxMsgArray,
+                                                                                   hexFlippedLabel,
+                                                                                   &data,
+                                                                                   &rxFlags );
+    if (ARINC429_AreRxFlagsValid( rxFlags ) &&
             ARINC429_GET_LABEL_DATA_MSG_SUCCESS == readStatus)
     {
         switch (channel)
         {
             case A429_CHANNEL_A:
-                ARINC429_HI3584_txvrA_TransmitWord( data.rawARINCword );
+                ARINC429_HI3584_txvrA_TransmitWord( data->rawARINCword );
                 break;
             case A429_CHANNEL_B:
-                ARINC429_HI3584_txvrB_TransmitWord( data.rawARINCword );
+                ARINC429_HI3584_txvrB_TransmitWord( data->rawARINCword );
                 break;
             default:
                 break;
         }
+        ARINC_LATENCY_TRACE_TRANSMIT( (uint8_t) hexFlippedLabel, channel, data->sysTimeLastGoodMsg_ticks );
     }
     return;
 }
 #TransmitLatestARINCMsgIfValid
 
+#ifdef ARINC429_RX_INTERRUPT_DRIVEN
+#ArincRx_InitializeInterruptMode
+/* Function: ArincRx_InitializeInterruptMode
+ * 
+ * Description: Empties the raw word rings and starts Timer 5 as the periodic
+ *      ARINC receive service interrupt. Must be called after the boot time 
+ *      transceiver tests and label filter setup. From then on the main loop 
+ *      decodes received words with ProcessARINCRxRings instead of calling 
+ *      the DownloadMessagesFromARINCtxvr functions. 
+ * 
+ * Return: None (void)
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.3.001
+ */
+void ArincRx_InitializeInterruptMode( const uint16_t TMR5Config,
+                                      const uint16_t TMR5Period,
+                                      const uint16_t TMR5InterruptConfig )
+{
+    txvrArx2Ring.head = 0;
+    txvrArx2Ring.tail = 0;
+    txvrArx2Ring.droppedWordCount = 0;
+    txvrBrx2Ring.head = 0;
+    txvrBrx2Ring.tail = 0;
+    txvrBrx2Ring.droppedWordCount = 0;
+
+    TMR5 = 0;
+    PR5 = TMR5Period;
+    T5CON = TMR5Config;
+
+    IFS1bits.T5IF = 0;
+    IPC5bits.T5IP = TMR5InterruptConfig & 0x07;
+    IEC1bits.T5IE = (TMR5InterruptConfig & 0x08) >> 3;
+    return;
+}
+#ArincRx_InitializeInterruptMode
+
+#ArincRx_ServiceInterrupt
+/* Function: ArincRx_ServiceInterrupt
+ * 
+ * Description: Timer 5 interrupt. Drains the transceiver A and B receiver 2 
+ *      FIFOs into their rings when DR2 is asserted. Skipped if the main loop
+ *      was interrupted in the middle of a data bus transaction; the FIFOs 
+ *      are then drained on the next tick. 
+ * 
+ * Return: None (void)
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.3.001
+ */
+void ArincRx_ServiceInterrupt( void )
+{
+    IFS1bits.T5IF = 0;
+
+    if (false == ARINC429_HI3584_IsDataBusBusy( ))
+    {
+        if (0 == ARINC429_HI3584_TXVRA_DR2)
+        {
+            ArincRx_DrainFIFOToRing( &txvrArx2Ring, ARINC429_HI3584_txvrA_rx2_ReadFIFO );
+        }
+
+        if (0 == ARINC429_HI3584_TXVRB_DR2)
+        {
+            ArincRx_DrainFIFOToRing( &txvrBrx2Ring, ARINC429_HI3584_txvrB_rx2_ReadFIFO );
+        }
+    }
+    return;
+}
+#ArincRx_ServiceInterrupt
+
+#ProcessARINCRxRings
+/* Function: ProcessARINCRxRings
+ * 
+ * Description: Decodes all words received by the service interrupt since the
+ *      last call. Transceiver A receiver 2 words are processed into 
+ *      txvrAMsgArray and transceiver B receiver 2 words into txvrBMsgArray. 
+ * 
+ * Return: None (void)
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.3.001
+ */
+void ProcessARINCRxRings( ARINC429_RxMsgArray * const txvrAMsgArray,
+                          ARINC429_RxMsgArray * const txvrBMsgArray )
+{
+    if (NULL != txvrAMsgArray)
+    {
+        ArincRx_ProcessRing( &txvrArx2Ring, txvrAMsgArray );
+    }
+
+    if (NULL != txvrBMsgArray)
+    {
+        ArincRx_ProcessRing( &txvrBrx2Ring, txvrBMsgArray );
+    }
+    return;
+}
+#ProcessARINCRxRings
+
+#ArincRx_GetDroppedWordCount
+/* Function: ArincRx_GetDroppedWordCount
+ * 
+ * Description: Returns the number of words read from a transceiver's 
+ *      receiver 2 FIFO and discarded because its ring was full. Channel A is
+ *      transceiver A and channel B transceiver B. The count saturates. 
+ * 
+ * Return: Dropped word count, 0 for an invalid channel
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.3.001
+ */
+uint16_t ArincRx_GetDroppedWordCount( const ARINC429_TX_CHANNEL channel )
+{
+    uint16_t droppedWordCount = 0;
+
+    switch (channel)
+    {
+        case A429_CHANNEL_A:
+            droppedWordCount = txvrArx2Ring.droppedWordCount;
+            break;
+        case A429_CHANNEL_B:
+            droppedWordCount = txvrBrx2Ring.droppedWordCount;
+            break;
+        default:
+            break;
+    }
+    return droppedWordCount;
+}
+#ArincRx_GetDroppedWordCount
+#endif
+
 /* end ArincDownload.c source file*/
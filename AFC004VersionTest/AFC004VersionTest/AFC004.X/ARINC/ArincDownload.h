@@ -38,5 +38,29 @@ void TransmitLatestARINCMsgIfValid(ARINC429_RxMsgArray * const rxMsgArray,
 
 bool ProcessARINCBusFailure(ARINC429_RxMsgArray * ARINCMsgArray);
 
+#ifdef ARINC429_RX_INTERRUPT_DRIVEN
+/* Interrupt-driven receive mode. A periodic Timer 5 interrupt drains the transceiver A and B
+ * receiver 2 FIFOs into raw word rings. Transceiver A's DR2 (RD2) is not on a change 
+ * notification or external interrupt pin, so A has to be polled. Transceiver B's DR2 (RD6) is
+ * CN15, but it is polled by the same interrupt rather than given a second service path: the
+ * interrupt rate is then fixed instead of following the bus traffic, and at 0.5 ms a high 
+ * speed bus delivers at most 2 words between services, well inside the 32 word FIFO. 
+ * The main loop decodes the rings with ProcessARINCRxRings(). 
+ * auto_psv: the FIFO reads use the const data bus pin map, which is read through PSV, and
+ * the interrupted main loop may have PSVPAG pointing elsewhere. */
+#define ArincRx_ServiceInterrupt __attribute__((interrupt,auto_psv)) _T5Interrupt
+
+void ArincRx_ServiceInterrupt(void);
+
+void ArincRx_InitializeInterruptMode(const uint16_t TMR5Config,
+        const uint16_t TMR5Period,
+        const uint16_t TMR5InterruptConfig);
+
+void ProcessARINCRxRings(ARINC429_RxMsgArray * const txvrAMsgArray,
+        ARINC429_RxMsgArray * const txvrBMsgArray);
+
+uint16_t ArincRx_GetDroppedWordCount(const ARINC429_TX_CHANNEL channel);
+#endif
+
 #endif
 /* end ArincDownload.h header file */
\ No newline at end of file
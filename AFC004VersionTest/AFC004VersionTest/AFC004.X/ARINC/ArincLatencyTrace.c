@@ -0,0 +1,355 @@
+/*
+ * Filename: ArincLatencyTrace.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Optional ARINC429 latency tracer, built only when
+ *      ARINC429_LATENCY_TRACE is defined. Each label and channel pair gets an
+ *      accumulator on its first traced transmit, found again through a label
+ *      index, and every transmit adds its age-at-transmit to the pair's
+ *      count, min, max and sum. A transmit costs one timestamp, one index
+ *      lookup and one accumulator update, and no history is overwritten, so
+ *      the min/mean/max cover the whole run. All calls are made from the main
+ *      loop.
+ *
+ *      Maintenance mode is entered before the main loop starts the tracer, so
+ *      the accumulators are kept in persistent RAM, each with a check word,
+ *      and those of the previous boot are read out over UART2 after a reset
+ *      into maintenance mode.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include "ArincLatencyTrace.h"
+
+#ifdef ARINC429_LATENCY_TRACE
+#include "ARINC.h"
+#include "Timer23.h"
+
+
+/**************  Macro Definitions ***********************/
+#define ARINC_LATENCY_TRACE_NUM_CHANNELS 2u /* A429_CHANNEL_A and A429_CHANNEL_B */
+#define ARINC_LATENCY_TRACE_NO_LABEL 0xFFu /* Label index entry of a pair without an accumulator */
+#define ARINC_LATENCY_TRACE_CHECK_SEED 0x1A7Eu
+
+#if (ARINC_LATENCY_TRACE_MAX_LABELS >= ARINC_LATENCY_TRACE_NO_LABEL)
+#error "ARINC_LATENCY_TRACE_MAX_LABELS must be less than 255"
+#endif
+
+#ifdef __dsPIC30F__
+#define ARINC_LATENCY_TRACE_PERSISTENT __attribute__((persistent))
+#else
+#define ARINC_LATENCY_TRACE_PERSISTENT
+#endif
+
+
+/**************  Type Definitions ************************/
+/* Age-at-transmit (transmit tick - receive tick) of one label and channel, in Timer23 ticks (TMR23ScaleFactor ticks per ms) */
+typedef struct
+{
+    uint64_t sumAge_ticks;
+    uint32_t numTransmits; /* Saturates, after which the accumulator is no longer updated */
+    uint32_t minAge_ticks;
+    uint32_t maxAge_ticks;
+    uint8_t hexFlippedLabel;
+    uint8_t channel;
+    uint16_t checkWord;
+} ArincLatencyTraceLabel;
+
+
+/**************  Variable Definitions ********************/
+static ArincLatencyTraceLabel traceLabels[ARINC_LATENCY_TRACE_MAX_LABELS] ARINC_LATENCY_TRACE_PERSISTENT;
+static uint8_t numTraceLabels ARINC_LATENCY_TRACE_PERSISTENT; /* Accumulators in use */
+static uint8_t numTraceLabelsCheck ARINC_LATENCY_TRACE_PERSISTENT; /* Complement of numTraceLabels */
+
+/* Accumulator of each channel and hex-flipped label, ARINC_LATENCY_TRACE_NO_LABEL if none. Built as pairs are first traced. */
+static uint8_t traceLabelIndex[ARINC_LATENCY_TRACE_NUM_CHANNELS][ARINC429_NUM_LABELS];
+
+
+/**************  Static Function Prototypes *************/
+static uint16_t CalculateCheckWord( const ArincLatencyTraceLabel * const traceLabel );
+static uint16_t WriteUint64( uint8_t * const frame,
+                             const uint64_t value );
+static uint16_t WriteUint32( uint8_t * const frame,
+                             const uint32_t value );
+
+
+/**************  Function Definitions ********************/
+#ArincLatencyTrace_Initialize
+/* Function: ArincLatencyTrace_Initialize
+ *
+ * Description: Empties the accumulators and the label index. Called when the
+ *      main loop starts, after maintenance mode could have read out the
+ *      accumulators of the previous boot.
+ *
+ * Return: None (void)
+ */
+void ArincLatencyTrace_Initialize( void )
+{
+    uint16_t labelIdx;
+
+    for (labelIdx = 0; labelIdx < ARINC429_NUM_LABELS; labelIdx++)
+    {
+        traceLabelIndex[A429_CHANNEL_A][labelIdx] = ARINC_LATENCY_TRACE_NO_LABEL;
+        traceLabelIndex[A429_CHANNEL_B][labelIdx] = ARINC_LATENCY_TRACE_NO_LABEL;
+    }
+    numTraceLabels = 0;
+    numTraceLabelsCheck = (uint8_t) ~numTraceLabels;
+    return;
+}
+#ArincLatencyTrace_Initialize
+
+#ArincLatencyTrace_RecordTransmit
+/* Function: ArincLatencyTrace_RecordTransmit
+ *
+ * Description: Adds the age of the data carried by a transmit of a label,
+ *      timestamped now, to the label and channel's accumulator. The
+ *      accumulator is set up on the pair's first transmit, if one is free.
+ *
+ * Return: None (void)
+ */
+void ArincLatencyTrace_RecordTransmit( const uint8_t hexFlippedLabel,
+                                       const ARINC429_TX_CHANNEL channel,
+                                       const uint32_t rx_ticks ) /* Receive tick of the transmitted data */
+{
+    const uint32_t age_ticks = Timer23_GetTimestamp_ticks( ) - rx_ticks;
+
+    if ((uint16_t) channel >= ARINC_LATENCY_TRACE_NUM_CHANNELS)
+    {
+        return;
+    }
+
+    uint8_t traceIdx = traceLabelIndex[channel][hexFlippedLabel];
+    if (ARINC_LATENCY_TRACE_NO_LABEL == traceIdx)
+    {
+        if (numTraceLabels >= ARINC_LATENCY_TRACE_MAX_LABELS)
+        {
+            return; // No free accumulator. The pair is not traced.
+        }
+
+        traceIdx = numTraceLabels;
+        traceLabels[traceIdx].sumAge_ticks = 0;
+        traceLabels[traceIdx].numTransmits = 0;
+        traceLabels[traceIdx].minAge_ticks = UINT32_MAX;
+        traceLabels[traceIdx].maxAge_ticks = 0;
+        traceLabels[traceIdx].hexFlippedLabel = hexFlippedLabel;
+        traceLabels[traceIdx].channel = (uint8_t) channel;
+        traceLabelIndex[channel][hexFlippedLabel] = traceIdx;
+        numTraceLabels++;
+        numTraceLabelsCheck = (uint8_t) ~numTraceLabels;
+    }
+
+    ArincLatencyTraceLabel * const traceLabel = &traceLabels[traceIdx];
+    if (traceLabel->numTransmits < UINT32_MAX)
+    {
+        traceLabel->numTransmits++;
+        traceLabel->sumAge_ticks += age_ticks;
+        if (age_ticks < traceLabel->minAge_ticks)
+        {
+            traceLabel->minAge_ticks = age_ticks;
+        }
+        if (age_ticks > traceLabel->maxAge_ticks)
+        {
+            traceLabel->maxAge_ticks = age_ticks;
+        }
+        traceLabel->checkWord = CalculateCheckWord( traceLabel );
+    }
+    return;
+}
+#ArincLatencyTrace_RecordTransmit
+
+#ArincLatencyTrace_RecordComputedTransmit
+/* Function: ArincLatencyTrace_RecordComputedTransmit
+ *
+ * Description: Records a transmit of a computed word against the label in
+ *      its low byte, using the receive tick of the source label it was
+ *      computed from (its FIFO read tick, see ArincLatencyTrace.h). Nothing is recorded unless the source data is fresh,
+ *      matching the as-is transmits which only send fresh data.
+ *
+ * Return: None (void)
+ */
+void ArincLatencyTrace_RecordComputedTransmit( const uint32_t txWord,
+                                               const ARINC429_TX_CHANNEL channel,
+                                               const ARINC429_RxMsgArray * const rxMsgArray, /* Array holding the source label */
+                                               const uint16_t octalSourceLabel ) /* Standard format label the word was computed from */
+{
+    const ARINC429_RxMsgData * sourceData;
+    uint8_t sourceFlags;
+
+    if (NULL == rxMsgArray)
+    {
+        return;
+    }
+
+    ARINC429_GetLabelDataReturnStatus readStatus = ARINC429_GetLatestRawLabelData( rxMsgArray,
+                                                                                   FormatLabelNumber( octalSourceLabel ),
+                                                                                   &sourceData,
+                                                                                   &sourceFlags );
+    if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == readStatus) &&
+            (0u != (ARINC429_RX_FLAG_FRESH & sourceFlags)))
+    {
+        ArincLatencyTrace_RecordTransmit( (uint8_t) (txWord & 0xFFu), channel, sourceData->sysTimeLastGoodMsg_ticks );
+    }
+    return;
+}
+#ArincLatencyTrace_RecordComputedTransmit
+
+#ArincLatencyTrace_GetNumLabels
+/* Function: ArincLatencyTrace_GetNumLabels
+ *
+ * Description: Reports how many label and channel pairs have an accumulator,
+ *      i.e. were traced since the tracer was last started.
+ *
+ * Return: Number of accumulators in use, 0 if the count is not valid
+ */
+uint8_t ArincLatencyTrace_GetNumLabels( void )
+{
+    if ((numTraceLabelsCheck != (uint8_t) ~numTraceLabels) ||
+            (numTraceLabels > ARINC_LATENCY_TRACE_MAX_LABELS))
+    {
+        return 0; // Random contents of persistent RAM after a power up
+    }
+    return numTraceLabels;
+}
+#ArincLatencyTrace_GetNumLabels
+
+#ArincLatencyTrace_SerializeRecord
+/* Function: ArincLatencyTrace_SerializeRecord
+ *
+ * Description: Writes up to ARINC_LATENCY_TRACE_LABELS_PER_FRAME accumulators,
+ *      starting at firstLabelIdx, to a frame for transmission, multi-byte
+ *      values MSB first:
+ *          ARINC_LATENCY_TRACE_FRAME_HEADER
+ *          Index of the first accumulator in the record
+ *          Number of accumulators in use
+ *          Number of accumulators in the record
+ *          Per accumulator:
+ *              Hex-flipped label, as in the word's low byte
+ *              Channel
+ *              1 if the accumulator is valid, 0 if not
+ *              Transmits, 4 bytes
+ *              Min and max age-at-transmit in Timer23 ticks, 4 bytes each
+ *              Sum of the ages in Timer23 ticks, 8 bytes
+ *
+ * Return: Number of bytes written, 0 if the frame is too small
+ */
+uint16_t ArincLatencyTrace_SerializeRecord( const uint8_t firstLabelIdx, /* Accumulator the record starts at */
+                                            uint8_t * const frame, /* Buffer for the serialized record */
+                                            const uint16_t frameSize ) /* Size of the buffer */
+{
+    const uint8_t numLabels = ArincLatencyTrace_GetNumLabels( );
+    uint8_t numLabelsInFrame = 0;
+    uint16_t frameIdx = 0;
+
+    if ((NULL == frame) || (frameSize < ARINC_LATENCY_TRACE_FRAME_SIZE))
+    {
+        return 0;
+    }
+
+    if (firstLabelIdx < numLabels)
+    {
+        numLabelsInFrame = numLabels - firstLabelIdx;
+        if (numLabelsInFrame > ARINC_LATENCY_TRACE_LABELS_PER_FRAME)
+        {
+            numLabelsInFrame = ARINC_LATENCY_TRACE_LABELS_PER_FRAME;
+        }
+    }
+
+    frame[frameIdx++] = ARINC_LATENCY_TRACE_FRAME_HEADER;
+    frame[frameIdx++] = firstLabelIdx;
+    frame[frameIdx++] = numLabels;
+    frame[frameIdx++] = numLabelsInFrame;
+
+    uint8_t labelIdx;
+    for (labelIdx = firstLabelIdx; labelIdx < (firstLabelIdx + numLabelsInFrame); labelIdx++)
+    {
+        const ArincLatencyTraceLabel * const traceLabel = &traceLabels[labelIdx];
+
+        frame[frameIdx++] = traceLabel->hexFlippedLabel;
+        frame[frameIdx++] = traceLabel->channel;
+        frame[frameIdx++] = (CalculateCheckWord( traceLabel ) == traceLabel->checkWord) ? 1u : 0u;
+        frameIdx += WriteUint32( &frame[frameIdx], traceLabel->numTransmits );
+        frameIdx += WriteUint32( &frame[frameIdx], traceLabel->minAge_ticks );
+        frameIdx += WriteUint32( &frame[frameIdx], traceLabel->maxAge_ticks );
+        frameIdx += WriteUint64( &frame[frameIdx], traceLabel->sumAge_ticks );
+    }
+    return frameIdx;
+}
+#ArincLatencyTrace_SerializeRecord
+
+/**************  Static Function Definitions *************/
+#CalculateCheckWord
+/* Function: CalculateCheckWord
+ *
+ * Description: XORs the 16 bit parts of an accumulator's fields into a
+ *      seeded, rotated check word.
+ *
+ * Return: Check word of the accumulator
+ */
+static uint16_t CalculateCheckWord( const ArincLatencyTraceLabel * const traceLabel )
+{
+    const uint16_t fields[] = {
+        (uint16_t) (traceLabel->sumAge_ticks >> 48),
+        (uint16_t) (traceLabel->sumAge_ticks >> 32),
+        (uint16_t) (traceLabel->sumAge_ticks >> 16),
+        (uint16_t) traceLabel->sumAge_ticks,
+        (uint16_t) (traceLabel->numTransmits >> 16),
+        (uint16_t) traceLabel->numTransmits,
+        (uint16_t) (traceLabel->minAge_ticks >> 16),
+        (uint16_t) traceLabel->minAge_ticks,
+        (uint16_t) (traceLabel->maxAge_ticks >> 16),
+        (uint16_t) traceLabel->maxAge_ticks,
+        (uint16_t) (((uint16_t) traceLabel->channel << 8) | traceLabel->hexFlippedLabel)
+    };
+    uint16_t checkWord = ARINC_LATENCY_TRACE_CHECK_SEED;
+    uint8_t idx;
+
+    for (idx = 0; idx < (sizeof (fields) / sizeof (fields[0])); idx++)
+    {
+        checkWord ^= fields[idx];
+        checkWord = (uint16_t) ((checkWord << 1) | (checkWord >> 15));
+    }
+    return checkWord;
+}
+#CalculateCheckWord
+
+#WriteUint64
+/* Function: WriteUint64
+ *
+ * Description: Writes a 64 bit value to a frame, MSB first.
+ *
+ * Return: Number of bytes written
+ */
+static uint16_t WriteUint64( uint8_t * const frame,
+                             const uint64_t value )
+{
+    (void) WriteUint32( &frame[0], (uint32_t) (value >> 32) );
+    (void) WriteUint32( &frame[4], (uint32_t) value );
+    return 8u;
+}
+#WriteUint64
+
+#WriteUint32
+/* Function: WriteUint32
+ *
+ * Description: Writes a 32 bit value to a frame, MSB first.
+ *
+ * Return: Number of bytes written
+ */
+static uint16_t WriteUint32( uint8_t * const frame,
+                             const uint32_t value )
+{
+    frame[0] = (uint8_t) (value >> 24);
+    frame[1] = (uint8_t) (value >> 16);
+    frame[2] = (uint8_t) (value >> 8);
+    frame[3] = (uint8_t) value;
+    return 4u;
+}
+#WriteUint32
+
+#endif
+/* End of ArincLatencyTrace.c source file */
@@ -0,0 +1,79 @@
+/*
+ * Filename: ArincLatencyTrace.h
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: External interface for the optional ARINC429 latency tracer.
+ *      Built only when ARINC429_LATENCY_TRACE is defined. Every traced
+ *      transmit adds the label's age-at-transmit (transmit tick - receive
+ *      tick) to running count/min/max/sum accumulators of its label and
+ *      channel, kept for the whole run and read out in maintenance mode.
+ *      Without ARINC429_LATENCY_TRACE the hook macros expand to nothing.
+ *
+ *      The receive tick is the rxMsg's sysTimeLastGoodMsg_ticks, i.e. when
+ *      the word was read from the transceiver FIFO, not when it came off the
+ *      bus. In ARINC429_RX_INTERRUPT_DRIVEN mode this is the tick at which
+ *      the service interrupt drained the word into its receive ring, kept
+ *      alongside the word, not the later main loop decode.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+#ifndef ARINC_LATENCY_TRACE_H
+#define ARINC_LATENCY_TRACE_H
+
+/**************  Included Files **************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "ARINC_typedefs.h"
+#include "ArincDownload.h"
+
+
+#ifdef ARINC429_LATENCY_TRACE
+/**************  Macro Definitions ***********************/
+#ifndef ARINC_LATENCY_TRACE_MAX_LABELS
+#define ARINC_LATENCY_TRACE_MAX_LABELS 48u /* Label and channel pairs traced. Transmits of any further pairs are not traced. */
+#endif
+
+#define ARINC_LATENCY_TRACE_FRAME_HEADER 0xA0u /* First byte of a serialized latency trace record */
+#define ARINC_LATENCY_TRACE_LABELS_PER_FRAME 4u /* Label accumulators per serialized record */
+#define ARINC_LATENCY_TRACE_LABEL_SIZE (3u + (4u * 3u) + 8u) /* Serialized bytes per label accumulator */
+#define ARINC_LATENCY_TRACE_FRAME_SIZE (4u + (ARINC_LATENCY_TRACE_LABELS_PER_FRAME * ARINC_LATENCY_TRACE_LABEL_SIZE))
+
+/* Transmit of a received word, re-sent as-is */
+#define ARINC_LATENCY_TRACE_TRANSMIT(hexFlippedLabel, channel, rx_ticks) \
+    ArincLatencyTrace_RecordTransmit( (hexFlippedLabel), (channel), (rx_ticks) )
+
+/* Transmit of a word computed from the latest data of a received source label */
+#define ARINC_LATENCY_TRACE_COMPUTED_TRANSMIT(txWord, channel, rxMsgArray, octalSourceLabel) \
+    ArincLatencyTrace_RecordComputedTransmit( (txWord), (channel), (rxMsgArray), (octalSourceLabel) )
+
+
+/**************  Function Prototypes *********************/
+void ArincLatencyTrace_Initialize(void);
+
+void ArincLatencyTrace_RecordTransmit(const uint8_t hexFlippedLabel,
+        const ARINC429_TX_CHANNEL channel,
+        const uint32_t rx_ticks); /* Receive tick of the transmitted data */
+
+void ArincLatencyTrace_RecordComputedTransmit(const uint32_t txWord,
+        const ARINC429_TX_CHANNEL channel,
+        const ARINC429_RxMsgArray * const rxMsgArray, /* Array holding the source label */
+        const uint16_t octalSourceLabel); /* Standard format label the word was computed from */
+
+uint8_t ArincLatencyTrace_GetNumLabels(void);
+
+uint16_t ArincLatencyTrace_SerializeRecord(const uint8_t firstLabelIdx, /* Accumulator the record starts at */
+        uint8_t * const frame, /* Buffer for the serialized record */
+        const uint16_t frameSize); /* Size of the buffer */
+
+#else
+#define ARINC_LATENCY_TRACE_TRANSMIT(hexFlippedLabel, channel, rx_ticks)
+#define ARINC_LATENCY_TRACE_COMPUTED_TRANSMIT(txWord, channel, rxMsgArray, octalSourceLabel)
+#endif
+
+
+#endif
+/* End of ArincLatencyTrace.h header file*/
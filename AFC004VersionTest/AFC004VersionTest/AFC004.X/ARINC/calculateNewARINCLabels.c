@@ -149,6 +149,26 @@ static const ARINC429_LabelConfig arincLabel235Config = {
     .numSigDigits = 5,
 };
 
+/* Fixed-point codecs of the transmitted BNR and BCD words. Precomputed from their configurations by SetupTransmitLabelCodecs(). */
+static ARINC429_LabelCodec arincLabel250Codec;
+static ARINC429_LabelCodec arincLabel340Codec;
+static ARINC429_LabelCodec arincLabel332Codec;
+static ARINC429_LabelCodec Eclipse_ARINCLabel320Codec;
+static ARINC429_LabelCodec Eclipse_ARINCLabel324Codec;
+static ARINC429_LabelCodec Eclipse_ARINClabel325Codec;
+static ARINC429_LabelCodec Eclipse_ARINClabel333Codec;
+static ARINC429_LabelCodec arincLabel235Codec;
+
+/* Codecs the transmitted words are encoded with. Left NULL, so the word is encoded in floating point, if its codec could not be set up. */
+static const ARINC429_LabelCodec * arincLabel250TxCodec = NULL;
+static const ARINC429_LabelCodec * arincLabel340TxCodec = NULL;
+static const ARINC429_LabelCodec * arincLabel332TxCodec = NULL;
+static const ARINC429_LabelCodec * Eclipse_ARINCLabel320TxCodec = NULL;
+static const ARINC429_LabelCodec * Eclipse_ARINCLabel324TxCodec = NULL;
+static const ARINC429_LabelCodec * Eclipse_ARINClabel325TxCodec = NULL;
+static const ARINC429_LabelCodec * Eclipse_ARINClabel333TxCodec = NULL;
+static const ARINC429_LabelCodec * arincLabel235TxCodec = NULL;
+
 /********************************** Filter setups **************************************/
 static IIRDiff_Filter magHeadingIIRDiff;
 static sIIR_struct accelerationZFilter;
@@ -199,6 +219,56 @@ void SetupNormAccelIIRFilter( const float k1,
 }
 #SetupNormAccelIIRFilter
 
+#SetupTransmitLabelCodec
+/* Function: SetupTransmitLabelCodec
+ *
+ * Description: Precomputes the fixed-point codec of one transmitted label.
+ * 
+ * Return: The codec if it was set up, NULL otherwise 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.015
+ */
+static const ARINC429_LabelCodec * SetupTransmitLabelCodec( const ARINC429_LabelConfig * const lblCfg,
+                                                            ARINC429_LabelCodec * const codec )
+{
+    return (EXIT_SUCCESS == ARINC429_InitializeLabelCodec( lblCfg, codec )) ? codec : NULL;
+}
+#SetupTransmitLabelCodec
+
+#SetupTransmitLabelCodecs
+/* Function: SetupTransmitLabelCodecs
+ *
+ * Description: Precomputes the fixed-point codecs of the transmitted BNR and
+ *      BCD words from their label configurations, so they are encoded 
+ *      without floating point division. A word whose codec cannot be set up
+ *      is left without one and is encoded in floating point. 
+ * 
+ * Return: true if every codec was set up, false otherwise 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.4.015
+ */
+bool SetupTransmitLabelCodecs( void )
+{
+    arincLabel250TxCodec = SetupTransmitLabelCodec( &arincLabel250Config, &arincLabel250Codec );
+    arincLabel340TxCodec = SetupTransmitLabelCodec( &arincLabel340Config, &arincLabel340Codec );
+    arincLabel332TxCodec = SetupTransmitLabelCodec( &arincLabel332Config, &arincLabel332Codec );
+    Eclipse_ARINCLabel320TxCodec = SetupTransmitLabelCodec( &Eclipse_ARINCLabel320Config, &Eclipse_ARINCLabel320Codec );
+    Eclipse_ARINCLabel324TxCodec = SetupTransmitLabelCodec( &Eclipse_ARINCLabel324Config, &Eclipse_ARINCLabel324Codec );
+    Eclipse_ARINClabel325TxCodec = SetupTransmitLabelCodec( &Eclipse_ARINClabel325Config, &Eclipse_ARINClabel325Codec );
+    Eclipse_ARINClabel333TxCodec = SetupTransmitLabelCodec( &Eclipse_ARINClabel333Config, &Eclipse_ARINClabel333Codec );
+    arincLabel235TxCodec = SetupTransmitLabelCodec( &arincLabel235Config, &arincLabel235Codec );
+
+    return ((NULL != arincLabel250TxCodec) &&
+            (NULL != arincLabel340TxCodec) &&
+            (NULL != arincLabel332TxCodec) &&
+            (NULL != Eclipse_ARINCLabel320TxCodec) &&
+            (NULL != Eclipse_ARINCLabel324TxCodec) &&
+            (NULL != Eclipse_ARINClabel325TxCodec) &&
+            (NULL != Eclipse_ARINClabel333TxCodec) &&
+            (NULL != arincLabel235TxCodec));
+}
+#SetupTransmitLabelCodecs
+
 #CalculateSlipAngle
 /* Function: CalculateSlipAngle
  * 
@@ -215,35 +285,37 @@ uint32_t CalculateSlipAngle( const ARINC429_RxMsgArray * const rxMsgArray )
         return 0;
     }
 
-    ARINC429_RxMsgData ayData;
-    ARINC429_GetLabelDataReturnStatus readStatusAY = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 332 ), &ayData );
-    ARINC429_RxMsgData azData;
-    ARINC429_GetLabelDataReturnStatus readStatusAZ = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 333 ), &azData );
+    const ARINC429_RxMsgData * ayData;
+    uint8_t ayFlags;
+    ARINC429_GetLabelDataReturnStatus readStatusAY = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 332 ), &ayData, &ayFlags );
+    const ARINC429_RxMsgData * azData;
+    uint8_t azFlags;
+    ARINC429_GetLabelDataReturnStatus readStatusAZ = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 333 ), &azData, &azFlags );
     uint32_t slipAngleWord;
 
     /* Compose ARINC429 Msg */
     ARINC429_TxMsg txMsgSlipAngle;
     txMsgSlipAngle.msgConfig = &arincLabel250Config;
-    txMsgSlipAngle.SDI = azData.SDI; // which one should set? Should they be checked to be equal ?
+    txMsgSlipAngle.codec = arincLabel250TxCodec;
+    txMsgSlipAngle.SDI = azData->SDI; // which one should set? Should they be checked to be equal ?
     float slipAngleInDegrees;
     float filteredAZ;
 
     /* Set validation of Ay. It doesn't need the filter's validation. */
     bool isAYdataValid = ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == readStatusAY) &&
-            ayData.isDataFresh && ayData.isNotBabbling &&
-            (ARINC429_SSM_BNR_NORMAL_OPERATION == ayData.SM));
+            ARINC429_AreRxFlagsValid( ayFlags ) &&
+            (ARINC429_SSM_BNR_NORMAL_OPERATION == ayData->SM));
 
     /* Validate AZ*/
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == readStatusAZ) &&
-        azData.isDataFresh &&
-        azData.isNotBabbling &&
-        (ARINC429_SSM_BNR_NORMAL_OPERATION == azData.SM))
+        ARINC429_AreRxFlagsValid( azFlags ) &&
+        (ARINC429_SSM_BNR_NORMAL_OPERATION == azData->SM))
     {
         if (isIIRSlipFilterGood)
         {
-            filteredAZ = f32_IIRFilter( azData.engDataFloat, &accelerationZFilter );
-            slipAngleInDegrees = radToDeg( f32_ArcTan2( -ayData.engDataFloat, (filteredAZ + 1.0f) ) );
-            txMsgSlipAngle.SM = ARINC429_CheckValidityOfARINC_BNR_Data( slipAngleInDegrees, &arincLabel250Config );
+            filteredAZ = f32_IIRFilter( azData->engDataFloat, &accelerationZFilter );
+            slipAngleInDegrees = radToDeg( f32_ArcTan2( -ayData->engDataFloat, (filteredAZ + 1.0f) ) );
+            txMsgSlipAngle.SM = ARINC429_CheckValidityOfARINC_BNR_Data( slipAngleInDegrees, &arincLabel250Config, arincLabel250TxCodec );
         }
 
         else
@@ -254,13 +326,13 @@ uint32_t CalculateSlipAngle( const ARINC429_RxMsgArray * const rxMsgArray )
             if (0 == iirFilterGoodCount)
             {
                 v_IIRReset( &accelerationZFilter );
-                v_IIRPreload( azData.engDataFloat, &accelerationZFilter );
+                v_IIRPreload( azData->engDataFloat, &accelerationZFilter );
                 slipAngleInDegrees = 0;
             }
             else
             {
-                filteredAZ = f32_IIRFilter( azData.engDataFloat, &accelerationZFilter );
-                slipAngleInDegrees = radToDeg( f32_ArcTan2( -ayData.engDataFloat, (filteredAZ + 1.0f) ) );
+                filteredAZ = f32_IIRFilter( azData->engDataFloat, &accelerationZFilter );
+                slipAngleInDegrees = radToDeg( f32_ArcTan2( -ayData->engDataFloat, (filteredAZ + 1.0f) ) );
             }
             iirFilterGoodCount++;
 
@@ -310,22 +382,22 @@ uint32_t CalculateTurnRate( const ARINC429_RxMsgArray * const rxMsgArray )
         return 0;
     }
 
-    ARINC429_RxMsgData magHeadingData;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 320 ), &magHeadingData );
+    const ARINC429_RxMsgData * magHeadingData;
+    uint8_t magHeadingFlags;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 320 ), &magHeadingData, &magHeadingFlags );
     uint32_t turnRateWord;
 
     /* Compose ARINC429 Msg */
     ARINC429_TxMsg txMsgTurnRate;
     float turnRate_dps;
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-        magHeadingData.isDataFresh &&
-        magHeadingData.isNotBabbling &&
-        (ARINC429_SSM_BNR_NORMAL_OPERATION == magHeadingData.SM))
+        ARINC429_AreRxFlagsValid( magHeadingFlags ) &&
+        (ARINC429_SSM_BNR_NORMAL_OPERATION == magHeadingData->SM))
     {
         if (isIIRDiffGood)
         {
-            turnRate_dps = IIR_Differentiator_Limited( magHeadingData.engDataFloat, &magHeadingIIRDiff ); // degrees per second 
-            txMsgTurnRate.SM = ARINC429_CheckValidityOfARINC_BNR_Data( turnRate_dps, &arincLabel340Config );
+            turnRate_dps = IIR_Differentiator_Limited( magHeadingData->engDataFloat, &magHeadingIIRDiff ); // degrees per second 
+            txMsgTurnRate.SM = ARINC429_CheckValidityOfARINC_BNR_Data( turnRate_dps, &arincLabel340Config, arincLabel340TxCodec );
         }
         else
         {
@@ -334,13 +406,13 @@ uint32_t CalculateTurnRate( const ARINC429_RxMsgArray * const rxMsgArray )
             if (0 == iirDiffGoodCount)
             {
                 IIRDifferentiatorReset( &magHeadingIIRDiff );
-                IIRDifferentiatorPreload( magHeadingData.engDataFloat, /* value to be loaded into past input */
+                IIRDifferentiatorPreload( magHeadingData->engDataFloat, /* value to be loaded into past input */
                                           &magHeadingIIRDiff ); /* pointer to the IIR differentiator struct */
                 turnRate_dps = 0.0f;
             }
             else
             {
-                turnRate_dps = IIR_Differentiator_Limited( magHeadingData.engDataFloat, &magHeadingIIRDiff ); // degrees per second 
+                turnRate_dps = IIR_Differentiator_Limited( magHeadingData->engDataFloat, &magHeadingIIRDiff ); // degrees per second 
             }
 
             iirDiffGoodCount++;
@@ -362,7 +434,8 @@ uint32_t CalculateTurnRate( const ARINC429_RxMsgArray * const rxMsgArray )
     }
 
     txMsgTurnRate.msgConfig = &arincLabel340Config;
-    txMsgTurnRate.SDI = magHeadingData.SDI;
+    txMsgTurnRate.codec = arincLabel340TxCodec;
+    txMsgTurnRate.SDI = magHeadingData->SDI;
     txMsgTurnRate.engData = turnRate_dps;
     ARINC429_AssembleStdBNRmessage( &txMsgTurnRate,
                                     &turnRateWord );
@@ -388,30 +461,31 @@ uint32_t CalculateNewMagneticHeadingARINCWord( const ARINC429_RxMsgArray * const
         return 0;
     }
 
-    ARINC429_RxMsgData magHeadingData;
-    ARINC429_GetLabelDataReturnStatus magHeadReadStatus = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 320 ), &magHeadingData );
-    ARINC429_RxMsgData lbl271Data;
-    ARINC429_GetLabelDataReturnStatus lbl271ReadStatus = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data );
+    const ARINC429_RxMsgData * magHeadingData;
+    uint8_t magHeadingFlags;
+    ARINC429_GetLabelDataReturnStatus magHeadReadStatus = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 320 ), &magHeadingData, &magHeadingFlags );
+    const ARINC429_RxMsgData * lbl271Data;
+    uint8_t lbl271Flags;
+    ARINC429_GetLabelDataReturnStatus lbl271ReadStatus = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data, &lbl271Flags );
     uint32_t magHeadingWord;
 
     ARINC429_TxMsg txMsgMagHeading;
     txMsgMagHeading.msgConfig = &Eclipse_ARINCLabel320Config;
-    txMsgMagHeading.SDI = magHeadingData.SDI;
-    txMsgMagHeading.engData = magHeadingData.engDataFloat;
+    txMsgMagHeading.codec = Eclipse_ARINCLabel320TxCodec;
+    txMsgMagHeading.SDI = magHeadingData->SDI;
+    txMsgMagHeading.engData = magHeadingData->engDataFloat;
 
     /* If both the magnetic heading data and 271 data are valid, set the SM based on received magnetic heading */
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == magHeadReadStatus) &&
-        magHeadingData.isDataFresh &&
-        magHeadingData.isNotBabbling &&
-        //       (ARINC429_SSM_BNR_NORMAL_OPERATION == magHeadingData.SM) &&
+        ARINC429_AreRxFlagsValid( magHeadingFlags ) &&
+        //       (ARINC429_SSM_BNR_NORMAL_OPERATION == magHeadingData->SM) &&
         (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == lbl271ReadStatus) &&
-        lbl271Data.isDataFresh &&
-        lbl271Data.isNotBabbling &&
-        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data.SM))
+        ARINC429_AreRxFlagsValid( lbl271Flags ) &&
+        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data->SM))
     {
         /* TEST THIS: Set the mag heading message to fail if the MSU has failed, determined from label 271. */
-        txMsgMagHeading.SM = (lbl271Data.rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
-                ? ARINC429_SSM_BNR_FAILURE_WARNING : magHeadingData.SM;
+        txMsgMagHeading.SM = (lbl271Data->rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
+                ? ARINC429_SSM_BNR_FAILURE_WARNING : magHeadingData->SM;
     }
     else
     {
@@ -442,21 +516,22 @@ uint32_t CalculateNewPitchAngleARINCWord( const ARINC429_RxMsgArray * const rxMs
         return 0;
     }
 
-    ARINC429_RxMsgData pitchData;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 324 ), &pitchData );
+    const ARINC429_RxMsgData * pitchData;
+    uint8_t pitchFlags;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 324 ), &pitchData, &pitchFlags );
 
     ARINC429_TxMsg txMsgPitchAngle;
     txMsgPitchAngle.msgConfig = &Eclipse_ARINCLabel324Config;
-    txMsgPitchAngle.SDI = pitchData.SDI;
-    txMsgPitchAngle.engData = pitchData.engDataFloat;
+    txMsgPitchAngle.codec = Eclipse_ARINCLabel324TxCodec;
+    txMsgPitchAngle.SDI = pitchData->SDI;
+    txMsgPitchAngle.engData = pitchData->engDataFloat;
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-        pitchData.isDataFresh &&
-        pitchData.isNotBabbling)
+        ARINC429_AreRxFlagsValid( pitchFlags ))
     {
         /* Compose ARINC429 Msg. PITCH_ANGLE eng data is already calculated */
 
-        txMsgPitchAngle.SM = pitchData.SM;
+        txMsgPitchAngle.SM = pitchData->SM;
     }
     else
     {
@@ -488,20 +563,21 @@ uint32_t CalculateNewRollAngleARINCWord( const ARINC429_RxMsgArray * const rxMsg
         return 0;
     }
 
-    ARINC429_RxMsgData rollData;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 325 ), &rollData );
+    const ARINC429_RxMsgData * rollData;
+    uint8_t rollFlags;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 325 ), &rollData, &rollFlags );
     uint32_t rollAngleARINCWord;
 
     ARINC429_TxMsg txMsgRollAngle;
     txMsgRollAngle.msgConfig = &Eclipse_ARINClabel325Config;
-    txMsgRollAngle.SDI = rollData.SDI;
-    txMsgRollAngle.engData = rollData.engDataFloat;
+    txMsgRollAngle.codec = Eclipse_ARINClabel325TxCodec;
+    txMsgRollAngle.SDI = rollData->SDI;
+    txMsgRollAngle.engData = rollData->engDataFloat;
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-        rollData.isDataFresh &&
-        rollData.isNotBabbling)
+        ARINC429_AreRxFlagsValid( rollFlags ))
     {
-        txMsgRollAngle.SM = rollData.SM;
+        txMsgRollAngle.SM = rollData->SM;
     }
 
     else
@@ -532,21 +608,22 @@ uint32_t CalculateNewBodyLateralAccelARINCWord( const ARINC429_RxMsgArray * cons
         return 0;
     }
 
-    ARINC429_RxMsgData bodyLatAccelData;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 332 ), &bodyLatAccelData );
+    const ARINC429_RxMsgData * bodyLatAccelData;
+    uint8_t bodyLatAccelFlags;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 332 ), &bodyLatAccelData, &bodyLatAccelFlags );
     uint32_t bodyLatAccARINCWord;
 
     ARINC429_TxMsg txMsgbodyLatAcc;
     txMsgbodyLatAcc.msgConfig = &arincLabel332Config;
-    txMsgbodyLatAcc.SDI = bodyLatAccelData.SDI;
-    txMsgbodyLatAcc.engData = -(bodyLatAccelData.engDataFloat);
+    txMsgbodyLatAcc.codec = arincLabel332TxCodec;
+    txMsgbodyLatAcc.SDI = bodyLatAccelData->SDI;
+    txMsgbodyLatAcc.engData = -(bodyLatAccelData->engDataFloat);
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-        bodyLatAccelData.isDataFresh &&
-        bodyLatAccelData.isNotBabbling)
+        ARINC429_AreRxFlagsValid( bodyLatAccelFlags ))
     {
 
-        txMsgbodyLatAcc.SM = bodyLatAccelData.SM;
+        txMsgbodyLatAcc.SM = bodyLatAccelData->SM;
     }
     else
     {
@@ -577,28 +654,29 @@ uint32_t CalculateNewNormalAccelerationARINCWord( const ARINC429_RxMsgArray * co
         return 0;
     }
 
-    ARINC429_RxMsgData bodyNormAccelData;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 333 ), &bodyNormAccelData );
+    const ARINC429_RxMsgData * bodyNormAccelData;
+    uint8_t bodyNormAccelFlags;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 333 ), &bodyNormAccelData, &bodyNormAccelFlags );
     uint32_t az;
 
     ARINC429_TxMsg txMsgNormAcc;
     txMsgNormAcc.msgConfig = &Eclipse_ARINClabel333Config;
-    txMsgNormAcc.SDI = bodyNormAccelData.SDI;
-    float azOffset = bodyNormAccelData.engDataFloat + 1.0f; // needed to add 1 g instead of minus. 
+    txMsgNormAcc.codec = Eclipse_ARINClabel333TxCodec;
+    txMsgNormAcc.SDI = bodyNormAccelData->SDI;
+    float azOffset = bodyNormAccelData->engDataFloat + 1.0f; // needed to add 1 g instead of minus. 
     txMsgNormAcc.engData = azOffset;
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-        bodyNormAccelData.isDataFresh &&
-        bodyNormAccelData.isNotBabbling)
+        ARINC429_AreRxFlagsValid( bodyNormAccelFlags ))
     {
         // If true, check if the message is valid in the first place.
-        if (ARINC429_SSM_BNR_NORMAL_OPERATION == bodyNormAccelData.SM)
+        if (ARINC429_SSM_BNR_NORMAL_OPERATION == bodyNormAccelData->SM)
         {
-            txMsgNormAcc.SM = ARINC429_CheckValidityOfARINC_BNR_Data( azOffset, &Eclipse_ARINClabel333Config );
+            txMsgNormAcc.SM = ARINC429_CheckValidityOfARINC_BNR_Data( azOffset, &Eclipse_ARINClabel333Config, Eclipse_ARINClabel333TxCodec );
         }
         else
         {
-            txMsgNormAcc.SM = bodyNormAccelData.SM;
+            txMsgNormAcc.SM = bodyNormAccelData->SM;
         }
     }
     else
@@ -631,24 +709,24 @@ uint32_t CalculateARINCLabel272( const ARINC429_RxMsgArray * const rxMsgArray,
         return 0;
     }
 
-    ARINC429_RxMsgData lbl271Data;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data );
+    const ARINC429_RxMsgData * lbl271Data;
+    uint8_t lbl271Flags;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data, &lbl271Flags );
 
     uint32_t label272ARINCWord = 0x0000005D;
 
-    if (lbl271Data.isDataFresh &&
-        lbl271Data.isNotBabbling &&
+    if (ARINC429_AreRxFlagsValid( lbl271Flags ) &&
         (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data.SM))
+        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data->SM))
     {
-        label272ARINCWord |= (lbl271Data.rawARINCword & AHRS_STATUS_SDI_SSM_MASK); // Set 272 to the same SSM and SDI as 271
+        label272ARINCWord |= (lbl271Data->rawARINCword & AHRS_STATUS_SDI_SSM_MASK); // Set 272 to the same SSM and SDI as 271
         /* If the ADC has timed out, set bit 25 (starting from 0) to 1. */
         if (hasADCTimedOut)
         {
             label272ARINCWord |= AHRS_272_BIT_25_SET;
         }
         /* If MSU fail (271-bit11), set 272's bits 10 and 11 */
-        if (lbl271Data.rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
+        if (lbl271Data->rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
         {
             label272ARINCWord |= 0xC00u; // set bits 10 and 11 if MSU fail 
         }
@@ -680,31 +758,31 @@ uint32_t CalculateARINCLabel274( const ARINC429_RxMsgArray * const rxMsgArray,
 
     uint32_t label274ARINCWord = 0x0000003Du; // Set the flipped label value initially. 
 
-    ARINC429_RxMsgData lbl271Data;
-    ARINC429_GetLabelDataReturnStatus status271 = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data );
+    const ARINC429_RxMsgData * lbl271Data;
+    uint8_t lbl271Flags;
+    ARINC429_GetLabelDataReturnStatus status271 = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data, &lbl271Flags );
 
-    ARINC429_RxMsgData lbl270Data;
-    ARINC429_GetLabelDataReturnStatus status270 = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 270 ), &lbl270Data );
+    const ARINC429_RxMsgData * lbl270Data;
+    uint8_t lbl270Flags;
+    ARINC429_GetLabelDataReturnStatus status270 = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 270 ), &lbl270Data, &lbl270Flags );
 
-    if (lbl271Data.isDataFresh &&
-        lbl271Data.isNotBabbling &&
-        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data.SM)&&
+    if (ARINC429_AreRxFlagsValid( lbl271Flags ) &&
+        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data->SM)&&
         (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status271) &&
-        lbl270Data.isDataFresh &&
-        lbl270Data.isNotBabbling &&
-        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl270Data.SM)&&
+        ARINC429_AreRxFlagsValid( lbl270Flags ) &&
+        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl270Data->SM)&&
         (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status270))
     {
-        label274ARINCWord |= (lbl271Data.rawARINCword & AHRS_STATUS_SDI_SSM_MASK); // copy 271's SDI and SSM. 
+        label274ARINCWord |= (lbl271Data->rawARINCword & AHRS_STATUS_SDI_SSM_MASK); // copy 271's SDI and SSM. 
 
         /* Set bit 28 if MSU fail*/
-        if (lbl271Data.rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
+        if (lbl271Data->rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
         {
             label274ARINCWord |= 0x10000000u;
         }
 
         /* Set bit 11 if MSU is calibrating*/
-        if (lbl270Data.rawARINCword & AHRS_LABEL_270_CAL_MASK)
+        if (lbl270Data->rawARINCword & AHRS_LABEL_270_CAL_MASK)
         {
             label274ARINCWord |= 0x800u;
         }
@@ -742,32 +820,32 @@ uint32_t CalculateARINCLabel275( const ARINC429_RxMsgArray * const rxMsgArray )
         return 0;
     }
 
-    ARINC429_RxMsgData lbl271Data;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data );
+    const ARINC429_RxMsgData * lbl271Data;
+    uint8_t lbl271Flags;
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 271 ), &lbl271Data, &lbl271Flags );
 
     // Get flight path acceleration from array. If the SM is failed, set bits 26-24. 
-    ARINC429_RxMsgData flightPathAccelData;
-    ARINC429_GetLabelDataReturnStatus fpaStatus = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 323 ), &flightPathAccelData );
+    const ARINC429_RxMsgData * flightPathAccelData;
+    uint8_t flightPathAccelFlags;
+    ARINC429_GetLabelDataReturnStatus fpaStatus = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 323 ), &flightPathAccelData, &flightPathAccelFlags );
 
     uint32_t label275ARINCWord = 0x000040BDu; // Default with label and bit 15 to 1. 
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-        lbl271Data.isNotBabbling &&
-        lbl271Data.isDataFresh &&
-        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data.SM) &&
+        ARINC429_AreRxFlagsValid( lbl271Flags ) &&
+        (ARINC429_SSM_DIS_NORMAL_OPERATION == lbl271Data->SM) &&
         (ARINC429_GET_LABEL_DATA_MSG_SUCCESS == fpaStatus) &&
-        flightPathAccelData.isDataFresh &&
-        flightPathAccelData.isNotBabbling)
+        ARINC429_AreRxFlagsValid( flightPathAccelFlags ))
     {
-        label275ARINCWord |= ((lbl271Data.rawARINCword & AHRS_STATUS_SDI_SSM_MASK)); // Extract the SSM and SDI from label 271 
+        label275ARINCWord |= ((lbl271Data->rawARINCword & AHRS_STATUS_SDI_SSM_MASK)); // Extract the SSM and SDI from label 271 
 
         /* If 271 msu fail, set bit 23*/
-        if (lbl271Data.rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
+        if (lbl271Data->rawARINCword & AHRS_LABEL_271_MSU_FAIL_MASK)
         {
             label275ARINCWord |= 0x400000; //set bit 23
         }
         //indicates low speed tx bus to ahr75 has failed. If SM is not valid, set bit 25 t0 zero. 
-        label275ARINCWord |= (ARINC429_SSM_BNR_NORMAL_OPERATION != flightPathAccelData.SM) ? 0x3000000u : 0x2000000u;
+        label275ARINCWord |= (ARINC429_SSM_BNR_NORMAL_OPERATION != flightPathAccelData->SM) ? 0x3000000u : 0x2000000u;
 
     }
     else
@@ -790,20 +868,21 @@ uint32_t CalculateARINCLabel275( const ARINC429_RxMsgArray * const rxMsgArray )
  */
 uint32_t CalculateBaroCorrection( const ARINC429_RxMsgArray * const rxMsgArray )
 {
-    ARINC429_RxMsgData baroData;
+    const ARINC429_RxMsgData * baroData;
+    uint8_t baroFlags;
     uint32_t baroARINCWord;
-    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 235 ), &baroData );
+    ARINC429_GetLabelDataReturnStatus status = ARINC429_GetLatestLabelData( rxMsgArray, FormatLabelNumber( 235 ), &baroData, &baroFlags );
 
     ARINC429_TxMsg baroMsg;
     baroMsg.msgConfig = &arincLabel235Config;
+    baroMsg.codec = arincLabel235TxCodec;
 
     if ((ARINC429_GET_LABEL_DATA_MSG_SUCCESS == status) &&
-        baroData.isDataFresh &&
-        baroData.isNotBabbling &&
-        (ARNIC429_SSM_BCD_PLUS == baroData.SM))
+        ARINC429_AreRxFlagsValid( baroFlags ) &&
+        (ARNIC429_SSM_BCD_PLUS == baroData->SM))
     {
-        baroMsg.engData = baroData.engDataFloat;
-        baroMsg.SDI = baroData.SDI;
+        baroMsg.engData = baroData->engDataFloat;
+        baroMsg.SDI = baroData->SDI;
         baroMsg.SM = ARNIC429_SSM_BCD_PLUS;
     }
     else
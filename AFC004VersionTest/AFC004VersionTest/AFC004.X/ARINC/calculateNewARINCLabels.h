@@ -30,6 +30,8 @@ void SetupTurnRateIIRDiff(const float k1,
 void SetupNormAccelIIRFilter(const float k1,
         const float k2);
 
+bool SetupTransmitLabelCodecs(void);
+
 uint32_t CalculateTurnRate(const ARINC429_RxMsgArray * const rxMsgArray);
 
 uint32_t CalculateSlipAngle(const ARINC429_RxMsgArray * const rxMsgArray);
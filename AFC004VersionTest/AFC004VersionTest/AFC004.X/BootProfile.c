@@ -0,0 +1,254 @@
+/*
+ * Filename: BootProfile.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Boot stage profiler. main() marks the end of each startup
+ *      stage, and the time since the previous mark is stored as that
+ *      stage's duration in raw Timer23 ticks (TMR23ScaleFactor ticks per ms).
+ *      Reading the tick count avoids the 32 bit division of the millisecond
+ *      timestamp, so marking a stage does not disturb the timing it measures.
+ *
+ *      Maintenance mode is entered part way through startup, so the record
+ *      of the last boot that reached its first 100 Hz frame is kept in
+ *      persistent RAM. It is not cleared by the C start up code and the RAM
+ *      test restores the contents it tests, so a record from a normal boot
+ *      can be retrieved over UART2 after a reset into maintenance mode. A
+ *      check word rejects the random contents of RAM after a power up.
+ *
+ *      The module only depends on Timer23_GetTimestamp_ticks, so it builds
+ *      and runs the same way on a host against a stub timer.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include "BootProfile.h"
+#include <stddef.h>
+#include "Timer23.h"
+
+
+/**************  Macro Definitions ***********************/
+#define ALL_BOOT_STAGES_RECORDED ((uint16_t) ((1u << NUM_BOOT_STAGES) - 1u))
+#define BOOT_PROFILE_CHECK_SEED 0xB007u
+
+#ifdef __dsPIC30F__
+#define BOOT_PROFILE_PERSISTENT __attribute__((persistent))
+#else
+#define BOOT_PROFILE_PERSISTENT
+#endif
+
+#if (NUM_BOOT_STAGES > 16)
+#error "Boot profile recorded stages mask is 16 bits wide"
+#endif
+
+
+/**************  Type Definitions ************************/
+typedef struct
+{
+    uint32_t stageDuration_ticks[NUM_BOOT_STAGES];
+    uint16_t recordedStages; /* Bit n is set once stage n has been timed */
+    uint16_t checkWord; /* Only valid for the last completed boot record */
+} BootProfileRecord;
+
+
+/**************  Local Variables *************************/
+static BootProfileRecord currentBoot;
+static BootProfileRecord lastCompletedBoot BOOT_PROFILE_PERSISTENT;
+static uint32_t stageStart_ticks;
+
+
+/**************  Static Function Prototypes *************/
+static uint16_t CalculateCheckWord( const BootProfileRecord * const record );
+static const BootProfileRecord * GetRecord( const BootProfileRecordId recordId );
+
+
+/**************  Function Definitions ********************/
+#BootProfile_Start
+/* Function: BootProfile_Start
+ *
+ * Description: Starts timing the first boot stage. Timer23 must already be
+ *      initialized. Discards the last completed boot record if its check word
+ *      does not match, which is the case after a power up.
+ *
+ * Return: None (void)
+ */
+void BootProfile_Start( void )
+{
+    uint8_t stage;
+
+    for (stage = 0; stage < NUM_BOOT_STAGES; stage++)
+    {
+        currentBoot.stageDuration_ticks[stage] = 0;
+    }
+    currentBoot.recordedStages = 0;
+    currentBoot.checkWord = 0;
+
+    if ((ALL_BOOT_STAGES_RECORDED != lastCompletedBoot.recordedStages) ||
+            (CalculateCheckWord( &lastCompletedBoot ) != lastCompletedBoot.checkWord))
+    {
+        for (stage = 0; stage < NUM_BOOT_STAGES; stage++)
+        {
+            lastCompletedBoot.stageDuration_ticks[stage] = 0;
+        }
+        lastCompletedBoot.recordedStages = 0;
+        lastCompletedBoot.checkWord = 0;
+    }
+
+    stageStart_ticks = Timer23_GetTimestamp_ticks( );
+    return;
+}
+#BootProfile_Start
+
+#BootProfile_EndStage
+/* Function: BootProfile_EndStage
+ *
+ * Description: Stores the ticks elapsed since the end of the previous stage
+ *      as the duration of the given stage, and starts timing the next stage.
+ *      Ending the last stage copies the record to the last completed boot
+ *      record.
+ *
+ * Return: None (void)
+ */
+void BootProfile_EndStage( const BootProfileStage stage )
+{
+    if (stage >= NUM_BOOT_STAGES)
+    {
+        return;
+    }
+
+    const uint32_t stageEnd_ticks = Timer23_GetTimestamp_ticks( );
+
+    currentBoot.stageDuration_ticks[stage] = stageEnd_ticks - stageStart_ticks;
+    currentBoot.recordedStages |= (uint16_t) (1u << stage);
+    stageStart_ticks = stageEnd_ticks;
+
+    if ((BOOT_STAGE_FIRST_FRAME_WAIT == stage) &&
+            (ALL_BOOT_STAGES_RECORDED == currentBoot.recordedStages))
+    {
+        currentBoot.checkWord = CalculateCheckWord( &currentBoot );
+        lastCompletedBoot = currentBoot;
+    }
+    return;
+}
+#BootProfile_EndStage
+
+#BootProfile_GetStageDuration_ticks
+/* Function: BootProfile_GetStageDuration_ticks
+ *
+ * Description: Gets the duration of a stage from the current boot record or
+ *      the last completed boot record.
+ *
+ * Return: True if the stage has been timed in the requested record
+ */
+bool BootProfile_GetStageDuration_ticks( const BootProfileRecordId recordId,
+                                         const BootProfileStage stage,
+                                         uint32_t * const duration_ticks ) /* Stage duration in Timer23 ticks */
+{
+    const BootProfileRecord * const record = GetRecord( recordId );
+
+    if ((NULL == record) || (stage >= NUM_BOOT_STAGES) ||
+            (0 == (record->recordedStages & (1u << stage))))
+    {
+        return false;
+    }
+
+    *duration_ticks = record->stageDuration_ticks[stage];
+    return true;
+}
+#BootProfile_GetStageDuration_ticks
+
+#BootProfile_SerializeRecord
+/* Function: BootProfile_SerializeRecord
+ *
+ * Description: Writes a record to a frame for transmission:
+ *          BOOT_PROFILE_FRAME_HEADER
+ *          Record ID
+ *          NUM_BOOT_STAGES
+ *          Recorded stages mask, bit n set if stage n was timed, MSB first
+ *          Duration of each stage in Timer23 ticks, 4 bytes each, MSB first
+ *
+ * Return: Number of bytes written, 0 if the frame is too small or the record
+ *      ID is invalid
+ */
+uint16_t BootProfile_SerializeRecord( const BootProfileRecordId recordId,
+                                      uint8_t * const frame, /* Buffer for the serialized record */
+                                      const uint16_t frameSize ) /* Size of the buffer */
+{
+    const BootProfileRecord * const record = GetRecord( recordId );
+    uint16_t frameIdx = 0;
+    uint8_t stage;
+
+    if ((NULL == record) || (frameSize < BOOT_PROFILE_FRAME_SIZE))
+    {
+        return 0;
+    }
+
+    frame[frameIdx++] = BOOT_PROFILE_FRAME_HEADER;
+    frame[frameIdx++] = (uint8_t) recordId;
+    frame[frameIdx++] = (uint8_t) NUM_BOOT_STAGES;
+    frame[frameIdx++] = (uint8_t) (record->recordedStages >> 8);
+    frame[frameIdx++] = (uint8_t) record->recordedStages;
+
+    for (stage = 0; stage < NUM_BOOT_STAGES; stage++)
+    {
+        const uint32_t duration_ticks = record->stageDuration_ticks[stage];
+        frame[frameIdx++] = (uint8_t) (duration_ticks >> 24);
+        frame[frameIdx++] = (uint8_t) (duration_ticks >> 16);
+        frame[frameIdx++] = (uint8_t) (duration_ticks >> 8);
+        frame[frameIdx++] = (uint8_t) duration_ticks;
+    }
+    return frameIdx;
+}
+#BootProfile_SerializeRecord
+
+/**************  Static Function Definitions *************/
+#CalculateCheckWord
+/* Function: CalculateCheckWord
+ *
+ * Description: XORs the 16 bit halves of the stage durations and the
+ *      recorded stages mask into a seeded check word.
+ *
+ * Return: Check word of the record
+ */
+static uint16_t CalculateCheckWord( const BootProfileRecord * const record )
+{
+    uint16_t checkWord = BOOT_PROFILE_CHECK_SEED ^ record->recordedStages;
+    uint8_t stage;
+
+    for (stage = 0; stage < NUM_BOOT_STAGES; stage++)
+    {
+        checkWord ^= (uint16_t) (record->stageDuration_ticks[stage] >> 16);
+        checkWord ^= (uint16_t) record->stageDuration_ticks[stage];
+        checkWord = (uint16_t) ((checkWord << 1) | (checkWord >> 15));
+    }
+    return checkWord;
+}
+#CalculateCheckWord
+
+#GetRecord
+/* Function: GetRecord
+ *
+ * Description: Maps a record ID to its record.
+ *
+ * Return: Pointer to the record, NULL if the record ID is invalid
+ */
+static const BootProfileRecord * GetRecord( const BootProfileRecordId recordId )
+{
+    const BootProfileRecord * record = NULL;
+
+    if (BOOT_PROFILE_CURRENT_BOOT == recordId)
+    {
+        record = &currentBoot;
+    }
+    else if (BOOT_PROFILE_LAST_COMPLETED_BOOT == recordId)
+    {
+        record = &lastCompletedBoot;
+    }
+    return record;
+}
+#GetRecord
+/* End of BootProfile.c source file */
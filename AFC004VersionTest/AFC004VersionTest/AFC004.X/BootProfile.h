@@ -0,0 +1,66 @@
+/*
+ * Filename: BootProfile.h
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: External interface for the boot stage profiler. Records the
+ *      duration of each startup stage in raw Timer23 ticks.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+/**************  Included Files **************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/**************  Macro Definitions ***********************/
+#define BOOT_PROFILE_FRAME_HEADER 0xB0u /* First byte of a serialized boot profile record */
+#define BOOT_PROFILE_FRAME_HEADER_SIZE 5u /* Header, record ID, number of stages, 2 byte recorded stages mask */
+#define BOOT_PROFILE_FRAME_SIZE (BOOT_PROFILE_FRAME_HEADER_SIZE + (4u * NUM_BOOT_STAGES))
+
+
+/**************  Type Definitions ************************/
+/* Startup stages, in the order main() runs them. Each stage is timed from the end of the previous stage. */
+typedef enum
+{
+    BOOT_STAGE_RAM_TEST = 0, /* RAM test */
+    BOOT_STAGE_HARDWARE_SETUP, /* Configuration check, pin setup and HI-3584 initialization */
+    BOOT_STAGE_ARINC_LOOPBACK_TESTS, /* HI-3584 transceiver A and B loopback tests, run together */
+    BOOT_STAGE_STORED_CODE_TEST, /* Rest of the first program memory CRC pass, after the part run in the loopback tests */
+    BOOT_STAGE_PERIPHERAL_SETUP, /* HI-3584 control registers, line drivers, timers, UARTs and filters */
+    BOOT_STAGE_READ_STRAPPING, /* ReadStrapping */
+    BOOT_STAGE_SW_VERSION_GATHER, /* SWVer_StartGathering. Replies are collected by the main loop */
+    BOOT_STAGE_LABEL_SETUP, /* Label lookup tables, HI-3584 label filters and ARINC receive interrupt */
+    BOOT_STAGE_FIRST_FRAME_WAIT, /* Wait for the first 100 Hz frame */
+    NUM_BOOT_STAGES
+} BootProfileStage;
+
+typedef enum
+{
+    BOOT_PROFILE_CURRENT_BOOT = 0, /* Stages recorded so far by this boot */
+    BOOT_PROFILE_LAST_COMPLETED_BOOT /* Last boot to reach its first frame, kept through a reset */
+} BootProfileRecordId;
+
+
+/**************  Function Prototypes *********************/
+void BootProfile_Start(void);
+
+void BootProfile_EndStage(const BootProfileStage stage);
+
+bool BootProfile_GetStageDuration_ticks(const BootProfileRecordId recordId,
+        const BootProfileStage stage,
+        uint32_t * const duration_ticks); /* Stage duration in Timer23 ticks */
+
+uint16_t BootProfile_SerializeRecord(const BootProfileRecordId recordId,
+        uint8_t * const frame, /* Buffer for the serialized record */
+        const uint16_t frameSize); /* Size of the buffer */
+
+
+#endif
+/* End of BootProfile.h header file*/
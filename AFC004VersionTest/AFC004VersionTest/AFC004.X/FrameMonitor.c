@@ -0,0 +1,399 @@
+/*
+ * Filename: FrameMonitor.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: 100 Hz frame monitor. The Timer 4 interrupt counts frames, so
+ *      a frame whose interrupt arrives while the previous frame's work is
+ *      still running is counted as missed instead of silently merged into the
+ *      still set frequency flag.
+ *
+ *      Timer 4 restarts from zero at each frame, so its count when the frame's
+ *      work ends is the busy time of the frame, measured from the interrupt
+ *      rather than from when the main loop noticed it. The slack is the rest
+ *      of the frame period. A frame whose work is still running at the next
+ *      interrupt is an overrun: it has no slack and its busy time is taken as
+ *      the whole period. Busy time is also kept as a histogram of tenths of
+ *      the frame period.
+ *
+ *      Maintenance mode is entered before the main loop runs, so, as for the
+ *      boot profile, the record of the previous boot is kept in persistent RAM
+ *      with a check word and can be retrieved over UART2 after a reset into
+ *      maintenance mode.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include "FrameMonitor.h"
+#include <stddef.h>
+#include "COMSystemTimer.h"
+
+
+/**************  Macro Definitions ***********************/
+#define FRAME_MONITOR_CHECK_SEED 0xF4A3u
+
+#ifdef __dsPIC30F__
+#define FRAME_MONITOR_PERSISTENT __attribute__((persistent))
+#else
+#define FRAME_MONITOR_PERSISTENT
+#endif
+
+
+/**************  Type Definitions ************************/
+typedef struct
+{
+    uint32_t numFrames; /* Frames monitored, saturates */
+    uint32_t numMissedFrames; /* Frames whose work was never run */
+    uint32_t numOverruns; /* Frames whose work ran into the next frame */
+    uint16_t framePeriod_counts; /* Timer 4 counts per frame */
+    uint16_t minBusy_counts;
+    uint16_t maxBusy_counts;
+    uint32_t busyHistogram[FRAME_MONITOR_NUM_BUSY_BINS];
+    uint16_t checkWord;
+} FrameMonitorRecord;
+
+
+/**************  Local Variables *************************/
+static FrameMonitorRecord currentRun FRAME_MONITOR_PERSISTENT;
+static FrameMonitorRecord lastRun FRAME_MONITOR_PERSISTENT;
+static uint16_t busyBinWidth_counts;
+static uint16_t lastFrameCount;
+static bool hasLastFrameCount;
+static bool isFrameStarted;
+
+
+/**************  Static Function Prototypes *************/
+static void ClearRecord( FrameMonitorRecord * const record,
+                         const uint16_t framePeriod_counts );
+static uint16_t CalculateCheckWord( const FrameMonitorRecord * const record );
+static bool IsRecordValid( const FrameMonitorRecord * const record );
+static const FrameMonitorRecord * GetRecord( const FrameMonitorRecordId recordId );
+static uint16_t WriteUint32( uint8_t * const frame,
+                             const uint32_t value );
+static uint16_t WriteUint16( uint8_t * const frame,
+                             const uint16_t value );
+
+
+/**************  Function Definitions ********************/
+#FrameMonitor_Initialize
+/* Function: FrameMonitor_Initialize
+ *
+ * Description: Keeps the record of the previous boot, if it is valid and
+ *      monitored any frames, as the last run record, then starts a new record.
+ *      Must be called at boot before maintenance mode can be entered.
+ *
+ * Return: None (void)
+ */
+void FrameMonitor_Initialize( const uint16_t framePeriod_counts ) /* Frame period in Timer 4 counts */
+{
+    if (IsRecordValid( &currentRun ) && (0 != currentRun.numFrames))
+    {
+        lastRun = currentRun;
+    }
+    else if (false == IsRecordValid( &lastRun ))
+    {
+        ClearRecord( &lastRun, 0 );
+    }
+
+    ClearRecord( &currentRun, framePeriod_counts );
+    busyBinWidth_counts = (framePeriod_counts / FRAME_MONITOR_NUM_BUSY_BINS) + 1u;
+    hasLastFrameCount = false;
+    isFrameStarted = false;
+    return;
+}
+#FrameMonitor_Initialize
+
+#FrameMonitor_StartFrame
+/* Function: FrameMonitor_StartFrame
+ *
+ * Description: Marks the start of a frame's work. Frames counted by the
+ *      Timer 4 interrupt since the previous frame was started, other than this
+ *      one, were never run and are counted as missed. The first call only
+ *      takes the frame count as a reference.
+ *
+ * Return: Number of frames missed since the previous frame
+ */
+uint16_t FrameMonitor_StartFrame( void )
+{
+    const uint16_t frameCount = u16_ReadSystemFrameCount( );
+    uint16_t numMissedFrames = 0;
+
+    if (hasLastFrameCount)
+    {
+        const uint16_t numFramesElapsed = (uint16_t) (frameCount - lastFrameCount);
+        if (numFramesElapsed > 1u)
+        {
+            numMissedFrames = numFramesElapsed - 1u;
+            currentRun.numMissedFrames += numMissedFrames;
+        }
+    }
+    lastFrameCount = frameCount;
+    hasLastFrameCount = true;
+    isFrameStarted = true;
+    return numMissedFrames;
+}
+#FrameMonitor_StartFrame
+
+#FrameMonitor_EndFrame
+/* Function: FrameMonitor_EndFrame
+ *
+ * Description: Marks the end of a frame's work and records its busy time.
+ *      If the next frame has already started, the frame is counted as an
+ *      overrun with a busy time of the whole period.
+ *
+ * Return: None (void)
+ */
+void FrameMonitor_EndFrame( void )
+{
+    if (false == isFrameStarted)
+    {
+        return;
+    }
+    isFrameStarted = false;
+
+    const uint16_t timerCount = u16_ReadSystemFrameTimerCount( );
+    uint16_t busy_counts;
+
+    if (u16_ReadSystemFrameCount( ) != lastFrameCount)
+    {
+        busy_counts = currentRun.framePeriod_counts;
+        currentRun.numOverruns++;
+    }
+    else
+    {
+        busy_counts = (timerCount < currentRun.framePeriod_counts) ? timerCount : currentRun.framePeriod_counts;
+    }
+
+    if (busy_counts < currentRun.minBusy_counts)
+    {
+        currentRun.minBusy_counts = busy_counts;
+    }
+    if (busy_counts > currentRun.maxBusy_counts)
+    {
+        currentRun.maxBusy_counts = busy_counts;
+    }
+
+    uint16_t bin = busy_counts / busyBinWidth_counts;
+    if (bin >= FRAME_MONITOR_NUM_BUSY_BINS)
+    {
+        bin = FRAME_MONITOR_NUM_BUSY_BINS - 1u;
+    }
+    currentRun.busyHistogram[bin]++;
+
+    if (currentRun.numFrames < UINT32_MAX)
+    {
+        currentRun.numFrames++;
+    }
+    currentRun.checkWord = CalculateCheckWord( &currentRun );
+    return;
+}
+#FrameMonitor_EndFrame
+
+#FrameMonitor_HasMissedFrames
+/* Function: FrameMonitor_HasMissedFrames
+ *
+ * Description: Reports whether any frame's work has been skipped since boot.
+ *
+ * Return: True if a frame was missed
+ */
+bool FrameMonitor_HasMissedFrames( void )
+{
+    return (0 != currentRun.numMissedFrames);
+}
+#FrameMonitor_HasMissedFrames
+
+#FrameMonitor_SerializeRecord
+/* Function: FrameMonitor_SerializeRecord
+ *
+ * Description: Writes a record to a frame for transmission, multi-byte
+ *      values MSB first:
+ *          FRAME_MONITOR_FRAME_HEADER
+ *          Record ID
+ *          FRAME_MONITOR_NUM_BUSY_BINS
+ *          1 if the record is valid, 0 if not
+ *          Frames monitored, missed frames and overruns, 4 bytes each
+ *          Frame period, min and max busy time, min and max slack, in
+ *              Timer 4 counts, 2 bytes each
+ *          Busy time histogram, 4 bytes per bin, bin n counting frames busy
+ *              for n to n + 1 tenths of the period
+ *
+ * Return: Number of bytes written, 0 if the frame is too small or the record
+ *      ID is invalid
+ */
+uint16_t FrameMonitor_SerializeRecord( const FrameMonitorRecordId recordId,
+                                       uint8_t * const frame, /* Buffer for the serialized record */
+                                       const uint16_t frameSize ) /* Size of the buffer */
+{
+    const FrameMonitorRecord * const record = GetRecord( recordId );
+    uint16_t frameIdx = 0;
+    uint8_t bin;
+
+    if ((NULL == record) || (frameSize < FRAME_MONITOR_FRAME_SIZE))
+    {
+        return 0;
+    }
+
+    const bool hasFrames = IsRecordValid( record ) && (0 != record->numFrames);
+    const uint16_t minBusy_counts = hasFrames ? record->minBusy_counts : 0;
+    const uint16_t maxBusy_counts = hasFrames ? record->maxBusy_counts : 0;
+
+    frame[frameIdx++] = FRAME_MONITOR_FRAME_HEADER;
+    frame[frameIdx++] = (uint8_t) recordId;
+    frame[frameIdx++] = (uint8_t) FRAME_MONITOR_NUM_BUSY_BINS;
+    frame[frameIdx++] = IsRecordValid( record ) ? 1u : 0u;
+    frameIdx += WriteUint32( &frame[frameIdx], record->numFrames );
+    frameIdx += WriteUint32( &frame[frameIdx], record->numMissedFrames );
+    frameIdx += WriteUint32( &frame[frameIdx], record->numOverruns );
+    frameIdx += WriteUint16( &frame[frameIdx], record->framePeriod_counts );
+    frameIdx += WriteUint16( &frame[frameIdx], minBusy_counts );
+    frameIdx += WriteUint16( &frame[frameIdx], maxBusy_counts );
+    frameIdx += WriteUint16( &frame[frameIdx], hasFrames ? (record->framePeriod_counts - maxBusy_counts) : 0 );
+    frameIdx += WriteUint16( &frame[frameIdx], hasFrames ? (record->framePeriod_counts - minBusy_counts) : 0 );
+
+    for (bin = 0; bin < FRAME_MONITOR_NUM_BUSY_BINS; bin++)
+    {
+        frameIdx += WriteUint32( &frame[frameIdx], record->busyHistogram[bin] );
+    }
+    return frameIdx;
+}
+#FrameMonitor_SerializeRecord
+
+/**************  Static Function Definitions *************/
+#ClearRecord
+/* Function: ClearRecord
+ *
+ * Description: Empties a record and makes its check word valid.
+ *
+ * Return: None (void)
+ */
+static void ClearRecord( FrameMonitorRecord * const record,
+                         const uint16_t framePeriod_counts )
+{
+    uint8_t bin;
+
+    record->numFrames = 0;
+    record->numMissedFrames = 0;
+    record->numOverruns = 0;
+    record->framePeriod_counts = framePeriod_counts;
+    record->minBusy_counts = UINT16_MAX;
+    record->maxBusy_counts = 0;
+    for (bin = 0; bin < FRAME_MONITOR_NUM_BUSY_BINS; bin++)
+    {
+        record->busyHistogram[bin] = 0;
+    }
+    record->checkWord = CalculateCheckWord( record );
+    return;
+}
+#ClearRecord
+
+#CalculateCheckWord
+/* Function: CalculateCheckWord
+ *
+ * Description: XORs the 16 bit halves of the record's fields into a seeded,
+ *      rotated check word.
+ *
+ * Return: Check word of the record
+ */
+static uint16_t CalculateCheckWord( const FrameMonitorRecord * const record )
+{
+    const uint32_t fields[] = {
+        record->numFrames,
+        record->numMissedFrames,
+        record->numOverruns,
+        record->framePeriod_counts,
+        ((uint32_t) record->minBusy_counts << 16) | record->maxBusy_counts
+    };
+    uint16_t checkWord = FRAME_MONITOR_CHECK_SEED;
+    uint8_t idx;
+
+    for (idx = 0; idx < (sizeof (fields) / sizeof (fields[0])); idx++)
+    {
+        checkWord ^= (uint16_t) (fields[idx] >> 16);
+        checkWord ^= (uint16_t) fields[idx];
+        checkWord = (uint16_t) ((checkWord << 1) | (checkWord >> 15));
+    }
+    for (idx = 0; idx < FRAME_MONITOR_NUM_BUSY_BINS; idx++)
+    {
+        checkWord ^= (uint16_t) (record->busyHistogram[idx] >> 16);
+        checkWord ^= (uint16_t) record->busyHistogram[idx];
+        checkWord = (uint16_t) ((checkWord << 1) | (checkWord >> 15));
+    }
+    return checkWord;
+}
+#CalculateCheckWord
+
+#IsRecordValid
+/* Function: IsRecordValid
+ *
+ * Description: Checks a record against its check word, which rejects the
+ *      random contents of persistent RAM after a power up.
+ *
+ * Return: True if the record is valid
+ */
+static bool IsRecordValid( const FrameMonitorRecord * const record )
+{
+    return (CalculateCheckWord( record ) == record->checkWord);
+}
+#IsRecordValid
+
+#GetRecord
+/* Function: GetRecord
+ *
+ * Description: Maps a record ID to its record.
+ *
+ * Return: Pointer to the record, NULL if the record ID is invalid
+ */
+static const FrameMonitorRecord * GetRecord( const FrameMonitorRecordId recordId )
+{
+    const FrameMonitorRecord * record = NULL;
+
+    if (FRAME_MONITOR_CURRENT_RUN == recordId)
+    {
+        record = &currentRun;
+    }
+    else if (FRAME_MONITOR_LAST_RUN == recordId)
+    {
+        record = &lastRun;
+    }
+    return record;
+}
+#GetRecord
+
+#WriteUint32
+/* Function: WriteUint32
+ *
+ * Description: Writes a 32 bit value to a frame, MSB first.
+ *
+ * Return: Number of bytes written
+ */
+static uint16_t WriteUint32( uint8_t * const frame,
+                             const uint32_t value )
+{
+    frame[0] = (uint8_t) (value >> 24);
+    frame[1] = (uint8_t) (value >> 16);
+    frame[2] = (uint8_t) (value >> 8);
+    frame[3] = (uint8_t) value;
+    return 4u;
+}
+#WriteUint32
+
+#WriteUint16
+/* Function: WriteUint16
+ *
+ * Description: Writes a 16 bit value to a frame, MSB first.
+ *
+ * Return: Number of bytes written
+ */
+static uint16_t WriteUint16( uint8_t * const frame,
+                             const uint16_t value )
+{
+    frame[0] = (uint8_t) (value >> 8);
+    frame[1] = (uint8_t) value;
+    return 2u;
+}
+#WriteUint16
+/* End of FrameMonitor.c source file */
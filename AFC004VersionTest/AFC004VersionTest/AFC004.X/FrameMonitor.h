@@ -0,0 +1,53 @@
+/*
+ * Filename: FrameMonitor.h
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: External interface for the 100 Hz frame monitor. Counts
+ *      frames lost to overruns and records how much of each frame the main
+ *      loop's work takes, as a busy time and the slack left before the next
+ *      frame.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+#ifndef FRAME_MONITOR_H
+#define FRAME_MONITOR_H
+
+/**************  Included Files **************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+
+/**************  Macro Definitions ***********************/
+#define FRAME_MONITOR_NUM_BUSY_BINS 10u /* Busy time histogram bins, a tenth of the frame period each */
+#define FRAME_MONITOR_FRAME_HEADER 0xF0u /* First byte of a serialized frame monitor record */
+#define FRAME_MONITOR_FRAME_SIZE (4u + (3u * 4u) + (5u * 2u) + (4u * FRAME_MONITOR_NUM_BUSY_BINS))
+
+
+/**************  Type Definitions ************************/
+typedef enum
+{
+    FRAME_MONITOR_CURRENT_RUN = 0, /* Frames run since this boot */
+    FRAME_MONITOR_LAST_RUN /* Frames run by the previous boot, kept through a reset */
+} FrameMonitorRecordId;
+
+
+/**************  Function Prototypes *********************/
+void FrameMonitor_Initialize(const uint16_t framePeriod_counts); /* Frame period in Timer 4 counts */
+
+uint16_t FrameMonitor_StartFrame(void);
+
+void FrameMonitor_EndFrame(void);
+
+bool FrameMonitor_HasMissedFrames(void);
+
+uint16_t FrameMonitor_SerializeRecord(const FrameMonitorRecordId recordId,
+        uint8_t * const frame, /* Buffer for the serialized record */
+        const uint16_t frameSize); /* Size of the buffer */
+
+
+#endif
+/* End of FrameMonitor.h header file*/
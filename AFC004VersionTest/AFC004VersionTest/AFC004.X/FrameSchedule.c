@@ -0,0 +1,377 @@
+/*
+ * Filename: FrameSchedule.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Table driven dispatcher for the work done in the 100 Hz frame.
+ *      Each task counts down the frames to its next run, so no division is
+ *      done per frame. The first call to FrameSchedule_RunFrame after
+ *      FrameSchedule_Initialize is frame 1 of the schedule, so a task with
+ *      phase p runs on the frames where frame % period == p.
+ *
+ *      Each run is timed in raw Timer23 ticks (TMR23ScaleFactor ticks per ms),
+ *      keeping the latest and longest execution time of every task. These are
+ *      also kept in a record with each task's period and table load, so the
+ *      build time load figures can be compared with measured times.
+ *
+ *      Maintenance mode is entered before the main loop runs, so, as for the
+ *      frame monitor, the record of the previous boot is kept in persistent
+ *      RAM with a check word and can be retrieved over UART2 after a reset
+ *      into maintenance mode.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include "FrameSchedule.h"
+#include "Timer23.h"
+
+
+/**************  Macro Definitions ***********************/
+#define FRAME_SCHEDULE_CHECK_SEED 0xE5C7u
+
+#ifdef __dsPIC30F__
+#define FRAME_SCHEDULE_PERSISTENT __attribute__((persistent))
+#else
+#define FRAME_SCHEDULE_PERSISTENT
+#endif
+
+
+/**************  Type Definitions ************************/
+typedef struct
+{
+    uint8_t period_frames; /* From the schedule table */
+    uint8_t load; /* From the schedule table */
+    uint32_t numRuns; /* Saturates */
+    uint32_t lastExecution_ticks; /* Execution time of the latest run in Timer23 ticks */
+    uint32_t maxExecution_ticks; /* Longest execution time in Timer23 ticks */
+} FrameScheduleTaskRecord;
+
+typedef struct
+{
+    FrameScheduleTaskRecord tasks[FRAME_SCHEDULE_MAX_RECORDED_TASKS];
+    uint8_t numTasks; /* Tasks recorded, 0 until the schedule is initialized */
+    uint16_t checkWord;
+} FrameScheduleRecord;
+
+
+/**************  Local Variables *************************/
+static FrameScheduleRecord currentRun FRAME_SCHEDULE_PERSISTENT;
+static FrameScheduleRecord lastRun FRAME_SCHEDULE_PERSISTENT;
+
+
+/**************  Static Function Prototypes *************/
+static void ClearRecord( FrameScheduleRecord * const record );
+static uint16_t CalculateCheckWord( const FrameScheduleRecord * const record );
+static bool IsRecordValid( const FrameScheduleRecord * const record );
+static const FrameScheduleRecord * GetRecord( const FrameScheduleRecordId recordId );
+static uint16_t WriteUint32( uint8_t * const frame,
+                             const uint32_t value );
+
+
+/**************  Function Definitions ********************/
+#FrameSchedule_InitializeRecord
+/* Function: FrameSchedule_InitializeRecord
+ *
+ * Description: Keeps the record of the previous boot, if it is valid and its
+ *      schedule was initialized, as the last run record, then starts a new
+ *      record. Must be called at boot before maintenance mode can be entered.
+ *
+ * Return: None (void)
+ */
+void FrameSchedule_InitializeRecord( void )
+{
+    if (IsRecordValid( &currentRun ) && (0 != currentRun.numTasks))
+    {
+        lastRun = currentRun;
+    }
+    else if (false == IsRecordValid( &lastRun ))
+    {
+        ClearRecord( &lastRun );
+    }
+
+    ClearRecord( &currentRun );
+    return;
+}
+#FrameSchedule_InitializeRecord
+
+#FrameSchedule_Initialize
+/* Function: FrameSchedule_Initialize
+ *
+ * Description: Clears the execution statistics and sets each task's count
+ *      down so that it first runs on the first frame matching its phase.
+ *      Tasks with a zero period are never run.
+ *
+ * Return: None (void)
+ */
+void FrameSchedule_Initialize( const FrameScheduleTask * const tasks,
+                               FrameScheduleTaskState * const states, /* One per task */
+                               const size_t numTasks )
+{
+    size_t taskIdx;
+
+    if ((NULL == tasks) || (NULL == states))
+    {
+        return;
+    }
+
+    for (taskIdx = 0; taskIdx < numTasks; taskIdx++)
+    {
+        const uint8_t period_frames = tasks[taskIdx].period_frames;
+
+        states[taskIdx].framesUntilDue = (0 == period_frames) ? 0 :
+                (uint8_t) ((tasks[taskIdx].phase_frames + period_frames - 1u) % period_frames);
+        states[taskIdx].numRuns = 0;
+        states[taskIdx].lastExecution_ticks = 0;
+        states[taskIdx].maxExecution_ticks = 0;
+    }
+
+    /* Record the table figures of the tasks the record has room for */
+    ClearRecord( &currentRun );
+    currentRun.numTasks = (numTasks > FRAME_SCHEDULE_MAX_RECORDED_TASKS) ? FRAME_SCHEDULE_MAX_RECORDED_TASKS : (uint8_t) numTasks;
+    for (taskIdx = 0; taskIdx < currentRun.numTasks; taskIdx++)
+    {
+        currentRun.tasks[taskIdx].period_frames = tasks[taskIdx].period_frames;
+        currentRun.tasks[taskIdx].load = tasks[taskIdx].load;
+    }
+    currentRun.checkWord = CalculateCheckWord( &currentRun );
+    return;
+}
+#FrameSchedule_Initialize
+
+#FrameSchedule_RunFrame
+/* Function: FrameSchedule_RunFrame
+ *
+ * Description: Runs the tasks due this frame, in table order, and timestamps
+ *      each one. The execution times are copied to the current run record.
+ *      Call once per 100 Hz frame.
+ *
+ * Return: None (void)
+ */
+void FrameSchedule_RunFrame( const FrameScheduleTask * const tasks,
+                             FrameScheduleTaskState * const states, /* One per task */
+                             const size_t numTasks )
+{
+    size_t taskIdx;
+    bool isRecordUpdated = false;
+
+    if ((NULL == tasks) || (NULL == states))
+    {
+        return;
+    }
+
+    for (taskIdx = 0; taskIdx < numTasks; taskIdx++)
+    {
+        const FrameScheduleTask * const task = &tasks[taskIdx];
+        FrameScheduleTaskState * const state = &states[taskIdx];
+
+        if ((0 == task->period_frames) || (NULL == task->run))
+        {
+            continue;
+        }
+
+        if (0 != state->framesUntilDue)
+        {
+            state->framesUntilDue--;
+            continue;
+        }
+        state->framesUntilDue = task->period_frames - 1u;
+
+        const uint32_t start_ticks = Timer23_GetTimestamp_ticks( );
+        task->run( );
+        const uint32_t execution_ticks = Timer23_GetTimestamp_ticks( ) - start_ticks;
+
+        state->lastExecution_ticks = execution_ticks;
+        if (execution_ticks > state->maxExecution_ticks)
+        {
+            state->maxExecution_ticks = execution_ticks;
+        }
+        if (state->numRuns < UINT32_MAX)
+        {
+            state->numRuns++;
+        }
+
+        if (taskIdx < currentRun.numTasks)
+        {
+            FrameScheduleTaskRecord * const taskRecord = &currentRun.tasks[taskIdx];
+            taskRecord->numRuns = state->numRuns;
+            taskRecord->lastExecution_ticks = state->lastExecution_ticks;
+            taskRecord->maxExecution_ticks = state->maxExecution_ticks;
+            isRecordUpdated = true;
+        }
+    }
+
+    if (isRecordUpdated)
+    {
+        currentRun.checkWord = CalculateCheckWord( &currentRun );
+    }
+    return;
+}
+#FrameSchedule_RunFrame
+
+#FrameSchedule_SerializeRecord
+/* Function: FrameSchedule_SerializeRecord
+ *
+ * Description: Writes a record to a frame for transmission, multi-byte
+ *      values MSB first:
+ *          FRAME_SCHEDULE_FRAME_HEADER
+ *          Record ID
+ *          1 if the record is valid, 0 if not
+ *          Number of tasks recorded
+ *          Per task, in schedule table order:
+ *              Period in frames and table load, 1 byte each
+ *              Runs, 4 bytes
+ *              Latest and longest execution time in Timer23 ticks, 4 bytes each
+ *
+ * Return: Number of bytes written, 0 if the frame is too small or the record
+ *      ID is invalid
+ */
+uint16_t FrameSchedule_SerializeRecord( const FrameScheduleRecordId recordId,
+                                        uint8_t * const frame, /* Buffer for the serialized record */
+                                        const uint16_t frameSize ) /* Size of the buffer */
+{
+    const FrameScheduleRecord * const record = GetRecord( recordId );
+    uint16_t frameIdx = 0;
+    uint8_t taskIdx;
+
+    if ((NULL == record) || (frameSize < FRAME_SCHEDULE_FRAME_SIZE))
+    {
+        return 0;
+    }
+
+    const bool isValid = IsRecordValid( record ) && (record->numTasks <= FRAME_SCHEDULE_MAX_RECORDED_TASKS);
+    const uint8_t numTasks = isValid ? record->numTasks : 0u;
+
+    frame[frameIdx++] = FRAME_SCHEDULE_FRAME_HEADER;
+    frame[frameIdx++] = (uint8_t) recordId;
+    frame[frameIdx++] = isValid ? 1u : 0u;
+    frame[frameIdx++] = numTasks;
+
+    for (taskIdx = 0; taskIdx < numTasks; taskIdx++)
+    {
+        const FrameScheduleTaskRecord * const taskRecord = &record->tasks[taskIdx];
+        frame[frameIdx++] = taskRecord->period_frames;
+        frame[frameIdx++] = taskRecord->load;
+        frameIdx += WriteUint32( &frame[frameIdx], taskRecord->numRuns );
+        frameIdx += WriteUint32( &frame[frameIdx], taskRecord->lastExecution_ticks );
+        frameIdx += WriteUint32( &frame[frameIdx], taskRecord->maxExecution_ticks );
+    }
+    return frameIdx;
+}
+#FrameSchedule_SerializeRecord
+
+/**************  Static Function Definitions *************/
+#ClearRecord
+/* Function: ClearRecord
+ *
+ * Description: Empties a record and makes its check word valid.
+ *
+ * Return: None (void)
+ */
+static void ClearRecord( FrameScheduleRecord * const record )
+{
+    uint8_t taskIdx;
+
+    for (taskIdx = 0; taskIdx < FRAME_SCHEDULE_MAX_RECORDED_TASKS; taskIdx++)
+    {
+        record->tasks[taskIdx].period_frames = 0;
+        record->tasks[taskIdx].load = 0;
+        record->tasks[taskIdx].numRuns = 0;
+        record->tasks[taskIdx].lastExecution_ticks = 0;
+        record->tasks[taskIdx].maxExecution_ticks = 0;
+    }
+    record->numTasks = 0;
+    record->checkWord = CalculateCheckWord( record );
+    return;
+}
+#ClearRecord
+
+#CalculateCheckWord
+/* Function: CalculateCheckWord
+ *
+ * Description: XORs the 16 bit halves of the record's fields into a seeded,
+ *      rotated check word.
+ *
+ * Return: Check word of the record
+ */
+static uint16_t CalculateCheckWord( const FrameScheduleRecord * const record )
+{
+    uint16_t checkWord = FRAME_SCHEDULE_CHECK_SEED ^ record->numTasks;
+    uint8_t taskIdx;
+
+    for (taskIdx = 0; taskIdx < FRAME_SCHEDULE_MAX_RECORDED_TASKS; taskIdx++)
+    {
+        const FrameScheduleTaskRecord * const taskRecord = &record->tasks[taskIdx];
+        checkWord ^= (uint16_t) (((uint16_t) taskRecord->period_frames << 8) | taskRecord->load);
+        checkWord ^= (uint16_t) (taskRecord->numRuns >> 16);
+        checkWord ^= (uint16_t) taskRecord->numRuns;
+        checkWord = (uint16_t) ((checkWord << 1) | (checkWord >> 15));
+        checkWord ^= (uint16_t) (taskRecord->lastExecution_ticks >> 16);
+        checkWord ^= (uint16_t) taskRecord->lastExecution_ticks;
+        checkWord = (uint16_t) ((checkWord << 1) | (checkWord >> 15));
+        checkWord ^= (uint16_t) (taskRecord->maxExecution_ticks >> 16);
+        checkWord ^= (uint16_t) taskRecord->maxExecution_ticks;
+        checkWord = (uint16_t) ((checkWord << 1) | (checkWord >> 15));
+    }
+    return checkWord;
+}
+#CalculateCheckWord
+
+#IsRecordValid
+/* Function: IsRecordValid
+ *
+ * Description: Checks a record against its check word, which rejects the
+ *      random contents of persistent RAM after a power up.
+ *
+ * Return: True if the record is valid
+ */
+static bool IsRecordValid( const FrameScheduleRecord * const record )
+{
+    return (CalculateCheckWord( record ) == record->checkWord);
+}
+#IsRecordValid
+
+#GetRecord
+/* Function: GetRecord
+ *
+ * Description: Maps a record ID to its record.
+ *
+ * Return: Pointer to the record, NULL if the record ID is invalid
+ */
+static const FrameScheduleRecord * GetRecord( const FrameScheduleRecordId recordId )
+{
+    const FrameScheduleRecord * record = NULL;
+
+    if (FRAME_SCHEDULE_CURRENT_RUN == recordId)
+    {
+        record = &currentRun;
+    }
+    else if (FRAME_SCHEDULE_LAST_RUN == recordId)
+    {
+        record = &lastRun;
+    }
+    return record;
+}
+#GetRecord
+
+#WriteUint32
+/* Function: WriteUint32
+ *
+ * Description: Writes a 32 bit value to a frame, MSB first.
+ *
+ * Return: Number of bytes written
+ */
+static uint16_t WriteUint32( uint8_t * const frame,
+                             const uint32_t value )
+{
+    frame[0] = (uint8_t) (value >> 24);
+    frame[1] = (uint8_t) (value >> 16);
+    frame[2] = (uint8_t) (value >> 8);
+    frame[3] = (uint8_t) value;
+    return 4u;
+}
+#WriteUint32
+/* End of FrameSchedule.c source file */
@@ -0,0 +1,111 @@
+/*
+ * Filename: FrameSchedule.h
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: External interface for the 100 Hz frame schedule. A schedule
+ *      is a const table of tasks, each run every period frames on a given
+ *      phase. The schedule repeats every FRAME_SCHEDULE_HYPERPERIOD_FRAMES
+ *      frames, so its load can be checked frame by frame at build time with
+ *      FRAME_SCHEDULE_IS_BALANCED. The measured execution time of each task is
+ *      kept in a record, next to its table load, for maintenance mode.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+#ifndef FRAME_SCHEDULE_H
+#define FRAME_SCHEDULE_H
+
+/**************  Included Files **************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/**************  Macro Definitions ***********************/
+#define FRAME_SCHEDULE_HYPERPERIOD_FRAMES 60u /* Every task period must divide this */
+#define FRAME_SCHEDULE_MAX_RECORDED_TASKS 6u /* Tasks kept in the execution record. Any further tasks are run but not recorded. */
+#define FRAME_SCHEDULE_FRAME_HEADER 0xE0u /* First byte of a serialized frame schedule record */
+#define FRAME_SCHEDULE_TASK_RECORD_SIZE (2u + (3u * 4u)) /* Serialized bytes per task */
+#define FRAME_SCHEDULE_FRAME_SIZE (4u + (FRAME_SCHEDULE_MAX_RECORDED_TASKS * FRAME_SCHEDULE_TASK_RECORD_SIZE))
+
+/* Build time schedule checks. A schedule is written once as a list macro taking
+ * an entry macro and a frame number, with one ENTRY( frame, task, period, phase, load )
+ * per task, and expanded into both the table and these checks. See main.c. */
+
+/* Load an entry adds to the given frame of the hyperperiod */
+#define FRAME_SCHEDULE_ENTRY_LOAD(frame, task, period, phase, load) \
+    + ((((frame) % (period)) == (phase)) ? (load) : 0)
+
+/* Non-zero if an entry's period does not divide the hyperperiod or its phase is out of range */
+#define FRAME_SCHEDULE_ENTRY_INVALID(frame, task, period, phase, load) \
+    + ((((period) == 0) || ((FRAME_SCHEDULE_HYPERPERIOD_FRAMES % (period)) != 0) || ((phase) >= (period))) ? 1 : 0)
+
+/* Table initializer for an entry */
+#define FRAME_SCHEDULE_ENTRY_TASK(frame, task, period, phase, load) \
+    { task, period, phase, load },
+
+/* True if no frame of the hyperperiod loads more than maxLoad. frameLoad( frame ) is the schedule's frame load macro. */
+#define FRAME_SCHEDULE_FRAMES_FIT(frameLoad, first, maxLoad) \
+    ((frameLoad((first) + 0) <= (maxLoad)) && (frameLoad((first) + 1) <= (maxLoad)) && \
+     (frameLoad((first) + 2) <= (maxLoad)) && (frameLoad((first) + 3) <= (maxLoad)) && \
+     (frameLoad((first) + 4) <= (maxLoad)) && (frameLoad((first) + 5) <= (maxLoad)) && \
+     (frameLoad((first) + 6) <= (maxLoad)) && (frameLoad((first) + 7) <= (maxLoad)) && \
+     (frameLoad((first) + 8) <= (maxLoad)) && (frameLoad((first) + 9) <= (maxLoad)))
+
+#define FRAME_SCHEDULE_IS_BALANCED(frameLoad, maxLoad) \
+    (FRAME_SCHEDULE_FRAMES_FIT(frameLoad, 0, maxLoad) && FRAME_SCHEDULE_FRAMES_FIT(frameLoad, 10, maxLoad) && \
+     FRAME_SCHEDULE_FRAMES_FIT(frameLoad, 20, maxLoad) && FRAME_SCHEDULE_FRAMES_FIT(frameLoad, 30, maxLoad) && \
+     FRAME_SCHEDULE_FRAMES_FIT(frameLoad, 40, maxLoad) && FRAME_SCHEDULE_FRAMES_FIT(frameLoad, 50, maxLoad))
+
+#if (FRAME_SCHEDULE_HYPERPERIOD_FRAMES != 60u)
+#error "FRAME_SCHEDULE_IS_BALANCED checks 60 frames"
+#endif
+
+
+/**************  Type Definitions ************************/
+/* Schedule entry, kept in program memory. The task runs on frames where frame % period_frames == phase_frames. */
+typedef struct
+{
+    void (*run)(void); /* Task function */
+    uint8_t period_frames; /* Frames between runs */
+    uint8_t phase_frames; /* Frame within the period the task runs on */
+    uint8_t load; /* Worst case load the task adds to its frame, in the schedule's load unit */
+} FrameScheduleTask;
+
+/* Run time state and execution statistics of one task */
+typedef struct
+{
+    uint8_t framesUntilDue; /* Frames left before the task runs again */
+    uint32_t numRuns;
+    uint32_t lastExecution_ticks; /* Execution time of the latest run in Timer23 ticks */
+    uint32_t maxExecution_ticks; /* Longest execution time in Timer23 ticks */
+} FrameScheduleTaskState;
+
+typedef enum
+{
+    FRAME_SCHEDULE_CURRENT_RUN = 0, /* Task executions since this boot */
+    FRAME_SCHEDULE_LAST_RUN /* Task executions of the previous boot, kept through a reset */
+} FrameScheduleRecordId;
+
+
+/**************  Function Prototypes *********************/
+void FrameSchedule_InitializeRecord(void);
+
+void FrameSchedule_Initialize(const FrameScheduleTask * const tasks,
+        FrameScheduleTaskState * const states, /* One per task */
+        const size_t numTasks);
+
+void FrameSchedule_RunFrame(const FrameScheduleTask * const tasks,
+        FrameScheduleTaskState * const states, /* One per task */
+        const size_t numTasks);
+
+uint16_t FrameSchedule_SerializeRecord(const FrameScheduleRecordId recordId,
+        uint8_t * const frame, /* Buffer for the serialized record */
+        const uint16_t frameSize); /* Size of the buffer */
+
+
+#endif
+/* End of FrameSchedule.h header file*/
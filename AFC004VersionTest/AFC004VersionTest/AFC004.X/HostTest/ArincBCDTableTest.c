@@ -0,0 +1,324 @@
+/*
+ * Filename: ArincBCDTableTest.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Host test and benchmark of the two digit BCD tables in
+ *      ARINC_common.c. Every entry of the packed BCD byte to binary table
+ *      (all 256 bytes, so every two digit value 0-99 and every invalid digit)
+ *      and of the binary 0-99 to packed BCD table is checked against the one
+ *      digit at a time conversion. The BCD decode, validity check and encode
+ *      functions are then checked against their previous one digit
+ *      implementations: every raw pattern of 1 to 5 digits, plus a digit of
+ *      extra high bits, and every value of each digit count and most
+ *      significant character width, up to past its clipping limit. The cost
+ *      per decoded and encoded word is printed for both.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include <stdlib.h>
+#include "HostTest.h"
+#include "ARINC_common.c"
+
+
+/**************  Macro Definitions ***********************/
+#define NUM_PAIR_BYTES 256u
+#define NUM_BENCH_WORDS 4096u
+#define NUM_BENCH_PASSES 500u
+#define TEST_RESOLUTION 0.1f
+
+
+/**************  Variable Definitions ********************/
+static uint32_t benchBCDwords[NUM_BENCH_WORDS];
+static float benchEngValues[NUM_BENCH_WORDS];
+
+
+/**************  Function Definitions ********************/
+/* Packed BCD byte to binary, one digit at a time. BCD_PAIR_INVALID if either digit is not a BCD digit. */
+static uint8_t Reference_BCDpairToBinary( const uint8_t pair )
+{
+    const uint8_t lowDigit = pair & 0xFu;
+    const uint8_t highDigit = pair >> ARINC429_BCD_BITS_PER_DIGIT;
+    if ((lowDigit > ARINC429_BCD_MAX_DIGIT_VAL) || (highDigit > ARINC429_BCD_MAX_DIGIT_VAL))
+    {
+        return BCD_PAIR_INVALID;
+    }
+    return (uint8_t) (highDigit * 10u + lowDigit);
+}
+
+/* Previous one digit at a time integer to BCD conversion */
+static uint32_t Reference_ConvertIntToBCD( const size_t numDigits,
+                                           uint32_t value )
+{
+    uint32_t asBCD = 0;
+    size_t count = 0;
+    while ((value > 0) &&
+            (count < numDigits))
+    {
+        asBCD += (value % 10) << (ARINC429_BCD_BITS_PER_DIGIT * count);
+        value /= 10;
+        count++;
+    }
+    return asBCD;
+}
+
+/* Previous one digit at a time BCD decode */
+static int32_t Reference_BCD_ConvertBCDvalToEngVal( const size_t numSigDigits,
+                                                    const float resolution,
+                                                    float * const dataEng,
+                                                    const uint32_t rawBCDdata )
+{
+    uint32_t calcValue = 0;
+    uint32_t tempVal = rawBCDdata;
+    size_t count = 0;
+    uint32_t multVal = 1;
+    uint32_t thisDigit;
+    while ((tempVal > 0) &&
+            (count < numSigDigits))
+    {
+        thisDigit = tempVal & 0xF;
+        if (thisDigit > ARINC429_BCD_MAX_DIGIT_VAL)
+        {
+            break;
+        }
+        calcValue += multVal * thisDigit;
+        tempVal >>= ARINC429_BCD_BITS_PER_DIGIT;
+        multVal *= 10;
+        count++;
+    }
+
+    *dataEng = (0 == tempVal) ? (float) calcValue * resolution : 0.0f;
+    return (0 == tempVal) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* Previous one digit at a time BCD validity check */
+static bool Reference_BCD_IsBCDvalValid( const size_t numSigDigits,
+                                         const uint32_t rawBCDdata )
+{
+    if (0 != (rawBCDdata >> (ARINC429_BCD_BITS_PER_DIGIT * numSigDigits)))
+    {
+        return false;
+    }
+
+    uint32_t tempVal = rawBCDdata;
+    while (tempVal > 0)
+    {
+        if ((tempVal & 0xF) > ARINC429_BCD_MAX_DIGIT_VAL)
+        {
+            return false;
+        }
+        tempVal >>= ARINC429_BCD_BITS_PER_DIGIT;
+    }
+    return true;
+}
+
+/* Previous one digit at a time BCD encode, clipping when a digit is left over or the MSC overflows its bits */
+static void Reference_BCD_ConvertEngValToBCD( const size_t numSigDigits,
+                                              const float resolution,
+                                              const size_t numBitsMSC,
+                                              const float dataEng,
+                                              uint32_t * const rawBCDdata,
+                                              bool * const isDataClipped )
+{
+    float calcValue = (resolution != 0.0f) ? (dataEng / resolution) : 0.0f;
+    uint32_t tempValue = (uint32_t) min( calcValue + 0.5f, UINT32_MAX );
+    uint32_t asBCD = 0;
+    size_t count = 0;
+    uint32_t thisDigit;
+    while ((tempValue > 0) &&
+            (count < numSigDigits))
+    {
+        thisDigit = tempValue % 10;
+        if ((numSigDigits == (count + 1)) &&
+                (thisDigit > (UINT32_MAX >> (NUM_BITS_IN_UINT32 - numBitsMSC))))
+        {
+            break;
+        }
+        asBCD += thisDigit << (ARINC429_BCD_BITS_PER_DIGIT * count);
+        tempValue /= 10;
+        count++;
+    }
+
+    *isDataClipped = (0 != tempValue);
+    if (0 != tempValue)
+    {
+        asBCD = 0;
+        for (count = 0; count < numSigDigits; count++)
+        {
+            thisDigit = (count != (numSigDigits - 1)) ? ARINC429_BCD_MAX_DIGIT_VAL : (UINT32_MAX >> (NUM_BITS_IN_UINT32 - numBitsMSC));
+            asBCD += thisDigit << (ARINC429_BCD_BITS_PER_DIGIT * count);
+        }
+    }
+    *rawBCDdata = asBCD;
+    return;
+}
+
+/* Function: CheckTables
+ *
+ * Description: Checks every entry of both pair tables against the one digit
+ *      conversions.
+ *
+ * Return: None (void)
+ */
+static void CheckTables( void )
+{
+    uint32_t pair;
+    for (pair = 0; pair < NUM_PAIR_BYTES; pair++)
+    {
+        HOST_TEST_CHECK( Reference_BCDpairToBinary( (uint8_t) pair ) == bcdPairToBinary[pair], "pair %02X: %02X expected, %02X in table",
+                         pair, Reference_BCDpairToBinary( (uint8_t) pair ), bcdPairToBinary[pair] );
+    }
+
+    uint32_t value;
+    for (value = 0; value < BCD_PAIR_RADIX; value++)
+    {
+        const uint32_t expectedPair = Reference_ConvertIntToBCD( BCD_DIGITS_PER_PAIR, value );
+        HOST_TEST_CHECK( (expectedPair == binaryToBCDpair[value]) && (value == bcdPairToBinary[binaryToBCDpair[value]]),
+                         "value %u: %02X expected, %02X in table", value, expectedPair, binaryToBCDpair[value] );
+    }
+    return;
+}
+
+/* Function: CheckDecode
+ *
+ * Description: Checks the decode and validity check of every raw pattern of
+ *      numSigDigits digits and a digit of extra high bits.
+ *
+ * Return: None (void)
+ */
+static void CheckDecode( const size_t numSigDigits )
+{
+    const uint32_t numPatterns = (uint32_t) 1 << (ARINC429_BCD_BITS_PER_DIGIT * (numSigDigits + 1));
+    uint32_t raw;
+    for (raw = 0; raw < numPatterns; raw++)
+    {
+        float refEng;
+        float newEng;
+        const int32_t refStatus = Reference_BCD_ConvertBCDvalToEngVal( numSigDigits, TEST_RESOLUTION, &refEng, raw );
+        const int32_t newStatus = ARINC429_BCD_ConvertBCDvalToEngVal( numSigDigits, TEST_RESOLUTION, &newEng, raw );
+        HOST_TEST_CHECK( (refStatus == newStatus) && (refEng == newEng), "%zu digits, raw %06X: %d/%g expected, %d/%g",
+                         numSigDigits, raw, refStatus, refEng, newStatus, newEng );
+        HOST_TEST_CHECK( Reference_BCD_IsBCDvalValid( numSigDigits, raw ) == ARINC429_BCD_IsBCDvalValid( numSigDigits, raw ),
+                         "%zu digits, raw %06X: validity differs", numSigDigits, raw );
+    }
+    return;
+}
+
+/* Function: CheckEncode
+ *
+ * Description: Checks the encode of every value of numSigDigits digits, and
+ *      the values half way between them, up to past the clipping limit.
+ *
+ * Return: None (void)
+ */
+static void CheckEncode( const size_t numSigDigits,
+                         const size_t numBitsMSC )
+{
+    uint32_t limit = 1;
+    size_t count;
+    for (count = 0; count < numSigDigits; count++)
+    {
+        limit *= 10u;
+    }
+
+    uint32_t value;
+    for (value = 0; value < limit; value++)
+    {
+        HOST_TEST_CHECK( Reference_ConvertIntToBCD( numSigDigits, value ) == ARINC429_BCD_ConvertIntToBCD( numSigDigits, value ),
+                         "%zu digits, %u: integer conversion differs", numSigDigits, value );
+    }
+
+    for (value = 0; value < limit + 10u; value++)
+    {
+        const float engValues[] = { (float) value, (float) value + 0.5f };
+        size_t engIdx;
+        for (engIdx = 0; engIdx < sizeof (engValues) / sizeof (engValues[0]); engIdx++)
+        {
+            uint32_t refBCD;
+            uint32_t newBCD;
+            bool isRefClipped;
+            bool isNewClipped;
+            Reference_BCD_ConvertEngValToBCD( numSigDigits, 1.0f, numBitsMSC, engValues[engIdx], &refBCD, &isRefClipped );
+            const int32_t newStatus = ARINC429_BCD_ConvertEngValToBCD( numSigDigits, 1.0f, numBitsMSC, engValues[engIdx], &newBCD, &isNewClipped );
+            HOST_TEST_CHECK( (EXIT_SUCCESS == newStatus) && (refBCD == newBCD) && (isRefClipped == isNewClipped),
+                             "%zu digits, %zu MSC bits, %.1f: %05X/%d expected, %05X/%d", numSigDigits, numBitsMSC, engValues[engIdx],
+                             refBCD, isRefClipped, newBCD, isNewClipped );
+        }
+    }
+    return;
+}
+
+int main( void )
+{
+    size_t numSigDigits;
+    size_t numBitsMSC;
+
+    CheckTables( );
+    for (numSigDigits = 1; numSigDigits <= ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS; numSigDigits++)
+    {
+        CheckDecode( numSigDigits );
+        for (numBitsMSC = 1; numBitsMSC <= ARINC429_BCD_BITS_PER_DIGIT; numBitsMSC++)
+        {
+            CheckEncode( numSigDigits, numBitsMSC );
+        }
+    }
+
+    /* Cost per 5 digit word, decoded and encoded */
+    uint32_t count;
+    srand( 1 );
+    for (count = 0; count < NUM_BENCH_WORDS; count++)
+    {
+        const uint32_t value = (uint32_t) rand( ) % 80000u;
+        benchBCDwords[count] = Reference_ConvertIntToBCD( ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS, value );
+        benchEngValues[count] = (float) value * TEST_RESOLUTION;
+    }
+
+    double cost_ns[4];
+    int testIdx;
+    for (testIdx = 0; testIdx < 4; testIdx++)
+    {
+        uint32_t pass;
+        const double start_ns = HostTest_Now_ns( );
+        for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+        {
+            for (count = 0; count < NUM_BENCH_WORDS; count++)
+            {
+                float engData;
+                uint32_t bcdWord;
+                bool isClipped;
+                switch (testIdx)
+                {
+                    case 0:
+                        hostTestSink += (uint32_t) Reference_BCD_ConvertBCDvalToEngVal( ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS, TEST_RESOLUTION,
+                                                                                       &engData, benchBCDwords[count] ) + (uint32_t) engData;
+                        break;
+                    case 1:
+                        hostTestSink += (uint32_t) ARINC429_BCD_ConvertBCDvalToEngVal( ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS, TEST_RESOLUTION,
+                                                                                      &engData, benchBCDwords[count] ) + (uint32_t) engData;
+                        break;
+                    case 2:
+                        Reference_BCD_ConvertEngValToBCD( ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS, TEST_RESOLUTION, ARINC429_BCD_STD_MSG_MAX_NUM_BITS_MSC,
+                                                          benchEngValues[count], &bcdWord, &isClipped );
+                        hostTestSink += bcdWord;
+                        break;
+                    default:
+                        (void) ARINC429_BCD_ConvertEngValToBCD( ARINC429_BCD_STD_MSG_MAX_NUM_SIGDIGITS, TEST_RESOLUTION, ARINC429_BCD_STD_MSG_MAX_NUM_BITS_MSC,
+                                                                benchEngValues[count], &bcdWord, &isClipped );
+                        hostTestSink += bcdWord;
+                        break;
+                }
+            }
+        }
+        cost_ns[testIdx] = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_PASSES * NUM_BENCH_WORDS);
+    }
+
+    printf( "  5 digit word: decode %.2f ns one digit, %.2f ns two digit; encode %.2f ns one digit, %.2f ns two digit\n",
+            cost_ns[0], cost_ns[1], cost_ns[2], cost_ns[3] );
+    return HostTest_Report( );
+}
+/* End of ArincBCDTableTest.c source file */
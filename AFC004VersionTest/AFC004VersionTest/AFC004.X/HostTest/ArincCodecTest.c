@@ -0,0 +1,316 @@
+/*
+ * Filename: ArincCodecTest.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Host test and benchmark of the ARINC fixed-point transmit
+ *      codecs. For every configured BNR and BCD label (received and
+ *      transmitted), every representable raw data field value is decoded to
+ *      engineering units as a receive does, which must be bit-identical to 
+ *      the float multiply by the resolution, and encoded back into a word with
+ *      the label's codec and with the float conversion used without one. The
+ *      neighbouring floats, the half way points between raw values and a few
+ *      clipped values past each end of the data field are encoded too. The
+ *      words and write statuses must be bit-identical (for NaN, which the
+ *      float conversion casts to an integer, only the statuses). Each BNR 
+ *      value's fixed-point range check must pass exactly when the word 
+ *      encoded in float is not clipped and decodes within the valid range. The
+ *      transmit codecs set up by SetupTransmitLabelCodecs must be in use, and
+ *      a label whose codec cannot be set up must be left without one. The
+ *      host divides in hardware, so its encode timings do not show the cost
+ *      of the dsPIC software float division the codecs remove.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include "HostTest.h"
+#include "ARINC.c"
+#include "ARINC_common.c"
+#include "AFC004MessageConfig.c"
+#include "COMTrigModule.c"
+#include "COMIIRDifferentiator.c"
+#include "COMIIRFilter.c"
+#include "calculateNewARINCLabels.c"
+
+
+/**************  Macro Definitions ***********************/
+#define MAX_TEST_LABELS 64u
+#define NUM_CLIPPED_RAW_VALUES 4 /* Raw values encoded past each end of the data field */
+#define NUM_BENCH_PASSES 4u
+
+
+/**************  Variable Definitions ********************/
+static const ARINC429_LabelConfig * testConfigs[MAX_TEST_LABELS];
+static size_t numTestConfigs = 0;
+static unsigned long numEncodedValues = 0;
+static unsigned long numRangeChecks = 0;
+static unsigned long numRoundedIntoRange = 0; /* Out of the valid range in float, in range once rounded to the word */
+
+
+/**************  Function Definitions ********************/
+/* Timer23 stand-ins, the receive timestamps are not used */
+uint32_t Timer23_GetTimestamp_ticks( void )
+{
+    return 0;
+}
+
+uint32_t Timer23_ConvertMsToTicks( const uint32_t milliseconds )
+{
+    return milliseconds;
+}
+
+/* Adds the BNR and BCD labels of a configuration table */
+static void AddTestConfigs( const ARINC429_LabelConfig * const configs,
+                            const size_t numConfigs )
+{
+    size_t count;
+    for (count = 0; count < numConfigs; count++)
+    {
+        if (((ARINC429_STD_BNR_MSG == configs[count].msgType) || (ARINC429_STD_BCD_MSG == configs[count].msgType)) &&
+                (numTestConfigs < MAX_TEST_LABELS))
+        {
+            testConfigs[numTestConfigs++] = &configs[count];
+        }
+    }
+    return;
+}
+
+/* Assembles a word of the configured type */
+static ARINC429_WriteMsgReturnStatus AssembleWord( const ARINC429_TxMsg * const txMsg,
+                                                   uint32_t * const word )
+{
+    return (ARINC429_STD_BNR_MSG == txMsg->msgConfig->msgType) ?
+            ARINC429_AssembleStdBNRmessage( txMsg, word ) : ARINC429_AssembleStdBCDmessage( txMsg, word );
+}
+
+/* Function: CheckRange
+ *
+ * Description: Checks the fixed-point range check of a BNR value against the
+ *      word encoded in float: in range when the word is not clipped and its
+ *      data decodes within the valid range.
+ *
+ * Return: None (void)
+ */
+static void CheckRange( const ARINC429_LabelConfig * const config,
+                        const ARINC429_LabelCodec * const codec,
+                        const float engData )
+{
+    uint32_t rawValue;
+    bool isDataClipped;
+    float transmitted;
+
+    (void) ARINC429_BNR_ConvertEngValToRawBNRmsgData( config->numSigBits, config->resolution, engData, &rawValue, &isDataClipped );
+    (void) ARINC429_BNR_ConvertRawMsgDataToEngUnits( config->numSigBits, config->resolution, &transmitted,
+                                                     rawValue & (UINT32_MAX >> (NUM_BITS_IN_UINT32 - 1u - config->numSigBits)) );
+    const bool isExpectedInRange = !isDataClipped &&
+            (transmitted >= config->minValidValue) && (transmitted <= config->maxValidValue);
+    const bool isInRange = ARINC429_BNR_IsEngValInValidRangeFixedPoint( codec, engData );
+
+    HOST_TEST_CHECK( isExpectedInRange == isInRange, "label %02X, %.9g: range check %d, expected %d",
+                     config->label, engData, isInRange, isExpectedInRange );
+    if (isInRange && ((engData < config->minValidValue) || (engData > config->maxValidValue)))
+    {
+        numRoundedIntoRange++;
+    }
+    numRangeChecks++;
+    return;
+}
+
+/* Function: CheckEncode
+ *
+ * Description: Encodes one value with and without the codec and compares the
+ *      words and statuses.
+ *
+ * Return: None (void)
+ */
+static void CheckEncode( ARINC429_TxMsg * const txMsg,
+                         const ARINC429_LabelCodec * const codec,
+                         const float engData )
+{
+    uint32_t floatWord = 0;
+    uint32_t codecWord = 0;
+
+    txMsg->engData = engData;
+    txMsg->codec = NULL;
+    const ARINC429_WriteMsgReturnStatus floatStatus = AssembleWord( txMsg, &floatWord );
+    txMsg->codec = codec;
+    const ARINC429_WriteMsgReturnStatus codecStatus = AssembleWord( txMsg, &codecWord );
+
+    HOST_TEST_CHECK( (floatStatus == codecStatus) && (floatWord == codecWord),
+                     "label %02X, %.9g: float %08X/%d, codec %08X/%d",
+                     txMsg->msgConfig->label, engData, floatWord, floatStatus, codecWord, codecStatus );
+    numEncodedValues++;
+
+    if (ARINC429_STD_BNR_MSG == txMsg->msgConfig->msgType)
+    {
+        CheckRange( txMsg->msgConfig, codec, engData );
+    }
+    return;
+}
+
+/* Function: CheckLabel
+ *
+ * Description: Checks the codec of one label over every raw value of its data
+ *      field and the values around them.
+ *
+ * Return: None (void)
+ */
+static void CheckLabel( const ARINC429_LabelConfig * const config )
+{
+    static const float specialValues[] = { 0.0f, -0.0f, FLT_MIN / 2.0f, FLT_MIN, FLT_MAX, -FLT_MAX, INFINITY, -INFINITY };
+    ARINC429_LabelCodec codec;
+    ARINC429_TxMsg txMsg = {
+        .msgConfig = config,
+        .SM = ARINC429_SSM_BNR_NORMAL_OPERATION,
+        .SDI = 0,
+        .discreteBits = 0
+    };
+
+    HOST_TEST_CHECK( EXIT_SUCCESS == ARINC429_InitializeLabelCodec( config, &codec ), "label %02X: codec init failed", config->label );
+
+    int32_t rawValue;
+    for (rawValue = codec.minRaw - NUM_CLIPPED_RAW_VALUES; rawValue <= codec.maxRaw + NUM_CLIPPED_RAW_VALUES; rawValue++)
+    {
+        /* Raw values in the data field are decoded as a receive does */
+        float engData = (float) rawValue * config->resolution;
+        if ((rawValue >= codec.minRaw) && (rawValue <= codec.maxRaw))
+        {
+            if (ARINC429_STD_BNR_MSG == config->msgType)
+            {
+                (void) ARINC429_BNR_ConvertRawMsgDataToEngUnits( config->numSigBits, config->resolution, &engData,
+                                                                 (uint32_t) rawValue & (UINT32_MAX >> (NUM_BITS_IN_UINT32 - 1u - config->numSigBits)) );
+            }
+            else
+            {
+                (void) ARINC429_BCD_ConvertBCDvalToEngVal( config->numSigDigits, config->resolution, &engData,
+                                                           ARINC429_BCD_ConvertIntToBCD( config->numSigDigits, (uint32_t) rawValue ) );
+            }
+
+            /* The integer decode must give the float multiply's result, bit for bit */
+            const float product = (float) rawValue * config->resolution;
+            HOST_TEST_CHECK( 0 == memcmp( &engData, &product, sizeof (float) ), "label %02X, raw %ld: decoded %.9g, float %.9g",
+                             config->label, (long) rawValue, engData, product );
+        }
+
+        CheckEncode( &txMsg, &codec, engData );
+        CheckEncode( &txMsg, &codec, nextafterf( engData, INFINITY ) );
+        CheckEncode( &txMsg, &codec, nextafterf( engData, -INFINITY ) );
+        CheckEncode( &txMsg, &codec, ((float) rawValue + 0.5f) * config->resolution );
+    }
+
+    size_t count;
+    for (count = 0; count < sizeof (specialValues) / sizeof (specialValues[0]); count++)
+    {
+        CheckEncode( &txMsg, &codec, specialValues[count] );
+    }
+
+    /* The float conversion casts NaN to int32_t, which is undefined, so only the statuses are compared */
+    uint32_t word;
+    txMsg.engData = NAN;
+    txMsg.codec = NULL;
+    const ARINC429_WriteMsgReturnStatus floatStatus = AssembleWord( &txMsg, &word );
+    txMsg.codec = &codec;
+    const ARINC429_WriteMsgReturnStatus codecStatus = AssembleWord( &txMsg, &word );
+    HOST_TEST_CHECK( floatStatus == codecStatus, "label %02X, NaN: status float %d, codec %d", config->label, floatStatus, codecStatus );
+    if (ARINC429_STD_BNR_MSG == config->msgType)
+    {
+        HOST_TEST_CHECK( !ARINC429_BNR_IsEngValInValidRangeFixedPoint( &codec, NAN ), "label %02X, NaN in range", config->label );
+    }
+    return;
+}
+
+/* Function: BenchmarkEncode
+ *
+ * Description: Times the encoding of every raw value of the transmitted
+ *      labels, with and without their codecs.
+ *
+ * Return: Cost per encoded word in ns
+ */
+static double BenchmarkEncode( const bool isCodecUsed )
+{
+    const ARINC429_LabelConfig * const configs[] = {
+        &arincLabel250Config, &arincLabel340Config, &arincLabel332Config, &Eclipse_ARINCLabel320Config,
+        &Eclipse_ARINCLabel324Config, &Eclipse_ARINClabel325Config, &Eclipse_ARINClabel333Config, &arincLabel235Config
+    };
+    const ARINC429_LabelCodec * const codecs[] = {
+        arincLabel250TxCodec, arincLabel340TxCodec, arincLabel332TxCodec, Eclipse_ARINCLabel320TxCodec,
+        Eclipse_ARINCLabel324TxCodec, Eclipse_ARINClabel325TxCodec, Eclipse_ARINClabel333TxCodec, arincLabel235TxCodec
+    };
+    unsigned long numWords = 0;
+    uint32_t pass;
+    size_t labelIdx;
+
+    double start_ns = HostTest_Now_ns( );
+    for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+    {
+        for (labelIdx = 0; labelIdx < sizeof (configs) / sizeof (configs[0]); labelIdx++)
+        {
+            ARINC429_TxMsg txMsg = {
+                .msgConfig = configs[labelIdx],
+                .codec = isCodecUsed ? codecs[labelIdx] : NULL,
+                .SM = ARINC429_SSM_BNR_NORMAL_OPERATION
+            };
+            int32_t rawValue;
+            for (rawValue = codecs[labelIdx]->minRaw; rawValue <= codecs[labelIdx]->maxRaw; rawValue++)
+            {
+                uint32_t word;
+                txMsg.engData = (float) rawValue * configs[labelIdx]->resolution;
+                hostTestSink += (uint32_t) AssembleWord( &txMsg, &word ) + word;
+                numWords++;
+            }
+        }
+    }
+    return (HostTest_Now_ns( ) - start_ns) / (double) numWords;
+}
+
+int main( void )
+{
+    /* The transmitted words are set up to use their codecs */
+    HOST_TEST_CHECK( SetupTransmitLabelCodecs( ), "transmit codec setup failed" );
+    HOST_TEST_CHECK( (&arincLabel250Codec == arincLabel250TxCodec) && (&arincLabel340Codec == arincLabel340TxCodec) &&
+                     (&arincLabel332Codec == arincLabel332TxCodec) && (&Eclipse_ARINCLabel320Codec == Eclipse_ARINCLabel320TxCodec) &&
+                     (&Eclipse_ARINCLabel324Codec == Eclipse_ARINCLabel324TxCodec) && (&Eclipse_ARINClabel325Codec == Eclipse_ARINClabel325TxCodec) &&
+                     (&Eclipse_ARINClabel333Codec == Eclipse_ARINClabel333TxCodec) && (&arincLabel235Codec == arincLabel235TxCodec),
+                     "transmit codec not in use" );
+
+    /* A label whose codec cannot be set up is left without one, and encoded in float */
+    ARINC429_LabelConfig negativeResolutionConfig = arincLabel250Config;
+    ARINC429_LabelCodec negativeResolutionCodec;
+    negativeResolutionConfig.resolution = -negativeResolutionConfig.resolution;
+    HOST_TEST_CHECK( NULL == SetupTransmitLabelCodec( &negativeResolutionConfig, &negativeResolutionCodec ), "invalid codec set up" );
+
+    /* Every configured BNR and BCD label */
+    AddTestConfigs( arincWordsRxFromRS422ADC, arincADCarray.numMsgs );
+    AddTestConfigs( arincWordsRxFromAHR75, arincAHR75array.numMsgs );
+    AddTestConfigs( arincWordsRxFromPFD, arincPFDarray.numMsgs );
+    AddTestConfigs( &arincLabel250Config, 1 );
+    AddTestConfigs( &arincLabel340Config, 1 );
+    AddTestConfigs( &arincLabel332Config, 1 );
+    AddTestConfigs( &arincLabel333Config, 1 );
+    AddTestConfigs( &Eclipse_ARINCLabel320Config, 1 );
+    AddTestConfigs( &Eclipse_ARINCLabel324Config, 1 );
+    AddTestConfigs( &Eclipse_ARINClabel325Config, 1 );
+    AddTestConfigs( &Eclipse_ARINClabel333Config, 1 );
+    AddTestConfigs( &arincLabel235Config, 1 );
+
+    size_t count;
+    for (count = 0; count < numTestConfigs; count++)
+    {
+        CheckLabel( testConfigs[count] );
+    }
+    printf( "  %zu labels, %lu values encoded\n", numTestConfigs, numEncodedValues );
+    printf( "  %lu BNR range checks, %lu rounded into the valid range\n", numRangeChecks, numRoundedIntoRange );
+
+    const double floatCost_ns = BenchmarkEncode( false );
+    const double codecCost_ns = BenchmarkEncode( true );
+    printf( "  transmit word encode: %.2f ns float, %.2f ns codec\n", floatCost_ns, codecCost_ns );
+    return HostTest_Report( );
+}
+/* End of ArincCodecTest.c source file */
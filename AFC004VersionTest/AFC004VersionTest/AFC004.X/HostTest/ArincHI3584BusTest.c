@@ -0,0 +1,224 @@
+/*
+ * Filename: ArincHI3584BusTest.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Host test of the HI-3584 16-bit data bus access through the
+ *      port-grouped pin map in ARINC_HI3584.c. For every one of the 65536 bus
+ *      values, the pin-map write, read and direction functions are checked
+ *      against the previous bit-by-bit implementation, which drove each DBxx
+ *      pin through its own bitfield. The other pins of each port hold random
+ *      values, which both implementations must leave untouched.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include <stdlib.h>
+#include "HostTest.h"
+#include "HostSFR.h"
+#include "ARINC_HI3584.c"
+
+
+/**************  Macro Definitions ***********************/
+#define NUM_BUS_VALUES 65536u
+#define NUM_BENCH_PASSES 50u
+
+
+/**************  Function Definitions ********************/
+/* Timer23 stand-ins, used only by the loopback test */
+uint32_t Timer23_GetTimestamp_ticks( void )
+{
+    return 0;
+}
+
+uint32_t Timer23_ConvertMsToTicks( const uint32_t milliseconds )
+{
+    return milliseconds;
+}
+
+/* Previous bit-by-bit bus direction configuration */
+static void Reference_Config16bitDataBusDirection( const ARINC429_HI3584_DataBusDir busDirection )
+{
+    uint16_t trisVal = (ARINC429_HI3584_DATA_DIR_INPUT == busDirection) ? 1 : 0;
+    DB00_TRIS = trisVal;
+    DB01_TRIS = trisVal;
+    DB02_TRIS = trisVal;
+    DB03_TRIS = trisVal;
+    DB04_TRIS = trisVal;
+    DB05_TRIS = trisVal;
+    DB06_TRIS = trisVal;
+    DB07_TRIS = trisVal;
+    DB08_TRIS = trisVal;
+    DB09_TRIS = trisVal;
+    DB10_TRIS = trisVal;
+    DB11_TRIS = trisVal;
+    DB12_TRIS = trisVal;
+    DB13_TRIS = trisVal;
+    DB14_TRIS = trisVal;
+    DB15_TRIS = trisVal;
+    return;
+}
+
+/* Previous bit-by-bit bus write */
+static void Reference_WriteDataTo16bitDataBus( const uint16_t dataBusWriteValue )
+{
+    DB00_WRITE = dataBusWriteValue & 1;
+    DB01_WRITE = ((dataBusWriteValue >> 1) & 1);
+    DB02_WRITE = ((dataBusWriteValue >> 2) & 1);
+    DB03_WRITE = ((dataBusWriteValue >> 3) & 1);
+    DB04_WRITE = ((dataBusWriteValue >> 4) & 1);
+    DB05_WRITE = ((dataBusWriteValue >> 5) & 1);
+    DB06_WRITE = ((dataBusWriteValue >> 6) & 1);
+    DB07_WRITE = ((dataBusWriteValue >> 7) & 1);
+    DB08_WRITE = ((dataBusWriteValue >> 8) & 1);
+    DB09_WRITE = ((dataBusWriteValue >> 9) & 1);
+    DB10_WRITE = ((dataBusWriteValue >> 10) & 1);
+    DB11_WRITE = ((dataBusWriteValue >> 11) & 1);
+    DB12_WRITE = ((dataBusWriteValue >> 12) & 1);
+    DB13_WRITE = ((dataBusWriteValue >> 13) & 1);
+    DB14_WRITE = ((dataBusWriteValue >> 14) & 1);
+    DB15_WRITE = ((dataBusWriteValue >> 15) & 1);
+    return;
+}
+
+/* Previous bit-by-bit bus read */
+static uint16_t Reference_ReadDataFrom16bitDataBus( void )
+{
+    uint16_t busRead = (DB15_READ & 1);
+    busRead = (busRead << 1) | (DB14_READ & 1);
+    busRead = (busRead << 1) | (DB13_READ & 1);
+    busRead = (busRead << 1) | (DB12_READ & 1);
+    busRead = (busRead << 1) | (DB11_READ & 1);
+    busRead = (busRead << 1) | (DB10_READ & 1);
+    busRead = (busRead << 1) | (DB09_READ & 1);
+    busRead = (busRead << 1) | (DB08_READ & 1);
+    busRead = (busRead << 1) | (DB07_READ & 1);
+    busRead = (busRead << 1) | (DB06_READ & 1);
+    busRead = (busRead << 1) | (DB05_READ & 1);
+    busRead = (busRead << 1) | (DB04_READ & 1);
+    busRead = (busRead << 1) | (DB03_READ & 1);
+    busRead = (busRead << 1) | (DB02_READ & 1);
+    busRead = (busRead << 1) | (DB01_READ & 1);
+    busRead = (busRead << 1) | (DB00_READ & 1);
+    return busRead;
+}
+
+/* Drives a bus value onto the PORT pins, as the transceiver would */
+static void Reference_DriveBusPins( const uint16_t busValue )
+{
+    PORTCbits.RC1 = busValue & 1;
+    PORTCbits.RC2 = (busValue >> 1) & 1;
+    PORTCbits.RC3 = (busValue >> 2) & 1;
+    PORTCbits.RC4 = (busValue >> 3) & 1;
+    PORTAbits.RA12 = (busValue >> 4) & 1;
+    PORTAbits.RA13 = (busValue >> 5) & 1;
+    PORTBbits.RB6 = (busValue >> 6) & 1;
+    PORTBbits.RB7 = (busValue >> 7) & 1;
+    PORTAbits.RA9 = (busValue >> 8) & 1;
+    PORTAbits.RA10 = (busValue >> 9) & 1;
+    PORTBbits.RB8 = (busValue >> 10) & 1;
+    PORTBbits.RB9 = (busValue >> 11) & 1;
+    PORTBbits.RB10 = (busValue >> 12) & 1;
+    PORTBbits.RB11 = (busValue >> 13) & 1;
+    PORTBbits.RB12 = (busValue >> 14) & 1;
+    PORTBbits.RB13 = (busValue >> 15) & 1;
+    return;
+}
+
+static uint16_t RandomWord( void )
+{
+    return (uint16_t) rand( );
+}
+
+int main( void )
+{
+    uint32_t busValue;
+
+    srand( 1 );
+    for (busValue = 0; busValue < NUM_BUS_VALUES; busValue++)
+    {
+        /* Write: same LAT registers from the same starting pins */
+        const uint16_t latA = RandomWord( );
+        const uint16_t latB = RandomWord( );
+        const uint16_t latC = RandomWord( );
+
+        LATA = latA;
+        LATB = latB;
+        LATC = latC;
+        Reference_WriteDataTo16bitDataBus( (uint16_t) busValue );
+        const uint16_t refLatA = LATA;
+        const uint16_t refLatB = LATB;
+        const uint16_t refLatC = LATC;
+
+        LATA = latA;
+        LATB = latB;
+        LATC = latC;
+        WriteDataTo16bitDataBus( (uint16_t) busValue );
+        HOST_TEST_CHECK( (refLatA == LATA) && (refLatB == LATB) && (refLatC == LATC),
+                         "write %04X: LATA %04X/%04X LATB %04X/%04X LATC %04X/%04X",
+                         busValue, refLatA, LATA, refLatB, LATB, refLatC, LATC );
+
+        /* Read: the bus value back, whatever the other pins hold */
+        PORTA = RandomWord( );
+        PORTB = RandomWord( );
+        PORTC = RandomWord( );
+        Reference_DriveBusPins( (uint16_t) busValue );
+        const uint16_t refRead = Reference_ReadDataFrom16bitDataBus( );
+        const uint16_t newRead = ReadDataFrom16bitDataBus( );
+        HOST_TEST_CHECK( (busValue == refRead) && (refRead == newRead), "read %04X: %04X/%04X", busValue, refRead, newRead );
+
+        /* Direction: both directions from the same starting TRIS registers */
+        const ARINC429_HI3584_DataBusDir busDirection = (busValue & 1) ? ARINC429_HI3584_DATA_DIR_INPUT : ARINC429_HI3584_DATA_BUS_DIR_OUTPUT;
+        const uint16_t trisA = RandomWord( );
+        const uint16_t trisB = RandomWord( );
+        const uint16_t trisC = RandomWord( );
+
+        TRISA = trisA;
+        TRISB = trisB;
+        TRISC = trisC;
+        Reference_Config16bitDataBusDirection( busDirection );
+        const uint16_t refTrisA = TRISA;
+        const uint16_t refTrisB = TRISB;
+        const uint16_t refTrisC = TRISC;
+
+        TRISA = trisA;
+        TRISB = trisB;
+        TRISC = trisC;
+        Config16bitDataBusDirection( busDirection );
+        HOST_TEST_CHECK( (refTrisA == TRISA) && (refTrisB == TRISB) && (refTrisC == TRISC),
+                         "direction %d: TRISA %04X/%04X TRISB %04X/%04X TRISC %04X/%04X",
+                         busDirection, refTrisA, TRISA, refTrisB, TRISB, refTrisC, TRISC );
+    }
+
+    /* Host cost of a bus write and read, bit-by-bit against pin map */
+    double start_ns = HostTest_Now_ns( );
+    uint32_t pass;
+    for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+    {
+        for (busValue = 0; busValue < NUM_BUS_VALUES; busValue++)
+        {
+            Reference_WriteDataTo16bitDataBus( (uint16_t) busValue );
+            hostTestSink += Reference_ReadDataFrom16bitDataBus( );
+        }
+    }
+    const double refCost_ns = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_PASSES * NUM_BUS_VALUES);
+
+    start_ns = HostTest_Now_ns( );
+    for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+    {
+        for (busValue = 0; busValue < NUM_BUS_VALUES; busValue++)
+        {
+            WriteDataTo16bitDataBus( (uint16_t) busValue );
+            hostTestSink += ReadDataFrom16bitDataBus( );
+        }
+    }
+    const double newCost_ns = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_PASSES * NUM_BUS_VALUES);
+
+    printf( "  bus write + read: %.2f ns bit-by-bit, %.2f ns pin map\n", refCost_ns, newCost_ns );
+    return HostTest_Report( );
+}
+/* End of ArincHI3584BusTest.c source file */
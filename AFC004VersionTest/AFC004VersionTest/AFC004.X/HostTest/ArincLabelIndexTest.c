@@ -0,0 +1,216 @@
+/*
+ * Filename: ArincLabelIndexTest.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Host test and benchmark of the ARINC receive message array
+ *      label index. Receive arrays of 16, 32 and 64 labels are fed the same
+ *      word stream through the label index and through the linear label
+ *      search used before the index is built (the search every word and read
+ *      used to make). The stored receive states and read results must match,
+ *      and the cost per received word and per label read is printed for both.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include <stdlib.h>
+#include <string.h>
+#include "HostTest.h"
+#include "ARINC.c"
+#include "ARINC_common.c"
+
+
+/**************  Macro Definitions ***********************/
+#define MAX_TEST_LABELS 64u
+#define NUM_STREAM_WORDS 4096u
+#define NUM_BENCH_PASSES 500u
+#define TEST_TICKS_PER_MS 114u
+
+
+/**************  Variable Definitions ********************/
+static uint32_t hostTimer_ticks = 0;
+static uint32_t wordStream[NUM_STREAM_WORDS];
+
+
+/**************  Function Definitions ********************/
+/* Timer23 stand-ins: the clock advances one tick per timestamp */
+uint32_t Timer23_GetTimestamp_ticks( void )
+{
+    return hostTimer_ticks++;
+}
+
+uint32_t Timer23_ConvertMsToTicks( const uint32_t milliseconds )
+{
+    return milliseconds * TEST_TICKS_PER_MS;
+}
+
+/* Function: ConfigureLabels
+ *
+ * Description: Fills numLabels BNR label configurations with distinct labels
+ *      spread over the 8-bit label range.
+ *
+ * Return: None (void)
+ */
+static void ConfigureLabels( ARINC429_LabelConfig * const configs,
+                             const size_t numLabels )
+{
+    size_t count;
+    memset( configs, 0, numLabels * sizeof (ARINC429_LabelConfig) );
+    for (count = 0; count < numLabels; count++)
+    {
+        configs[count].label = (uint8_t) (count * 37u + 3u);
+        configs[count].msgType = ARINC429_STD_BNR_MSG;
+        configs[count].numSigBits = 18;
+        configs[count].resolution = 0.0625f;
+        configs[count].maxValidValue = 1000.0f;
+        configs[count].minValidValue = -1000.0f;
+        configs[count].minTransmitInterval_ms = 10;
+        configs[count].maxTransmitInterval_ms = 60;
+    }
+    return;
+}
+
+/* Function: BuildWordStream
+ *
+ * Description: Fills the word stream with random words, one in eight of them
+ *      for a label that is not configured.
+ *
+ * Return: None (void)
+ */
+static void BuildWordStream( const ARINC429_LabelConfig * const configs,
+                             const size_t numLabels )
+{
+    size_t count;
+    for (count = 0; count < NUM_STREAM_WORDS; count++)
+    {
+        uint32_t word = ((uint32_t) rand( ) << 16) ^ (uint32_t) rand( );
+        uint8_t label = (0 == (count & 7u)) ? (uint8_t) (count * 37u + 4u) : configs[(size_t) rand( ) % numLabels].label;
+        wordStream[count] = (word & ~ARINC429_LBL_MASK) | label;
+    }
+    return;
+}
+
+/* Function: RunLabelCount
+ *
+ * Description: Checks and times one array size.
+ *
+ * Return: None (void)
+ */
+static void RunLabelCount( const size_t numLabels )
+{
+    static ARINC429_LabelConfig configs[MAX_TEST_LABELS];
+    static ARINC429_RxMsgState linearStates[MAX_TEST_LABELS];
+    static ARINC429_RxMsgState indexedStates[MAX_TEST_LABELS];
+    static uint8_t linearIndex[ARINC429_NUM_LABELS];
+    static uint8_t indexedIndex[ARINC429_NUM_LABELS];
+
+    ConfigureLabels( configs, numLabels );
+    BuildWordStream( configs, numLabels );
+    memset( linearStates, 0, sizeof (linearStates) );
+    memset( indexedStates, 0, sizeof (indexedStates) );
+
+    ARINC429_RxMsgArray linearArray = {
+        .numMsgs = numLabels,
+        .msgConfigs = configs,
+        .msgStates = linearStates,
+        .labelIndex = linearIndex,
+        .maxBusFailureCounts = 10u
+    };
+    ARINC429_RxMsgArray indexedArray = {
+        .numMsgs = numLabels,
+        .msgConfigs = configs,
+        .msgStates = indexedStates,
+        .labelIndex = indexedIndex,
+        .maxBusFailureCounts = 10u
+    };
+
+    HOST_TEST_CHECK( ARINC429_InitializeRxMsgArray( &linearArray ), "%zu labels: init failed", numLabels );
+    HOST_TEST_CHECK( ARINC429_InitializeRxMsgArray( &indexedArray ), "%zu labels: init failed", numLabels );
+    linearArray.isLabelIndexBuilt = false; // Search linearly, as every word did before the index
+
+    /* Both lookups must store the same receive states */
+    size_t count;
+    for (count = 0; count < NUM_STREAM_WORDS; count++)
+    {
+        const uint32_t startTicks = hostTimer_ticks;
+        ARINC429_ReadMsgReturnStatus linearStatus = ARINC429_ProcessReceivedMessage( &linearArray, wordStream[count] );
+        hostTimer_ticks = startTicks;
+        ARINC429_ReadMsgReturnStatus indexedStatus = ARINC429_ProcessReceivedMessage( &indexedArray, wordStream[count] );
+        HOST_TEST_CHECK( linearStatus == indexedStatus, "%zu labels: word %08X status %d/%d",
+                         numLabels, wordStream[count], linearStatus, indexedStatus );
+    }
+    HOST_TEST_CHECK( 0 == memcmp( linearStates, indexedStates, sizeof (linearStates) ), "%zu labels: receive states differ", numLabels );
+
+    /* Every label value must read the same through both lookups */
+    uint16_t label;
+    for (label = 0; label < ARINC429_NUM_LABELS; label++)
+    {
+        const ARINC429_RxMsgData * linearData;
+        const ARINC429_RxMsgData * indexedData;
+        uint8_t linearFlags;
+        uint8_t indexedFlags;
+        const uint32_t startTicks = hostTimer_ticks;
+        ARINC429_GetLabelDataReturnStatus linearStatus = ARINC429_GetLatestLabelData( &linearArray, label, &linearData, &linearFlags );
+        hostTimer_ticks = startTicks;
+        ARINC429_GetLabelDataReturnStatus indexedStatus = ARINC429_GetLatestLabelData( &indexedArray, label, &indexedData, &indexedFlags );
+        HOST_TEST_CHECK( (linearStatus == indexedStatus) && (linearFlags == indexedFlags) &&
+                         (0 == memcmp( linearData, indexedData, sizeof (ARINC429_RxMsgData) )),
+                         "%zu labels: label %02X read differs", numLabels, label );
+    }
+
+    /* Cost per received word and per label read */
+    double wordCost_ns[2];
+    double readCost_ns[2];
+    ARINC429_RxMsgArray * const arrays[2] = { &linearArray, &indexedArray };
+    size_t arrayIdx;
+    for (arrayIdx = 0; arrayIdx < 2; arrayIdx++)
+    {
+        size_t pass;
+        double start_ns = HostTest_Now_ns( );
+        for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+        {
+            for (count = 0; count < NUM_STREAM_WORDS; count++)
+            {
+                hostTestSink += (uint32_t) ARINC429_ProcessReceivedMessage( arrays[arrayIdx], wordStream[count] );
+            }
+        }
+        wordCost_ns[arrayIdx] = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_PASSES * NUM_STREAM_WORDS);
+
+        start_ns = HostTest_Now_ns( );
+        for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+        {
+            for (count = 0; count < NUM_STREAM_WORDS; count++)
+            {
+                const ARINC429_RxMsgData * data;
+                uint8_t flags;
+                hostTestSink += (uint32_t) ARINC429_GetLatestRawLabelData( arrays[arrayIdx],
+                                                                           wordStream[count] & ARINC429_LBL_MASK,
+                                                                           &data,
+                                                                           &flags );
+            }
+        }
+        readCost_ns[arrayIdx] = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_PASSES * NUM_STREAM_WORDS);
+    }
+
+    printf( "  %2zu labels: receive %6.2f ns/word linear, %6.2f ns/word indexed; read %6.2f ns linear, %6.2f ns indexed\n",
+            numLabels, wordCost_ns[0], wordCost_ns[1], readCost_ns[0], readCost_ns[1] );
+    return;
+}
+
+int main( void )
+{
+    static const size_t labelCounts[] = { 16u, 32u, 64u };
+    size_t count;
+
+    srand( 1 );
+    for (count = 0; count < sizeof (labelCounts) / sizeof (labelCounts[0]); count++)
+    {
+        RunLabelCount( labelCounts[count] );
+    }
+    return HostTest_Report( );
+}
+/* End of ArincLabelIndexTest.c source file */
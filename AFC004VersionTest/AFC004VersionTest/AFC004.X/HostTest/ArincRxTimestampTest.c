@@ -0,0 +1,321 @@
+/*
+ * Filename: ArincRxTimestampTest.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Host test and benchmark of the ARINC receive timestamps. The
+ *      receive path (babbling check) and the read path (freshness check) are
+ *      run through Timer23.c, with the timer registers set by the test, and
+ *      compared with the previous millisecond paths, which divided the timer
+ *      count on every received word and label read and compared against the
+ *      millisecond transmit intervals of the label configuration. Away from
+ *      the interval boundaries both must give the same statuses; across the
+ *      32-bit timer roll over the tick paths must still measure the elapsed
+ *      time. The cost per received word and per label read is printed for
+ *      both. The host divides in hardware, so these timings understate the
+ *      cost of the dsPIC 32/32 software division the tick paths removed.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include <stdlib.h>
+#include <string.h>
+#include "HostTest.h"
+#include "HostSFR.h"
+#include "Timer23.c"
+#include "ARINC.c"
+#include "ARINC_common.c"
+
+
+/**************  Macro Definitions ***********************/
+#define NUM_TEST_LABELS 32u
+#define NUM_STREAM_WORDS 4096u
+#define NUM_BENCH_PASSES 500u
+#define NUM_INTERVAL_CHECKS 100000u
+#define TEST_T2CON 0x8038u
+#define TEST_TICKS_PER_MS 114u
+#define TEST_MIN_TRANSMIT_INTERVAL_MS 10u
+#define TEST_MAX_TRANSMIT_INTERVAL_MS 60u
+#define TIMER_TICKS_PER_WORD 37u
+
+
+/**************  Variable Definitions ********************/
+static uint32_t wordStream[NUM_STREAM_WORDS];
+
+
+/**************  Function Definitions ********************/
+/* Loads the Timer23 count registers */
+static void SetTimerCount( const uint32_t count )
+{
+    TMR3HLD = (uint16_t) (count >> 16);
+    TMR2 = (uint16_t) count;
+    return;
+}
+
+/* Previous receive path. The receipt time is kept in milliseconds, in the sysTimeLastGoodMsg_ticks field. */
+static ARINC429_ReadMsgReturnStatus Reference_ProcessReceivedMessage( ARINC429_RxMsgArray * const rxMsgArray,
+                                                                      const uint32_t ARINCMsg )
+{
+    ARINC429_ReadMsgReturnStatus readMsgReturnStatus = ARINC429_READ_MSG_ERROR_NO_MATCHING_LABEL;
+    const uint8_t slot = ARINC429_FindRxMsgSlot( rxMsgArray, (uint8_t) (ARINCMsg & ARINC429_LBL_MASK) );
+
+    if (ARINC429_LABEL_INDEX_NO_SLOT != slot)
+    {
+        const ARINC429_LabelConfig * const msgConfig = &(rxMsgArray->msgConfigs[slot]);
+        ARINC429_RxMsgState * const msgState = &(rxMsgArray->msgStates[slot]);
+
+        readMsgReturnStatus = ARINC429_CheckReceivedMessage( msgConfig, ARINCMsg );
+        if (ARINC429_READ_MSG_SUCCESS == readMsgReturnStatus)
+        {
+            uint32_t timestamp_now_ms = Timer23_GetTimestamp_ms( );
+            uint32_t elapsedTime = timestamp_now_ms - msgState->data.sysTimeLastGoodMsg_ticks;
+
+            msgState->data.isNotBabbling = (elapsedTime >= msgConfig->minTransmitInterval_ms);
+            msgState->data.sysTimeLastGoodMsg_ticks = timestamp_now_ms;
+            msgState->data.rawARINCword = ARINCMsg;
+            msgState->data.isDecoded = false;
+        }
+    }
+    return readMsgReturnStatus;
+}
+
+/* Previous read path statuses, from the millisecond receipt time */
+static ARINC429_GetLabelDataReturnStatus Reference_GetLatestLabelState( const ARINC429_RxMsgArray * const rxMsgArray,
+                                                                        const arincLabel hexFlippedLabel,
+                                                                        uint8_t * const slot,
+                                                                        uint8_t * const rxFlags )
+{
+    *slot = (hexFlippedLabel < ARINC429_NUM_LABELS) ?
+            ARINC429_FindRxMsgSlot( rxMsgArray, (uint8_t) hexFlippedLabel ) : ARINC429_LABEL_INDEX_NO_SLOT;
+    if (ARINC429_LABEL_INDEX_NO_SLOT == *slot)
+    {
+        return ARINC429_GET_LABEL_DATA_ERROR_NO_MATCHING_LABEL;
+    }
+
+    const ARINC429_RxMsgState * const msgState = &(rxMsgArray->msgStates[*slot]);
+    uint32_t elapsedTime_ms = Timer23_GetTimestamp_ms( ) - msgState->data.sysTimeLastGoodMsg_ticks;
+    uint8_t flags = 0;
+
+    if (elapsedTime_ms <= rxMsgArray->msgConfigs[*slot].maxTransmitInterval_ms)
+    {
+        flags |= ARINC429_RX_FLAG_FRESH;
+    }
+    if (msgState->data.isNotBabbling)
+    {
+        flags |= ARINC429_RX_FLAG_NOT_BABBLING;
+    }
+    if (msgState->data.isEngDataInBounds)
+    {
+        flags |= ARINC429_RX_FLAG_ENG_DATA_IN_BOUNDS;
+    }
+    *rxFlags = flags;
+    return ARINC429_GET_LABEL_DATA_MSG_SUCCESS;
+}
+
+/* Function: ConfigureLabels
+ *
+ * Description: Fills the BNR label configurations with distinct labels spread
+ *      over the 8-bit label range.
+ *
+ * Return: None (void)
+ */
+static void ConfigureLabels( ARINC429_LabelConfig * const configs )
+{
+    size_t count;
+    memset( configs, 0, NUM_TEST_LABELS * sizeof (ARINC429_LabelConfig) );
+    for (count = 0; count < NUM_TEST_LABELS; count++)
+    {
+        configs[count].label = (uint8_t) (count * 37u + 3u);
+        configs[count].msgType = ARINC429_STD_BNR_MSG;
+        configs[count].numSigBits = 18;
+        configs[count].resolution = 0.0625f;
+        configs[count].maxValidValue = 1000.0f;
+        configs[count].minValidValue = -1000.0f;
+        configs[count].minTransmitInterval_ms = TEST_MIN_TRANSMIT_INTERVAL_MS;
+        configs[count].maxTransmitInterval_ms = TEST_MAX_TRANSMIT_INTERVAL_MS;
+    }
+    return;
+}
+
+/* Function: ReceiveAndRead
+ *
+ * Description: Receives one word of the first label at receiveCount and reads
+ *      the label at readCount, through the tick paths and the previous
+ *      millisecond paths.
+ *
+ * Return: None (void)
+ */
+static void ReceiveAndRead( ARINC429_RxMsgArray * const tickArray,
+                            ARINC429_RxMsgArray * const msArray,
+                            const uint32_t receiveCount,
+                            const uint32_t readCount,
+                            uint8_t * const tickFlags,
+                            uint8_t * const msFlags )
+{
+    const uint32_t word = tickArray->msgConfigs[0].label;
+    uint8_t slot;
+
+    /* A first word at receiveCount, so the second one there is checked for babbling against it */
+    tickArray->msgStates[0].data.sysTimeLastGoodMsg_ticks = receiveCount - tickArray->msgStates[0].maxTransmitInterval_ticks;
+    msArray->msgStates[0].data.sysTimeLastGoodMsg_ticks = (receiveCount / TEST_TICKS_PER_MS) - TEST_MAX_TRANSMIT_INTERVAL_MS;
+    SetTimerCount( receiveCount );
+    (void) ARINC429_ProcessReceivedMessage( tickArray, word );
+    (void) Reference_ProcessReceivedMessage( msArray, word );
+
+    /* The second word, babbling if it arrives inside the minimum transmit interval */
+    SetTimerCount( readCount );
+    (void) ARINC429_ProcessReceivedMessage( tickArray, word );
+    (void) Reference_ProcessReceivedMessage( msArray, word );
+    tickArray->msgStates[0].data.sysTimeLastGoodMsg_ticks = receiveCount;
+    msArray->msgStates[0].data.sysTimeLastGoodMsg_ticks = receiveCount / TEST_TICKS_PER_MS;
+
+    /* Freshness at readCount of the word received at receiveCount */
+    (void) ARINC429_GetLatestLabelState( tickArray, word, &slot, tickFlags );
+    (void) Reference_GetLatestLabelState( msArray, word, &slot, msFlags );
+    return;
+}
+
+int main( void )
+{
+    static ARINC429_LabelConfig configs[NUM_TEST_LABELS];
+    static ARINC429_RxMsgState tickStates[NUM_TEST_LABELS];
+    static ARINC429_RxMsgState msStates[NUM_TEST_LABELS];
+    static uint8_t tickIndex[ARINC429_NUM_LABELS];
+    static uint8_t msIndex[ARINC429_NUM_LABELS];
+    const uint32_t minInterval_ticks = TEST_MIN_TRANSMIT_INTERVAL_MS * TEST_TICKS_PER_MS;
+    const uint32_t maxInterval_ticks = TEST_MAX_TRANSMIT_INTERVAL_MS * TEST_TICKS_PER_MS;
+    uint32_t count;
+
+    Timer23_Initialize( TEST_T2CON, 0xFFFFFFFFu, TEST_TICKS_PER_MS );
+    ConfigureLabels( configs );
+
+    ARINC429_RxMsgArray tickArray = {
+        .numMsgs = NUM_TEST_LABELS,
+        .msgConfigs = configs,
+        .msgStates = tickStates,
+        .labelIndex = tickIndex,
+        .maxBusFailureCounts = 10u
+    };
+    ARINC429_RxMsgArray msArray = {
+        .numMsgs = NUM_TEST_LABELS,
+        .msgConfigs = configs,
+        .msgStates = msStates,
+        .labelIndex = msIndex,
+        .maxBusFailureCounts = 10u
+    };
+    HOST_TEST_CHECK( ARINC429_InitializeRxMsgArray( &tickArray ), "tick array init failed" );
+    HOST_TEST_CHECK( ARINC429_InitializeRxMsgArray( &msArray ), "millisecond array init failed" );
+    HOST_TEST_CHECK( (minInterval_ticks == tickStates[0].minTransmitInterval_ticks) &&
+                     (maxInterval_ticks == tickStates[0].maxTransmitInterval_ticks),
+                     "intervals %u/%u ticks", tickStates[0].minTransmitInterval_ticks, tickStates[0].maxTransmitInterval_ticks );
+
+    /* Timer reads: the raw count, and the count divided by the scale factor */
+    srand( 1 );
+    for (count = 0; count < NUM_INTERVAL_CHECKS; count++)
+    {
+        const uint32_t timerCount = ((uint32_t) rand( ) << 16) ^ (uint32_t) rand( );
+        SetTimerCount( timerCount );
+        HOST_TEST_CHECK( (timerCount == Timer23_GetTimestamp_ticks( )) &&
+                         ((timerCount / TEST_TICKS_PER_MS) == Timer23_GetTimestamp_ms( )),
+                         "count %08X: %08X ticks, %u ms", timerCount, Timer23_GetTimestamp_ticks( ), Timer23_GetTimestamp_ms( ) );
+    }
+
+    /* Babbling and freshness away from roll over. The statuses are exact in ticks; the millisecond
+     * paths may only differ within a millisecond of an interval boundary, where they truncated. */
+    for (count = 0; count < NUM_INTERVAL_CHECKS; count++)
+    {
+        const uint32_t receiveCount = (((uint32_t) rand( ) << 16) ^ (uint32_t) rand( )) & 0x7FFFFFFFu;
+        const uint32_t elapsed_ticks = (uint32_t) rand( ) % (2u * maxInterval_ticks);
+        const bool isFresh = (elapsed_ticks <= maxInterval_ticks);
+        const bool isNotBabbling = (elapsed_ticks >= minInterval_ticks);
+        uint8_t tickFlags;
+        uint8_t msFlags;
+
+        ReceiveAndRead( &tickArray, &msArray, receiveCount, receiveCount + elapsed_ticks, &tickFlags, &msFlags );
+        HOST_TEST_CHECK( (isFresh == (0 != (tickFlags & ARINC429_RX_FLAG_FRESH))) &&
+                         (isNotBabbling == (0 != (tickFlags & ARINC429_RX_FLAG_NOT_BABBLING))),
+                         "received %08X, %u ticks later: flags %02X", receiveCount, elapsed_ticks, tickFlags );
+
+        const bool isNearBoundary = ((elapsed_ticks + TEST_TICKS_PER_MS > minInterval_ticks) && (elapsed_ticks < minInterval_ticks + TEST_TICKS_PER_MS)) ||
+                ((elapsed_ticks + TEST_TICKS_PER_MS > maxInterval_ticks) && (elapsed_ticks < maxInterval_ticks + TEST_TICKS_PER_MS));
+        HOST_TEST_CHECK( isNearBoundary || (tickFlags == msFlags), "received %08X, %u ticks later: flags %02X ticks, %02X ms",
+                         receiveCount, elapsed_ticks, tickFlags, msFlags );
+    }
+
+    /* Across the timer roll over only the tick paths measure the elapsed time */
+    {
+        const uint32_t receiveCount = 0xFFFFFFFFu - (minInterval_ticks / 2u);
+        uint8_t tickFlags;
+        uint8_t msFlags;
+
+        ReceiveAndRead( &tickArray, &msArray, receiveCount, receiveCount + minInterval_ticks, &tickFlags, &msFlags );
+        HOST_TEST_CHECK( ARINC429_RX_FLAGS_VALID == (tickFlags & ARINC429_RX_FLAGS_VALID), "roll over: flags %02X", tickFlags );
+        printf( "  roll over, one minimum interval after receipt: flags %02X ticks, %02X ms\n", tickFlags, msFlags );
+    }
+
+    /* Cost per received word and per label read, each word one step further on the timer */
+    for (count = 0; count < NUM_STREAM_WORDS; count++)
+    {
+        uint32_t word = ((uint32_t) rand( ) << 16) ^ (uint32_t) rand( );
+        wordStream[count] = (word & ~ARINC429_LBL_MASK) | configs[(size_t) rand( ) % NUM_TEST_LABELS].label;
+    }
+
+    uint32_t timerCount = 0;
+    uint32_t pass;
+    double start_ns = HostTest_Now_ns( );
+    for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+    {
+        for (count = 0; count < NUM_STREAM_WORDS; count++)
+        {
+            SetTimerCount( timerCount += TIMER_TICKS_PER_WORD );
+            hostTestSink += (uint32_t) Reference_ProcessReceivedMessage( &msArray, wordStream[count] );
+        }
+    }
+    const double refReceiveCost_ns = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_PASSES * NUM_STREAM_WORDS);
+
+    start_ns = HostTest_Now_ns( );
+    for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+    {
+        for (count = 0; count < NUM_STREAM_WORDS; count++)
+        {
+            SetTimerCount( timerCount += TIMER_TICKS_PER_WORD );
+            hostTestSink += (uint32_t) ARINC429_ProcessReceivedMessage( &tickArray, wordStream[count] );
+        }
+    }
+    const double newReceiveCost_ns = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_PASSES * NUM_STREAM_WORDS);
+
+    start_ns = HostTest_Now_ns( );
+    for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+    {
+        for (count = 0; count < NUM_STREAM_WORDS; count++)
+        {
+            uint8_t slot;
+            uint8_t flags;
+            SetTimerCount( timerCount += TIMER_TICKS_PER_WORD );
+            hostTestSink += (uint32_t) Reference_GetLatestLabelState( &msArray, wordStream[count] & ARINC429_LBL_MASK, &slot, &flags ) + flags;
+        }
+    }
+    const double refReadCost_ns = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_PASSES * NUM_STREAM_WORDS);
+
+    start_ns = HostTest_Now_ns( );
+    for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+    {
+        for (count = 0; count < NUM_STREAM_WORDS; count++)
+        {
+            uint8_t slot;
+            uint8_t flags;
+            SetTimerCount( timerCount += TIMER_TICKS_PER_WORD );
+            hostTestSink += (uint32_t) ARINC429_GetLatestLabelState( &tickArray, wordStream[count] & ARINC429_LBL_MASK, &slot, &flags ) + flags;
+        }
+    }
+    const double newReadCost_ns = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_PASSES * NUM_STREAM_WORDS);
+
+    printf( "  receive %.2f ns/word ms, %.2f ns/word ticks; read %.2f ns ms, %.2f ns ticks\n",
+            refReceiveCost_ns, newReceiveCost_ns, refReadCost_ns, newReadCost_ns );
+    return HostTest_Report( );
+}
+/* End of ArincRxTimestampTest.c source file */
@@ -0,0 +1,178 @@
+/*
+ * Filename: BootProfileTest.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Host test of the boot stage profiler. A stub Timer23 is
+ *      advanced by a different number of ticks in each stage, starting just
+ *      below the 32 bit wrap, and the stage durations, recorded stages mask
+ *      and serialized records are checked against the ticks elapsed. The
+ *      last completed boot record must be discarded after a power up, taken
+ *      from a boot only when it reaches its first frame, kept through a boot
+ *      that stops part way (as maintenance mode does) and discarded if its
+ *      persistent contents are corrupted.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include <string.h>
+#include "HostTest.h"
+#include "BootProfile.c"
+
+
+/**************  Macro Definitions ***********************/
+#define TIMER_START_TICKS 0xFFFFF000u /* Close to the wrap, so a stage is timed across it */
+#define STAGE_TICKS_STEP 0x00012345u /* Stage n runs (n + 1) steps */
+#define POWER_UP_RAM_PATTERN 0xA5u
+
+
+/**************  Variable Definitions ********************/
+static uint32_t timer_ticks;
+
+
+/**************  Function Definitions ********************/
+/* Timer23 stand-in, advanced by the test */
+uint32_t Timer23_GetTimestamp_ticks( void )
+{
+    return timer_ticks;
+}
+
+/* Ticks the stub timer advances during a stage of the given boot */
+static uint32_t StageTicks( const uint8_t stage,
+                            const uint32_t bootNumber )
+{
+    return (STAGE_TICKS_STEP * (stage + 1u)) + bootNumber;
+}
+
+/* Function: RunBoot
+ *
+ * Description: Starts the profiler and runs the stages before stopAtStage,
+ *      advancing the stub timer by StageTicks() in each.
+ *
+ * Return: None (void)
+ */
+static void RunBoot( const uint8_t stopAtStage,
+                     const uint32_t bootNumber )
+{
+    uint8_t stage;
+
+    timer_ticks = TIMER_START_TICKS;
+    BootProfile_Start( );
+    for (stage = 0; stage < stopAtStage; stage++)
+    {
+        timer_ticks += StageTicks( stage, bootNumber );
+        BootProfile_EndStage( (BootProfileStage) stage );
+    }
+    return;
+}
+
+/* Function: CheckRecord
+ *
+ * Description: Checks the durations and the serialized frame of a record
+ *      against a boot run by RunBoot, with the first numStages stages timed.
+ *
+ * Return: None (void)
+ */
+static void CheckRecord( const BootProfileRecordId recordId,
+                         const uint8_t numStages,
+                         const uint32_t bootNumber )
+{
+    uint8_t frame[BOOT_PROFILE_FRAME_SIZE];
+    uint8_t expected[BOOT_PROFILE_FRAME_SIZE];
+    const uint16_t mask = (uint16_t) ((1u << numStages) - 1u);
+    uint16_t frameIdx = 0;
+    uint8_t stage;
+
+    expected[frameIdx++] = BOOT_PROFILE_FRAME_HEADER;
+    expected[frameIdx++] = (uint8_t) recordId;
+    expected[frameIdx++] = (uint8_t) NUM_BOOT_STAGES;
+    expected[frameIdx++] = (uint8_t) (mask >> 8);
+    expected[frameIdx++] = (uint8_t) mask;
+
+    for (stage = 0; stage < NUM_BOOT_STAGES; stage++)
+    {
+        uint32_t duration_ticks = 0xDEADBEEFu;
+        const bool isTimed = (stage < numStages);
+        const uint32_t expected_ticks = isTimed ? StageTicks( stage, bootNumber ) : 0u;
+
+        HOST_TEST_CHECK( isTimed == BootProfile_GetStageDuration_ticks( recordId, (BootProfileStage) stage, &duration_ticks ),
+                         "record %d, stage %u: timed status", recordId, stage );
+        HOST_TEST_CHECK( !isTimed || (expected_ticks == duration_ticks),
+                         "record %d, stage %u: %lu ticks, expected %lu", recordId, stage,
+                         (unsigned long) duration_ticks, (unsigned long) expected_ticks );
+
+        expected[frameIdx++] = (uint8_t) (expected_ticks >> 24);
+        expected[frameIdx++] = (uint8_t) (expected_ticks >> 16);
+        expected[frameIdx++] = (uint8_t) (expected_ticks >> 8);
+        expected[frameIdx++] = (uint8_t) expected_ticks;
+    }
+
+    memset( frame, 0, sizeof (frame) );
+    const uint16_t frameSize = BootProfile_SerializeRecord( recordId, frame, sizeof (frame) );
+    HOST_TEST_CHECK( BOOT_PROFILE_FRAME_SIZE == frameSize, "record %d: frame size %u", recordId, frameSize );
+    HOST_TEST_CHECK( 0 == memcmp( frame, expected, sizeof (expected) ), "record %d: serialized frame differs", recordId );
+    return;
+}
+
+int main( void )
+{
+    uint8_t frame[BOOT_PROFILE_FRAME_SIZE];
+    uint32_t duration_ticks;
+
+    /* The stage end times must cross the 32 bit wrap */
+    HOST_TEST_CHECK( (TIMER_START_TICKS + StageTicks( 0, 1 )) < TIMER_START_TICKS, "first stage does not wrap the timer" );
+
+    /* Power up: the persistent record holds random contents and is discarded */
+    memset( &lastCompletedBoot, POWER_UP_RAM_PATTERN, sizeof (lastCompletedBoot) );
+    RunBoot( 0, 1 );
+    CheckRecord( BOOT_PROFILE_CURRENT_BOOT, 0, 1 );
+    CheckRecord( BOOT_PROFILE_LAST_COMPLETED_BOOT, 0, 1 );
+
+    /* Part way through the boot only the current record holds the stages timed so far */
+    uint8_t stage;
+    for (stage = 0; stage < (NUM_BOOT_STAGES - 1u); stage++)
+    {
+        timer_ticks += StageTicks( stage, 1 );
+        BootProfile_EndStage( (BootProfileStage) stage );
+        CheckRecord( BOOT_PROFILE_CURRENT_BOOT, stage + 1u, 1 );
+        CheckRecord( BOOT_PROFILE_LAST_COMPLETED_BOOT, 0, 1 );
+    }
+
+    /* A stage past the last is ignored */
+    BootProfile_EndStage( NUM_BOOT_STAGES );
+    CheckRecord( BOOT_PROFILE_CURRENT_BOOT, NUM_BOOT_STAGES - 1u, 1 );
+
+    /* Reaching the first frame completes the boot */
+    timer_ticks += StageTicks( BOOT_STAGE_FIRST_FRAME_WAIT, 1 );
+    BootProfile_EndStage( BOOT_STAGE_FIRST_FRAME_WAIT );
+    CheckRecord( BOOT_PROFILE_CURRENT_BOOT, NUM_BOOT_STAGES, 1 );
+    CheckRecord( BOOT_PROFILE_LAST_COMPLETED_BOOT, NUM_BOOT_STAGES, 1 );
+
+    /* A reset into maintenance mode stops after strapping. The completed boot is kept. */
+    RunBoot( BOOT_STAGE_READ_STRAPPING + 1u, 2 );
+    CheckRecord( BOOT_PROFILE_CURRENT_BOOT, BOOT_STAGE_READ_STRAPPING + 1u, 2 );
+    CheckRecord( BOOT_PROFILE_LAST_COMPLETED_BOOT, NUM_BOOT_STAGES, 1 );
+
+    /* The next completed boot replaces it */
+    RunBoot( NUM_BOOT_STAGES, 3 );
+    CheckRecord( BOOT_PROFILE_LAST_COMPLETED_BOOT, NUM_BOOT_STAGES, 3 );
+
+    /* A corrupted persistent record is discarded at the next start */
+    lastCompletedBoot.stageDuration_ticks[BOOT_STAGE_HARDWARE_SETUP] ^= 0x00010000u;
+    RunBoot( 0, 4 );
+    CheckRecord( BOOT_PROFILE_LAST_COMPLETED_BOOT, 0, 4 );
+
+    /* Invalid requests */
+    HOST_TEST_CHECK( 0 == BootProfile_SerializeRecord( BOOT_PROFILE_CURRENT_BOOT, frame, BOOT_PROFILE_FRAME_SIZE - 1u ), "short frame written" );
+    HOST_TEST_CHECK( 0 == BootProfile_SerializeRecord( (BootProfileRecordId) 2, frame, sizeof (frame) ), "invalid record ID serialized" );
+    HOST_TEST_CHECK( !BootProfile_GetStageDuration_ticks( (BootProfileRecordId) 2, BOOT_STAGE_RAM_TEST, &duration_ticks ), "invalid record ID read" );
+    HOST_TEST_CHECK( !BootProfile_GetStageDuration_ticks( BOOT_PROFILE_CURRENT_BOOT, NUM_BOOT_STAGES, &duration_ticks ), "invalid stage read" );
+
+    printf( "  %u stages, %u byte records\n", (unsigned) NUM_BOOT_STAGES, (unsigned) BOOT_PROFILE_FRAME_SIZE );
+    return HostTest_Report( );
+}
+/* End of BootProfileTest.c source file */
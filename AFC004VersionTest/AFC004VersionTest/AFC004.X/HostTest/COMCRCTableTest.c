@@ -0,0 +1,140 @@
+/*
+ * Filename: COMCRCTableTest.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Host consistency check of the precomputed CRC32 look up table
+ *      in COMCRCModule.c. The table is regenerated for
+ *      CRC32_TABLE_POLYNOMIAL_KEY with the generator that used to fill it in
+ *      RAM at boot, and every entry must match. The table driven message and
+ *      instruction CRCs are also checked against a bit at a time CRC. To
+ *      precompute a table for another key, run the test with the key as its
+ *      argument; the regenerated table is printed in the initializer's format.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include <stdlib.h>
+#include "HostTest.h"
+#include "COMCRCModule.c"
+
+
+/**************  Macro Definitions ***********************/
+#define NUM_TEST_MESSAGES 1000u
+#define MAX_MESSAGE_BYTES 256u
+#define MAX_TEST_INSTRUCTIONS 64u
+#define TABLE_ENTRIES_PER_LINE 4u
+
+
+/**************  Function Definitions ********************/
+/* Previous boot time generator, writing to the given table instead of the module's */
+static void Reference_v_Generate32BitCRCTable( u32 u32CRCPolynomialKey,
+                                               u32 * const u32paTable )
+{
+    u16 u16BitTracer;
+    u16 u16CRCTableTracer;
+    u32 u32CalculatedCRCRemainder;
+
+    for (u16CRCTableTracer = (u16) ZERO; u16CRCTableTracer <= (u16) NUMBER_255; u16CRCTableTracer++)
+    {
+        u32CalculatedCRCRemainder = ((u32) u16CRCTableTracer << (u16) SHIFT_24);
+        for (u16BitTracer = (u16) ONE; u16BitTracer <= (u16) EIGHT; u16BitTracer++)
+        {
+            if ((u32CalculatedCRCRemainder & (u32) MS_BIT) != (u32) ZERO)
+            {
+                u32CalculatedCRCRemainder = (u32CalculatedCRCRemainder << (u16) ONE) ^ u32CRCPolynomialKey;
+            }
+            else
+            {
+                u32CalculatedCRCRemainder = u32CalculatedCRCRemainder << (u16) ONE;
+            }
+        }
+        u32paTable[u16CRCTableTracer] = u32CalculatedCRCRemainder & (u32) BIT8FF;
+    }
+    return;
+}
+
+/* Bit at a time CRC of one byte, most significant bit first */
+static uint32_t Reference_UpdateCRCBitwise( uint32_t crc,
+                                            const uint8_t dataByte )
+{
+    uint8_t bit;
+    crc ^= (uint32_t) dataByte << 24;
+    for (bit = 0; bit < 8u; bit++)
+    {
+        crc = (crc & 0x80000000u) ? ((crc << 1) ^ CRC32_TABLE_POLYNOMIAL_KEY) : (crc << 1);
+    }
+    return crc;
+}
+
+int main( int argc,
+          char * argv[] )
+{
+    static u32 regeneratedTable[NUMBER_256];
+    static u8 message[MAX_MESSAGE_BYTES];
+    static u16 instructions[2u * MAX_TEST_INSTRUCTIONS];
+    uint32_t count;
+
+    /* Print the table for another key */
+    if (argc > 1)
+    {
+        Reference_v_Generate32BitCRCTable( (u32) strtoul( argv[1], NULL, 0 ), regeneratedTable );
+        for (count = 0; count < NUMBER_256; count++)
+        {
+            printf( "%s0x%08lXU%s", (0 == (count % TABLE_ENTRIES_PER_LINE)) ? "      " : "",
+                    (unsigned long) regeneratedTable[count],
+                    (count == NUMBER_255) ? "\n" : ((TABLE_ENTRIES_PER_LINE - 1u) == (count % TABLE_ENTRIES_PER_LINE)) ? " ,\n" : " , " );
+        }
+        return 0;
+    }
+
+    /* Every entry of the program memory table against the boot time generator */
+    Reference_v_Generate32BitCRCTable( CRC32_TABLE_POLYNOMIAL_KEY, regeneratedTable );
+    for (count = 0; count < NUMBER_256; count++)
+    {
+        HOST_TEST_CHECK( regeneratedTable[count] == u32aCRCTable[count], "entry %u: %08lX generated, %08lX in table",
+                         count, (unsigned long) regeneratedTable[count], (unsigned long) u32aCRCTable[count] );
+    }
+
+    /* Table driven CRCs against the bit at a time CRC */
+    srand( 1 );
+    for (count = 0; count < NUM_TEST_MESSAGES; count++)
+    {
+        const u16 numBytes = (u16) (1u + ((u16) rand( ) % MAX_MESSAGE_BYTES));
+        const uint32_t seed = ((uint32_t) rand( ) << 16) ^ (uint32_t) rand( );
+        uint32_t expectedCRC = seed;
+        u16 byteIdx;
+        for (byteIdx = 0; byteIdx < numBytes; byteIdx++)
+        {
+            message[byteIdx] = (u8) rand( );
+            expectedCRC = Reference_UpdateCRCBitwise( expectedCRC, message[byteIdx] );
+        }
+        const uint32_t messageCRC = (uint32_t) u32_Calculate32BitCRC( message, 0, (u16) (numBytes - 1u), seed );
+        HOST_TEST_CHECK( expectedCRC == messageCRC, "message %u: CRC %08X expected, %08X calculated", count, expectedCRC, messageCRC );
+
+        /* Instructions are CRCed as their 4 bytes, least significant first, with a zero phantom byte */
+        const u16 numInstructions = (u16) (1u + ((u16) rand( ) % MAX_TEST_INSTRUCTIONS));
+        u16 instructionIdx;
+        expectedCRC = seed;
+        for (instructionIdx = 0; instructionIdx < numInstructions; instructionIdx++)
+        {
+            const u16 lowerWord = (u16) (rand( ) & 0xFFFF);
+            const u16 upperWord = (u16) (rand( ) & 0xFF);
+            instructions[2u * instructionIdx] = lowerWord;
+            instructions[(2u * instructionIdx) + 1u] = upperWord;
+            expectedCRC = Reference_UpdateCRCBitwise( expectedCRC, (uint8_t) lowerWord );
+            expectedCRC = Reference_UpdateCRCBitwise( expectedCRC, (uint8_t) (lowerWord >> 8) );
+            expectedCRC = Reference_UpdateCRCBitwise( expectedCRC, (uint8_t) upperWord );
+            expectedCRC = Reference_UpdateCRCBitwise( expectedCRC, 0 );
+        }
+        const uint32_t instructionCRC = (uint32_t) u32_Calculate32BitCRCOfInstructions( instructions, numInstructions, seed );
+        HOST_TEST_CHECK( expectedCRC == instructionCRC, "instructions %u: CRC %08X expected, %08X calculated",
+                         count, expectedCRC, instructionCRC );
+    }
+    return HostTest_Report( );
+}
+/* End of COMCRCTableTest.c source file */
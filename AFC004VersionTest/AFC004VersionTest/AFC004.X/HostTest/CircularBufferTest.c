@@ -0,0 +1,367 @@
+/*
+ * Filename: CircularBufferTest.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Host test and benchmark of the mask-indexed, block copying
+ *      circular buffer in CircularBuffer.c. Two buffers are driven by the same
+ *      random sequence of pushes, pops, peeks, tail advances and flushes, one
+ *      through the current functions and one through the previous compare and
+ *      subtract, byte loop implementation. Indices, returned values and data
+ *      must match after every operation, and every byte either implementation
+ *      refuses must be counted as dropped. cb_init must reject a buffer whose
+ *      capacity is not a power of two. The cost of a push and pop and of
+ *      a message length flush in and out is printed for both.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include <stdlib.h>
+#include <string.h>
+#include "HostTest.h"
+#include "CircularBuffer.c"
+
+
+/**************  Macro Definitions ***********************/
+#define TEST_CAPACITY 128u
+#define MAX_FLUSH_BYTES 140u /* More than the capacity, to exercise the limits */
+#define NUM_TEST_OPERATIONS 3000000ul
+#define NUM_BENCH_OPERATIONS 20000000ul
+#define BENCH_FLUSH_BYTES 87u /* ADC computed data frame */
+
+
+/**************  Function Definitions ********************/
+/* Previous push: compare and subtract wrap */
+static void Reference_cb_push( circBuffer_t * const cb,
+                               const uint8_t data )
+{
+    size_t offset = cb->head + 1;
+    if (offset >= cb->capacity)
+    {
+        offset = 0;
+    }
+    if (offset != cb->tail)
+    {
+        cb->data[cb->head] = data;
+        cb->head = offset;
+    }
+    return;
+}
+
+/* Previous pop */
+static uint8_t Reference_cb_pop( circBuffer_t * const cb )
+{
+    uint8_t data;
+    if (cb->head != cb->tail)
+    {
+        data = cb->data[cb->tail];
+        cb->tail += 1;
+        if (cb->tail >= cb->capacity)
+        {
+            cb->tail -= cb->capacity;
+        }
+    }
+    else
+    {
+        data = 0;
+    }
+    return data;
+}
+
+/* Previous peek */
+static uint8_t Reference_cb_peek( const circBuffer_t * const cb,
+                                  const size_t offset )
+{
+    size_t idx = cb->tail + offset;
+    if (idx >= cb->capacity)
+    {
+        idx -= cb->capacity;
+    }
+    return cb->data[idx];
+}
+
+/* Previous bytes used */
+static size_t Reference_cb_bytesUsed( const circBuffer_t * const cb )
+{
+    return (cb->head >= cb->tail) ? cb->head - cb->tail : cb->capacity - (cb->tail - cb->head);
+}
+
+/* Previous tail advance */
+static void Reference_cb_advanceTail( circBuffer_t * const cb,
+                                      const size_t num )
+{
+    size_t maxAdvance = (cb->tail > cb->head) ? cb->head + cb->capacity - cb->tail : cb->head - cb->tail;
+    size_t advance = min( num, maxAdvance );
+    cb->tail += advance;
+    if (cb->tail >= cb->capacity)
+    {
+        cb->tail -= cb->capacity;
+    }
+    return;
+}
+
+/* Previous flush out: byte loops over the contiguous and wrapped blocks */
+static size_t Reference_cb_flushOut( circBuffer_t * const cb,
+                                     uint8_t * const destBuff,
+                                     const size_t numBytesToFlush )
+{
+    if (numBytesToFlush > cb->capacity)
+    {
+        return 0;
+    }
+
+    size_t sz = Reference_cb_bytesUsed( cb );
+    if (0 == sz)
+    {
+        return 0;
+    }
+    size_t contiguous = min( cb->capacity - cb->tail, sz );
+    size_t wrapped = sz - contiguous;
+
+    uint8_t * cbAddr = cb->data + cb->tail;
+    size_t maxCount = min( contiguous, numBytesToFlush );
+    size_t count;
+    for (count = 0; count < maxCount; count++)
+    {
+        destBuff[count] = cbAddr[count];
+    }
+
+    size_t written = maxCount;
+    Reference_cb_advanceTail( cb, maxCount );
+    if ((written != contiguous) || (0 == wrapped))
+    {
+        return written;
+    }
+
+    maxCount = min( wrapped, numBytesToFlush - contiguous );
+    cbAddr = cb->data;
+    for (count = 0; count < maxCount; count++)
+    {
+        destBuff[count + contiguous] = cbAddr[count];
+    }
+
+    written += maxCount;
+    Reference_cb_advanceTail( cb, maxCount );
+    return written;
+}
+
+/* Previous flush in: byte loops up to the tail or the end of the buffer, then from its start */
+static size_t Reference_cb_flushIn( circBuffer_t * const cb,
+                                    const uint8_t * const srcBuff,
+                                    const size_t numBytesToFlush )
+{
+    size_t numBytesReadIntoCB;
+    size_t idx;
+
+    if (cb->head < cb->tail)
+    {
+        numBytesReadIntoCB = min( cb->tail - cb->head - 1, numBytesToFlush );
+        uint8_t * cbAddr = cb->data + cb->head;
+        for (idx = 0; idx < numBytesReadIntoCB; idx++)
+        {
+            cbAddr[idx] = srcBuff[idx];
+        }
+        cb->head += numBytesReadIntoCB;
+    }
+    else
+    {
+        size_t blockSize = cb->capacity - cb->head;
+        if (0 == cb->tail)
+        {
+            blockSize--;
+        }
+
+        numBytesReadIntoCB = min( blockSize, numBytesToFlush );
+        uint8_t * cbAddr = cb->data + cb->head;
+        for (idx = 0; idx < numBytesReadIntoCB; idx++)
+        {
+            cbAddr[idx] = srcBuff[idx];
+        }
+        cb->head += numBytesReadIntoCB;
+
+        if (cb->head >= cb->capacity)
+        {
+            cb->head = 0;
+            if (0 != cb->tail)
+            {
+                size_t numBytesToRead2ndStep = min( cb->tail - 1, numBytesToFlush - numBytesReadIntoCB );
+                cbAddr = cb->data;
+                for (idx = 0; idx < numBytesToRead2ndStep; idx++)
+                {
+                    cbAddr[idx] = srcBuff[idx + numBytesReadIntoCB];
+                }
+                numBytesReadIntoCB += numBytesToRead2ndStep;
+                cb->head += numBytesToRead2ndStep;
+            }
+        }
+    }
+    return numBytesReadIntoCB;
+}
+
+/* Function: CheckInit
+ *
+ * Description: Checks that cb_init accepts only a buffer with data and a
+ *      power of two capacity, and leaves the buffer empty with its
+ *      statistics cleared either way.
+ *
+ * Return: None (void)
+ */
+static void CheckInit( void )
+{
+    static uint8_t initData[TEST_CAPACITY];
+    size_t capacity;
+
+    for (capacity = 0; capacity <= TEST_CAPACITY; capacity++)
+    {
+        circBuffer_t initBuff = { .data = initData, .capacity = capacity, .tail = 3, .head = 7,
+            .numBytesDropped = 11, .highWaterMark = 5 };
+        const bool isValid = CB_IS_POWER_OF_TWO( capacity );
+
+        HOST_TEST_CHECK( isValid == cb_init( &initBuff ), "capacity %u: cb_init returned %d", (unsigned) capacity, !isValid );
+        HOST_TEST_CHECK( (0 == initBuff.head) && (0 == initBuff.tail) && (0 == cb_bytesUsed( &initBuff )),
+                         "capacity %u: not empty after cb_init", (unsigned) capacity );
+        HOST_TEST_CHECK( (0 == cb_getNumBytesDropped( &initBuff )) && (0 == cb_getHighWaterMark( &initBuff )),
+                         "capacity %u: statistics not cleared by cb_init", (unsigned) capacity );
+    }
+
+    circBuffer_t noDataBuff = { .data = NULL, .capacity = TEST_CAPACITY };
+    HOST_TEST_CHECK( !cb_init( &noDataBuff ), "buffer without data accepted by cb_init" );
+    return;
+}
+
+int main( void )
+{
+    static uint8_t referenceData[TEST_CAPACITY];
+    static uint8_t currentData[TEST_CAPACITY];
+    static uint8_t srcBuff[MAX_FLUSH_BYTES];
+    static uint8_t referenceOut[MAX_FLUSH_BYTES];
+    static uint8_t currentOut[MAX_FLUSH_BYTES];
+    circBuffer_t referenceBuff = { .data = referenceData, .capacity = TEST_CAPACITY };
+    circBuffer_t currentBuff = { .data = currentData, .capacity = TEST_CAPACITY };
+    unsigned long expectedBytesDropped = 0;
+    unsigned long operation;
+    size_t count;
+
+    CheckInit( );
+    HOST_TEST_CHECK( cb_init( &currentBuff ), "test buffer rejected by cb_init" );
+
+    srand( 5 );
+    for (count = 0; count < MAX_FLUSH_BYTES; count++)
+    {
+        srcBuff[count] = (uint8_t) rand( );
+    }
+
+    for (operation = 0; operation < NUM_TEST_OPERATIONS; operation++)
+    {
+        const size_t numBytes = (size_t) rand( ) % MAX_FLUSH_BYTES;
+        const size_t referenceUsed = Reference_cb_bytesUsed( &referenceBuff );
+        switch (rand( ) % 6)
+        {
+            case 0:
+            {
+                const uint8_t data = (uint8_t) rand( );
+                Reference_cb_push( &referenceBuff, data );
+                cb_push( &currentBuff, data );
+                expectedBytesDropped += (referenceUsed == Reference_cb_bytesUsed( &referenceBuff )) ? 1u : 0u;
+                break;
+            }
+            case 1:
+            {
+                const uint8_t referencePop = Reference_cb_pop( &referenceBuff );
+                const uint8_t currentPop = cb_pop( &currentBuff );
+                HOST_TEST_CHECK( referencePop == currentPop, "operation %lu: pop %02X/%02X", operation, referencePop, currentPop );
+                break;
+            }
+            case 2:
+            {
+                const size_t referenceIn = Reference_cb_flushIn( &referenceBuff, srcBuff, numBytes );
+                const size_t currentIn = cb_flushIn( &currentBuff, srcBuff, numBytes );
+                HOST_TEST_CHECK( referenceIn == currentIn, "operation %lu: flush in %zu/%zu", operation, referenceIn, currentIn );
+                expectedBytesDropped += numBytes - referenceIn;
+                break;
+            }
+            case 3:
+            {
+                const size_t referenceOutBytes = Reference_cb_flushOut( &referenceBuff, referenceOut, numBytes );
+                const size_t currentOutBytes = cb_flushOut( &currentBuff, currentOut, numBytes );
+                HOST_TEST_CHECK( (referenceOutBytes == currentOutBytes) && (0 == memcmp( referenceOut, currentOut, referenceOutBytes )),
+                                 "operation %lu: flush out %zu/%zu", operation, referenceOutBytes, currentOutBytes );
+                break;
+            }
+            case 4:
+                Reference_cb_advanceTail( &referenceBuff, numBytes % 20u );
+                cb_advanceTail( &currentBuff, numBytes % 20u );
+                break;
+            default:
+                if (0 != referenceUsed)
+                {
+                    const uint8_t referencePeek = Reference_cb_peek( &referenceBuff, numBytes % referenceUsed );
+                    const uint8_t currentPeek = cb_peek( &currentBuff, numBytes % referenceUsed );
+                    HOST_TEST_CHECK( referencePeek == currentPeek, "operation %lu: peek %02X/%02X", operation, referencePeek, currentPeek );
+                }
+                break;
+        }
+
+        HOST_TEST_CHECK( (referenceBuff.head == currentBuff.head) && (referenceBuff.tail == currentBuff.tail) &&
+                         (Reference_cb_bytesUsed( &referenceBuff ) == cb_bytesUsed( &currentBuff )),
+                         "operation %lu: head %zu/%zu tail %zu/%zu", operation,
+                         referenceBuff.head, currentBuff.head, referenceBuff.tail, currentBuff.tail );
+        HOST_TEST_CHECK( expectedBytesDropped == cb_getNumBytesDropped( &currentBuff ),
+                         "operation %lu: %lu bytes refused, %u counted as dropped", operation,
+                         expectedBytesDropped, cb_getNumBytesDropped( &currentBuff ) );
+
+        /* Restart the count well before it saturates */
+        if (expectedBytesDropped > (CB_MAX_BYTES_DROPPED / 2u))
+        {
+            cb_resetStatistics( &currentBuff );
+            expectedBytesDropped = 0;
+        }
+    }
+
+    /* Host cost of a push and pop, and of a frame flushed in and out */
+    double cost_ns[4];
+    double start_ns;
+    referenceBuff.head = referenceBuff.tail = 0;
+    currentBuff.head = currentBuff.tail = 0;
+
+    start_ns = HostTest_Now_ns( );
+    for (operation = 0; operation < NUM_BENCH_OPERATIONS; operation++)
+    {
+        Reference_cb_push( &referenceBuff, (uint8_t) operation );
+        hostTestSink += Reference_cb_pop( &referenceBuff );
+    }
+    cost_ns[0] = (HostTest_Now_ns( ) - start_ns) / NUM_BENCH_OPERATIONS;
+
+    start_ns = HostTest_Now_ns( );
+    for (operation = 0; operation < NUM_BENCH_OPERATIONS; operation++)
+    {
+        cb_push( &currentBuff, (uint8_t) operation );
+        hostTestSink += cb_pop( &currentBuff );
+    }
+    cost_ns[1] = (HostTest_Now_ns( ) - start_ns) / NUM_BENCH_OPERATIONS;
+
+    start_ns = HostTest_Now_ns( );
+    for (operation = 0; operation < NUM_BENCH_OPERATIONS / 10u; operation++)
+    {
+        Reference_cb_flushIn( &referenceBuff, srcBuff, BENCH_FLUSH_BYTES );
+        hostTestSink += (uint32_t) Reference_cb_flushOut( &referenceBuff, referenceOut, BENCH_FLUSH_BYTES );
+    }
+    cost_ns[2] = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_OPERATIONS / 10u);
+
+    start_ns = HostTest_Now_ns( );
+    for (operation = 0; operation < NUM_BENCH_OPERATIONS / 10u; operation++)
+    {
+        cb_flushIn( &currentBuff, srcBuff, BENCH_FLUSH_BYTES );
+        hostTestSink += (uint32_t) cb_flushOut( &currentBuff, currentOut, BENCH_FLUSH_BYTES );
+    }
+    cost_ns[3] = (HostTest_Now_ns( ) - start_ns) / (NUM_BENCH_OPERATIONS / 10u);
+
+    printf( "  push + pop: %.2f ns previous, %.2f ns current\n", cost_ns[0], cost_ns[1] );
+    printf( "  %u byte flush in + out: %.2f ns previous, %.2f ns current\n", BENCH_FLUSH_BYTES, cost_ns[2], cost_ns[3] );
+    return HostTest_Report( );
+}
+/* End of CircularBufferTest.c source file */
@@ -0,0 +1,338 @@
+/*
+ * Filename: EclipseRS422ParseTest.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Host test and benchmark of the incremental Eclipse RS422
+ *      receive parser. Byte streams of valid, corrupted and truncated frames,
+ *      with preamble bytes throughout the payloads, are fed to the parser in
+ *      random sized chunks. The frames it returns must match a reference that
+ *      tries every preamble byte of the stream as a frame start, so a frame
+ *      that starts inside a rejected frame must still be found. The parse
+ *      cost per byte is printed for a clean stream and for an adversarial
+ *      stream of overlapping frame headers whose CRCs all fail.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include <stdlib.h>
+#include <string.h>
+#include "HostTest.h"
+#include "EclipseRS422messages.c"
+#include "CRC16bit.c"
+#include "CircularBuffer.c"
+#include "ARINC.c"
+#include "ARINC_common.c"
+
+
+/**************  Macro Definitions ***********************/
+#define NUM_TEST_MSGS 2u
+#define MAX_STREAM_BYTES 65536u
+#define MAX_STREAM_FRAMES 4096u
+#define NUM_TEST_STREAMS 200u
+#define MAX_CHUNK_BYTES 64u
+#define RX_BUFFER_CAPACITY 256u
+#define TRAILING_FILL_BYTES 100u /* Completes any frame left open at the end of a stream */
+#define NUM_BENCH_PASSES 20u
+
+
+/**************  Type Definitions ************************/
+/* Frame found in a test stream */
+typedef struct
+{
+    size_t frameOffset;
+    uint8_t msgIndex;
+} TestFrame;
+
+
+/**************  Variable Definitions ********************/
+static const EclipseRS422msgConfig testMsgConfigs[NUM_TEST_MSGS] = {
+    { ADC_COMPUTED_DATA_CMD, LEFT_ADC, RIGHT_ADC, LEFT_AHRS, RIGHT_AHRS, ECLIPSE_RS422_ADC_COMPUTED_DATA_MSG_LENGTH },
+    { ADC_STATUS_CMD, LEFT_ADC, RIGHT_ADC, LEFT_AHRS, RIGHT_AHRS, ECLIPSE_RS422_ADC_STATUS_MSG_LENGTH }
+};
+
+static uint8_t stream[MAX_STREAM_BYTES];
+static size_t streamLength;
+static TestFrame referenceFrames[MAX_STREAM_FRAMES];
+static size_t numReferenceFrames;
+
+
+/**************  Function Definitions ********************/
+/* Timer23 stand-ins for the ARINC receive path, unused by these streams */
+uint32_t Timer23_GetTimestamp_ticks( void )
+{
+    return 0;
+}
+
+uint32_t Timer23_ConvertMsToTicks( const uint32_t milliseconds )
+{
+    return milliseconds;
+}
+
+static uint8_t RandomByte( void )
+{
+    /* One payload byte in eight is a preamble */
+    return (0 == (rand( ) & 7)) ? ECLIPSE_RS422_MESSAGE_PREAMBLE : (uint8_t) rand( );
+}
+
+/* Function: AppendFrame
+ *
+ * Description: Appends a frame of a test message to the stream. The frame is
+ *      valid, has one byte after the preamble corrupted, or is cut short after
+ *      truncatedLength bytes (0 for the whole frame).
+ *
+ * Return: None (void)
+ */
+static void AppendFrame( const uint8_t msgIndex,
+                         const bool isCorrupted,
+                         const size_t truncatedLength )
+{
+    const EclipseRS422msgConfig * const msgConfig = &testMsgConfigs[msgIndex];
+    const size_t frameLength = msgConfig->length + ECLIPSE_RS422_MESSAGE_LENGTH_HEADER_AND_CRC;
+    uint8_t * const frame = &stream[streamLength];
+    size_t byteIdx;
+
+    frame[ECLIPSE_RS422_MESSAGE_PREAMBLE_INDEX] = ECLIPSE_RS422_MESSAGE_PREAMBLE;
+    frame[ECLIPSE_RS422_MESSAGE_DESTINATION_INDEX] = (rand( ) & 1) ? msgConfig->leftDestination : msgConfig->rightDestination;
+    frame[ECLIPSE_RS422_MESSAGE_SOURCE_INDEX] = (rand( ) & 1) ? msgConfig->leftSource : msgConfig->rightSource;
+    frame[ECLIPSE_RS422_MESSAGE_LENGTH_INDEX] = msgConfig->length;
+    frame[ECLIPSE_RS422_MESSAGE_CMD_INDEX] = msgConfig->cmd;
+    for (byteIdx = ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET; byteIdx < frameLength - ECLIPSE_RS422_MESSAGE_CRC_LENGTH; byteIdx++)
+    {
+        frame[byteIdx] = RandomByte( );
+    }
+    const uint16_t crc = CRC16_Calculate16bitCRC( frame, frameLength - ECLIPSE_RS422_MESSAGE_CRC_LENGTH, ECLIPSE_RS422_CRC_SEED_VALUE );
+    frame[frameLength - 2] = (uint8_t) (crc >> NUM_BITS_IN_BYTE);
+    frame[frameLength - 1] = (uint8_t) crc;
+
+    if (true == isCorrupted)
+    {
+        frame[1 + ((size_t) rand( ) % (frameLength - 1))] ^= (uint8_t) (1u + (rand( ) % 255));
+    }
+    streamLength += (0 != truncatedLength) ? truncatedLength : frameLength;
+    return;
+}
+
+/* Function: BuildStream
+ *
+ * Description: Builds a random stream of valid, corrupted and truncated
+ *      frames separated by noise, followed by the trailing fill.
+ *
+ * Return: None (void)
+ */
+static void BuildStream( void )
+{
+    streamLength = 0;
+    while (streamLength < MAX_STREAM_BYTES - 2048u)
+    {
+        const uint8_t msgIndex = (uint8_t) (rand( ) % NUM_TEST_MSGS);
+        const size_t frameLength = testMsgConfigs[msgIndex].length + ECLIPSE_RS422_MESSAGE_LENGTH_HEADER_AND_CRC;
+        switch (rand( ) % 4)
+        {
+            case 0:
+                AppendFrame( msgIndex, true, 0 );
+                break;
+            case 1:
+                AppendFrame( msgIndex, false, 1 + ((size_t) rand( ) % (frameLength - 1)) );
+                break;
+            default:
+                AppendFrame( msgIndex, false, 0 );
+                break;
+        }
+
+        size_t numNoiseBytes = (size_t) rand( ) % 4;
+        while (numNoiseBytes-- > 0)
+        {
+            stream[streamLength++] = RandomByte( );
+        }
+    }
+    memset( &stream[streamLength], 0, TRAILING_FILL_BYTES );
+    streamLength += TRAILING_FILL_BYTES;
+    return;
+}
+
+/* Function: FindReferenceFrames
+ *
+ * Description: Finds the stream's frames by trying every preamble byte as a
+ *      frame start against the whole message configuration and CRC, and
+ *      resuming after each frame found.
+ *
+ * Return: None (void)
+ */
+static void FindReferenceFrames( void )
+{
+    size_t offset = 0;
+    numReferenceFrames = 0;
+    while (offset + ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET <= streamLength)
+    {
+        const uint8_t * const frame = &stream[offset];
+        uint8_t msgIndex;
+        size_t frameLength = 0;
+        for (msgIndex = 0; (0 == frameLength) && (msgIndex < NUM_TEST_MSGS); msgIndex++)
+        {
+            const EclipseRS422msgConfig * const msgConfig = &testMsgConfigs[msgIndex];
+            if ((ECLIPSE_RS422_MESSAGE_PREAMBLE == frame[ECLIPSE_RS422_MESSAGE_PREAMBLE_INDEX]) &&
+                    ((msgConfig->leftDestination == frame[ECLIPSE_RS422_MESSAGE_DESTINATION_INDEX]) ||
+                     (msgConfig->rightDestination == frame[ECLIPSE_RS422_MESSAGE_DESTINATION_INDEX])) &&
+                    ((msgConfig->leftSource == frame[ECLIPSE_RS422_MESSAGE_SOURCE_INDEX]) ||
+                     (msgConfig->rightSource == frame[ECLIPSE_RS422_MESSAGE_SOURCE_INDEX])) &&
+                    (msgConfig->length == frame[ECLIPSE_RS422_MESSAGE_LENGTH_INDEX]) &&
+                    (msgConfig->cmd == frame[ECLIPSE_RS422_MESSAGE_CMD_INDEX]))
+            {
+                frameLength = msgConfig->length + ECLIPSE_RS422_MESSAGE_LENGTH_HEADER_AND_CRC;
+                if ((offset + frameLength <= streamLength) &&
+                        (0 == CRC16_Calculate16bitCRC( frame, frameLength, ECLIPSE_RS422_CRC_SEED_VALUE )))
+                {
+                    referenceFrames[numReferenceFrames].frameOffset = offset;
+                    referenceFrames[numReferenceFrames].msgIndex = msgIndex;
+                    numReferenceFrames++;
+                }
+                else
+                {
+                    frameLength = 0;
+                }
+                break;
+            }
+        }
+        offset += (0 != frameLength) ? frameLength : 1;
+    }
+    return;
+}
+
+/* Function: ParseStream
+ *
+ * Description: Feeds the stream to the parser through a receive circular
+ *      buffer, in chunks of random size up to maxChunkBytes, and checks each
+ *      frame returned against the reference frames when isChecked is set.
+ *
+ * Return: Number of frames returned by the parser
+ */
+static size_t ParseStream( const size_t maxChunkBytes,
+                           const bool isChecked )
+{
+    static uint8_t rxBufferData[RX_BUFFER_CAPACITY];
+    static uint8_t computedData[ECLIPSE_RS422_ADC_COMPUTED_DATA_MSG_LENGTH - 1];
+    static uint8_t statusData[ECLIPSE_RS422_ADC_STATUS_MSG_LENGTH - 1];
+    circBuffer_t rxBuffer = { .data = rxBufferData, .capacity = RX_BUFFER_CAPACITY };
+    EclipseRS422msg rxMsgs[NUM_TEST_MSGS] = {
+        { .msgConfig = &testMsgConfigs[0], .data = computedData, .timeStamp_max_counts = 1, .hasBusFailed = true },
+        { .msgConfig = &testMsgConfigs[1], .data = statusData, .timeStamp_max_counts = 1, .hasBusFailed = true }
+    };
+    EclipseRS422parser parser = { .numCRCErrors = 0 };
+    size_t numFrames = 0;
+    size_t streamIdx = 0;
+
+    EclipseRS422_ResetParser( &parser );
+    while (streamIdx < streamLength)
+    {
+        size_t chunkBytes = 1 + ((size_t) rand( ) % maxChunkBytes);
+        if (chunkBytes > streamLength - streamIdx)
+        {
+            chunkBytes = streamLength - streamIdx;
+        }
+        while (chunkBytes-- > 0)
+        {
+            cb_push( &rxBuffer, stream[streamIdx++] );
+        }
+
+        size_t msgIndex;
+        while (true == EclipseRS422_ProcessNewMessage( &parser, &rxBuffer, NUM_TEST_MSGS, rxMsgs, &msgIndex ))
+        {
+            if (true == isChecked)
+            {
+                const TestFrame * const expected = &referenceFrames[numFrames];
+                HOST_TEST_CHECK( (numFrames < numReferenceFrames) && (expected->msgIndex == msgIndex) &&
+                                 (0 == memcmp( rxMsgs[msgIndex].data,
+                                               &stream[expected->frameOffset + ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET],
+                                               testMsgConfigs[msgIndex].length - 1u )),
+                                 "frame %zu: message %zu does not match the reference", numFrames, msgIndex );
+            }
+            numFrames++;
+        }
+    }
+
+    if (true == isChecked)
+    {
+        HOST_TEST_CHECK( numFrames == numReferenceFrames, "%zu frames parsed, %zu in the reference", numFrames, numReferenceFrames );
+        HOST_TEST_CHECK( 0 == cb_getNumBytesDropped( &rxBuffer ), "%u bytes dropped by the receive buffer",
+                         cb_getNumBytesDropped( &rxBuffer ) );
+    }
+    return numFrames;
+}
+
+/* Function: BuildAdversarialStream
+ *
+ * Description: Builds a stream of computed data frame headers, one every
+ *      header length, so every preamble starts a full length frame whose CRC
+ *      fails and that holds the next candidate frame start.
+ *
+ * Return: None (void)
+ */
+static void BuildAdversarialStream( void )
+{
+    const EclipseRS422msgConfig * const msgConfig = &testMsgConfigs[0];
+    streamLength = 0;
+    while (streamLength < MAX_STREAM_BYTES - TRAILING_FILL_BYTES - ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET)
+    {
+        stream[streamLength++] = ECLIPSE_RS422_MESSAGE_PREAMBLE;
+        stream[streamLength++] = msgConfig->leftDestination;
+        stream[streamLength++] = msgConfig->leftSource;
+        stream[streamLength++] = msgConfig->length;
+        stream[streamLength++] = msgConfig->cmd;
+    }
+    memset( &stream[streamLength], 0, TRAILING_FILL_BYTES );
+    streamLength += TRAILING_FILL_BYTES;
+    return;
+}
+
+/* Function: TimeParse
+ *
+ * Description: Parses the current stream NUM_BENCH_PASSES times.
+ *
+ * Return: Parse cost in nanoseconds per stream byte
+ */
+static double TimeParse( void )
+{
+    const double start_ns = HostTest_Now_ns( );
+    uint32_t pass;
+    for (pass = 0; pass < NUM_BENCH_PASSES; pass++)
+    {
+        hostTestSink += (uint32_t) ParseStream( MAX_CHUNK_BYTES, false );
+    }
+    return (HostTest_Now_ns( ) - start_ns) / ((double) NUM_BENCH_PASSES * (double) streamLength);
+}
+
+int main( void )
+{
+    uint32_t streamCount;
+
+    srand( 1 );
+    for (streamCount = 0; streamCount < NUM_TEST_STREAMS; streamCount++)
+    {
+        BuildStream( );
+        FindReferenceFrames( );
+        ParseStream( (0 == (streamCount & 1)) ? 1u : MAX_CHUNK_BYTES, true );
+    }
+
+    /* Frames found inside the adversarial stream's rejected frames: none are valid */
+    BuildAdversarialStream( );
+    FindReferenceFrames( );
+    HOST_TEST_CHECK( 0 == ParseStream( MAX_CHUNK_BYTES, true ), "adversarial stream returned frames" );
+    const double adversarialCost_ns = TimeParse( );
+
+    /* Clean stream of back to back valid frames */
+    streamLength = 0;
+    while (streamLength < MAX_STREAM_BYTES - 2048u)
+    {
+        AppendFrame( (uint8_t) (rand( ) % NUM_TEST_MSGS), false, 0 );
+    }
+    const double cleanCost_ns = TimeParse( );
+
+    printf( "  parse: %.2f ns/byte clean stream, %.2f ns/byte adversarial stream\n", cleanCost_ns, adversarialCost_ns );
+    return HostTest_Report( );
+}
+/* End of EclipseRS422ParseTest.c source file */
@@ -0,0 +1,65 @@
+/*
+ * Filename: HostSFR.h
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Host definitions of the dsPIC30F6014A special function
+ *      registers used by the firmware modules under host test. On the target
+ *      each SFR and its bitfield view are placed at the same address by the
+ *      linker; here the bitfield view is an alias of the register, so bit and
+ *      word accesses see the same value. Include once, in the test source.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+#ifndef HOST_SFR_H
+#define HOST_SFR_H
+
+/**************  Included Files **************************/
+#include <stdint.h>
+#include "../COM/pic_h/p30F6014A.h"
+
+
+/**************  Macro Definitions ***********************/
+/* Defines an SFR and aliases its bitfield view onto it */
+#define HOST_SFR(reg, bitsType) \
+    volatile uint16_t reg; \
+    extern volatile bitsType reg##bits __attribute__( (alias( #reg )) )
+
+/* Defines an SFR that is only accessed as a word */
+#define HOST_SFR_WORD(reg) volatile uint16_t reg
+
+
+/**************  Variable Definitions ********************/
+/* I/O ports */
+HOST_SFR( TRISA, TRISABITS );
+HOST_SFR( PORTA, PORTABITS );
+HOST_SFR( LATA, LATABITS );
+HOST_SFR( TRISB, TRISBBITS );
+HOST_SFR( PORTB, PORTBBITS );
+HOST_SFR( LATB, LATBBITS );
+HOST_SFR( TRISC, TRISCBITS );
+HOST_SFR( PORTC, PORTCBITS );
+HOST_SFR( LATC, LATCBITS );
+HOST_SFR( TRISD, TRISDBITS );
+HOST_SFR( PORTD, PORTDBITS );
+HOST_SFR( LATD, LATDBITS );
+HOST_SFR( TRISF, TRISFBITS );
+HOST_SFR( PORTF, PORTFBITS );
+HOST_SFR( LATF, LATFBITS );
+HOST_SFR( TRISG, TRISGBITS );
+HOST_SFR( PORTG, PORTGBITS );
+HOST_SFR( LATG, LATGBITS );
+
+/* Timer 2-3 and interrupt enables */
+HOST_SFR( T2CON, T2CONBITS );
+HOST_SFR_WORD( TMR2 );
+HOST_SFR_WORD( TMR3HLD );
+HOST_SFR_WORD( PR2 );
+HOST_SFR_WORD( PR3 );
+HOST_SFR( IEC0, IEC0BITS );
+
+#endif
+/* End of HostSFR.h header file*/
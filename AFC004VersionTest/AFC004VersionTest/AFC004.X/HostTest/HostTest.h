@@ -0,0 +1,77 @@
+/*
+ * Filename: HostTest.h
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Check and timing helpers shared by the host tests. Each host
+ *      test is a single translation unit built by runHostTests.sh, so the
+ *      helpers are static and included once per test.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+/**************  Included Files **************************/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+
+/**************  Macro Definitions ***********************/
+#define HOST_TEST_MAX_REPORTED_FAILURES 10u /* Failures printed, the rest are only counted */
+
+/* Counts a failed check, printing the first few */
+#define HOST_TEST_CHECK(condition, ...) \
+    do { \
+        if (!(condition)) { \
+            if (hostTestNumFailures++ < HOST_TEST_MAX_REPORTED_FAILURES) { \
+                printf( "  FAIL %s:%d: ", __FILE__, __LINE__ ); \
+                printf( __VA_ARGS__ ); \
+                printf( "\n" ); \
+            } \
+        } \
+        hostTestNumChecks++; \
+    } while (0)
+
+
+/**************  Variable Definitions ********************/
+static unsigned long hostTestNumChecks = 0;
+static unsigned long hostTestNumFailures = 0;
+
+/* Written by benchmark loops so their results are not optimized away */
+static volatile uint32_t hostTestSink;
+
+
+/**************  Function Definitions ********************/
+/* Function: HostTest_Now_ns
+ *
+ * Description: Reads the host monotonic clock.
+ *
+ * Return: Time in nanoseconds
+ */
+static double HostTest_Now_ns( void )
+{
+    struct timespec now;
+    clock_gettime( CLOCK_MONOTONIC, &now );
+    return ((double) now.tv_sec * 1e9) + (double) now.tv_nsec;
+}
+
+/* Function: HostTest_Report
+ *
+ * Description: Prints the check totals of a test.
+ *
+ * Return: Process exit status, 0 if every check passed
+ */
+static int HostTest_Report( void )
+{
+    printf( "%lu checks, %lu failed\n", hostTestNumChecks, hostTestNumFailures );
+    return (0 == hostTestNumFailures) ? 0 : 1;
+}
+
+#endif
+/* End of HostTest.h header file*/
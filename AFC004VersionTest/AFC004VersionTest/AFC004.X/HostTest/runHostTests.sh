@@ -0,0 +1,62 @@
+#!/bin/sh
+#
+# Filename: runHostTests.sh
+#
+# Author: Brett Augsburger
+#
+# Date: 17 October 2026
+#
+# Description: Builds and runs the host tests and benchmarks in this directory
+#      with the host gcc. These check firmware modules against their previous
+#      implementations and time them on the host. They are not part of the
+#      XC16 build, and host timings only show relative cost, not dsPIC cycles.
+#
+#      The firmware sources are first copied to the build directory with their
+#      #FunctionName marker lines removed, which the host preprocessor rejects.
+#      Each test then includes the firmware sources it exercises, so it can
+#      reach their static functions and data.
+#
+#      Usage: HostTest/runHostTests.sh [test ...]
+#          test - test source name without .c (default: every *Test.c here)
+#      The build directory is $HOST_TEST_BUILD_DIR, default /tmp/AFC004HostTest.
+#
+# All rights reserved. Copyright Archangel Systems Inc. 2026
+#
+
+HOST_TEST_DIR=$(cd "$(dirname "$0")" && pwd)
+APP_DIR=$(dirname "$HOST_TEST_DIR")
+COM_DIR=$(cd "$APP_DIR/../COM" && pwd)
+BUILD_DIR=${HOST_TEST_BUILD_DIR:-/tmp/AFC004HostTest}
+CC=${CC:-gcc}
+
+# Device header and XC16 extensions: address space qualifiers are dropped, XC16's stdlib.h min() and
+# __builtin_nop() are provided here, and SFRs are defined by the tests (see HostSFR.h).
+HOST_CFLAGS="-std=gnu99 -O2 -w \
+    -D__dsPIC30F6014A__ -D__prog__= -D__psv__= -D__eds__= \
+    -Dmin(a,b)=(((a)<(b))?(a):(b)) -D__builtin_nop()=((void)0) \
+    -I$BUILD_DIR/src -I$HOST_TEST_DIR -I$APP_DIR -I$APP_DIR/ARINC -I$APP_DIR/RS422 -I$COM_DIR"
+
+mkdir -p "$BUILD_DIR/src" || exit 1
+for src in "$APP_DIR"/*.c "$APP_DIR"/ARINC/*.c "$APP_DIR"/RS422/*.c "$COM_DIR"/*.c; do
+    sed '/^ *#[A-Z][A-Za-z0-9_]* *$/d' "$src" > "$BUILD_DIR/src/$(basename "$src")" || exit 1
+done
+
+if [ $# -eq 0 ]; then
+    set -- $(cd "$HOST_TEST_DIR" && ls *Test.c | sed 's/\.c$//')
+fi
+
+set -f # HOST_CFLAGS holds glob characters
+numFailed=0
+for test in "$@"; do
+    echo "==== $test"
+    if $CC $HOST_CFLAGS -o "$BUILD_DIR/$test" "$HOST_TEST_DIR/$test.c" -lm &&
+            "$BUILD_DIR/$test"; then
+        echo "==== $test PASSED"
+    else
+        echo "==== $test FAILED"
+        numFailed=$((numFailed + 1))
+    fi
+done
+
+echo "$numFailed of $# host tests failed"
+[ $numFailed -eq 0 ]
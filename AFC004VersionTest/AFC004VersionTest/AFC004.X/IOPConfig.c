@@ -66,6 +66,18 @@ __psv__ volatile union configuration_variables IOPConfig = {
     .iirDiffSettings.IIRDiffLowerDelta = -360.0f,
     .iirDiffSettings.IIRDiffUpperLimit = 180.0f,
     .iirDiffSettings.IIRDiffLowerLimit = -180.0f,
+
+
+    /************************************ Added Settings ******************************************/
+    .layoutVersion = IOP_CONFIG_LAYOUT_VERSION,
+
+    /* Continuous program memory CRC check */
+    .addedHardwareSettings.PMCRCSliceInstructions = IOP_PM_CRC_SLICE_INSTRUCTIONS,
+
+    /* Timer5 Config - ARINC receive FIFO service interrupt every 0.5 ms (1/20th of the Timer 4 period), priority 2 */
+    .addedHardwareSettings.TMR5Config = 0x8010,
+    .addedHardwareSettings.TMR5Period = 0x0399,
+    .addedHardwareSettings.TMR5InterruptConfig = 0x000A,
 };
 
 /*   End of IOPConfig.c source file. */
\ No newline at end of file
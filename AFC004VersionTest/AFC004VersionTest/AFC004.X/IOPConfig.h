@@ -18,6 +18,19 @@
 #define CONFIG_BLOCK_START_ADDRESS 0x12000
 #define CONFIG_BLOCK_LENGTH 0x5000
 
+/* Configuration block layout. The block is loaded apart from the code, so fields added since the original layout
+ * go after mxModeSettings, where they do not move the original fields, and boot checks the block's layout version
+ * before running. Increment the version whenever a field is added. */
+#define IOP_CONFIG_LAYOUT_VERSION 2u
+
+/* Default program memory instructions added to the continuous CRC check each 100 Hz frame, once boot has completed
+ * the first pass */
+#define IOP_PM_CRC_SLICE_INSTRUCTIONS 256u /* About 1 s per pass of a 70 KB image */
+
+#if (0 == IOP_PM_CRC_SLICE_INSTRUCTIONS)
+#error "IOP_PM_CRC_SLICE_INSTRUCTIONS must be greater than zero or the program memory CRC check never completes a pass"
+#endif
+
 typedef struct 
 {
     float IIRFilterK1;
@@ -74,6 +87,17 @@ typedef struct
 } maintenanceModeSettings;
 ;
 
+/* Hardware settings added since the original layout, in the order they were added (layout version in brackets) */
+typedef struct
+{
+    uint16_t PMCRCSliceInstructions; /* (1) Program memory instructions added to the continuous CRC check each 100 Hz frame. */
+
+    /* Timer 5 - ARINC receive service interrupt (ARINC429_RX_INTERRUPT_DRIVEN builds only) */
+    uint16_t TMR5Config; /* (2) Timer 5 Configuration data. */
+    uint16_t TMR5Period; /* (2) Timer 5 Period data. */
+    uint16_t TMR5InterruptConfig; /* (2) Timer 5 Interrupt Configuration data. Priority in bits 0-2, enable in bit 3. */
+} addedHardwareConfigVars;
+
 union configuration_variables
 {
     uint8_t byte[CONFIG_BLOCK_LENGTH];
@@ -84,6 +108,8 @@ union configuration_variables
         IIRDiffConfigVars iirDiffSettings;
         HardwareConfigVars hardwareSettings;
         maintenanceModeSettings mxModeSettings;
+        uint16_t layoutVersion; /* IOP_CONFIG_LAYOUT_VERSION the block was built with, 0 before the first added field */
+        addedHardwareConfigVars addedHardwareSettings;
     };
 };
 
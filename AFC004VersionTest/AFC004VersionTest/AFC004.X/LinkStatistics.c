@@ -0,0 +1,334 @@
+/*
+ * Filename: LinkStatistics.c
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: Link statistics record. Each 100 Hz frame the main loop copies
+ *      the dropped byte counts and high water marks of the UART1 (ADC RS422)
+ *      receive and transmit circular buffers, and the ADC parser's CRC error
+ *      count, into the record. Bytes dropped by a full buffer are overruns,
+ *      while CRC errors are bad data on the link, so the two can be told
+ *      apart. The high water marks, reported with the buffer capacities, are
+ *      used to size UART1_RX_BUFF_SIZE and UART1_TX_BUFF_SIZE. In
+ *      interrupt-driven ARINC receive mode, the words dropped by the
+ *      transceiver A and B receive rings are also recorded; they are zero in
+ *      polled mode, which has no rings.
+ *
+ *      Maintenance mode is entered before the main loop runs, so, as for the
+ *      frame monitor, the record of the previous boot is kept in persistent
+ *      RAM with a check word and can be retrieved over UART2 after a reset
+ *      into maintenance mode.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+
+/**************  Included Files **************************/
+#include "LinkStatistics.h"
+#include <stddef.h>
+#include "ArincDownload.h"
+
+
+/**************  Macro Definitions ***********************/
+#define LINK_STATISTICS_CHECK_SEED 0x11C5u
+
+#ifdef __dsPIC30F__
+#define LINK_STATISTICS_PERSISTENT __attribute__((persistent))
+#else
+#define LINK_STATISTICS_PERSISTENT
+#endif
+
+
+/**************  Type Definitions ************************/
+typedef struct
+{
+    uint32_t numUpdates; /* Frames the record was updated in, saturates */
+    uint16_t uart1RxCapacity; /* Bytes */
+    uint16_t uart1RxHighWaterMark; /* Most bytes held at once */
+    uint16_t uart1RxBytesDropped; /* Bytes lost to a full buffer, saturates */
+    uint16_t uart1TxCapacity;
+    uint16_t uart1TxHighWaterMark;
+    uint16_t uart1TxBytesDropped;
+    uint16_t adcNumCRCErrors; /* ADC RS422 frames rejected on CRC, saturates */
+    uint16_t arincRxADroppedWords; /* Transceiver A receive ring words dropped, saturates */
+    uint16_t arincRxBDroppedWords; /* Transceiver B receive ring words dropped, saturates */
+    uint16_t checkWord;
+} LinkStatisticsRecord;
+
+
+/**************  Local Variables *************************/
+static LinkStatisticsRecord currentRun LINK_STATISTICS_PERSISTENT;
+static LinkStatisticsRecord lastRun LINK_STATISTICS_PERSISTENT;
+
+
+/**************  Static Function Prototypes *************/
+static void ClearRecord( LinkStatisticsRecord * const record );
+static uint16_t CalculateCheckWord( const LinkStatisticsRecord * const record );
+static bool IsRecordValid( const LinkStatisticsRecord * const record );
+static const LinkStatisticsRecord * GetRecord( const LinkStatisticsRecordId recordId );
+static uint16_t ToUint16( const size_t value );
+static uint16_t WriteUint32( uint8_t * const frame,
+                             const uint32_t value );
+static uint16_t WriteUint16( uint8_t * const frame,
+                             const uint16_t value );
+
+
+/**************  Function Definitions ********************/
+#LinkStatistics_Initialize
+/* Function: LinkStatistics_Initialize
+ *
+ * Description: Keeps the record of the previous boot, if it is valid and was
+ *      updated by the main loop, as the last run record, then starts a new
+ *      record. Must be called at boot before maintenance mode can be entered.
+ *
+ * Return: None (void)
+ */
+void LinkStatistics_Initialize( void )
+{
+    if (IsRecordValid( &currentRun ) && (0 != currentRun.numUpdates))
+    {
+        lastRun = currentRun;
+    }
+    else if (false == IsRecordValid( &lastRun ))
+    {
+        ClearRecord( &lastRun );
+    }
+
+    ClearRecord( &currentRun );
+    return;
+}
+#LinkStatistics_Initialize
+
+#LinkStatistics_Update
+/* Function: LinkStatistics_Update
+ *
+ * Description: Copies the statistics of the UART1 circular buffers, the ADC
+ *      receive parser and the ARINC receive rings into the current run record.
+ *      Called once per 100 Hz frame.
+ *
+ * Return: None (void)
+ */
+void LinkStatistics_Update( const circBuffer_t * const uart1RxBuffer, /* ADC receive circular buffer */
+                            const circBuffer_t * const uart1TxBuffer, /* ADC transmit circular buffer */
+                            const EclipseRS422parser * const adcParser ) /* ADC receive parser */
+{
+    if ((NULL == uart1RxBuffer) || (NULL == uart1TxBuffer) || (NULL == adcParser))
+    {
+        return;
+    }
+
+    currentRun.uart1RxCapacity = ToUint16( uart1RxBuffer->capacity );
+    currentRun.uart1RxHighWaterMark = ToUint16( cb_getHighWaterMark( uart1RxBuffer ) );
+    currentRun.uart1RxBytesDropped = cb_getNumBytesDropped( uart1RxBuffer );
+    currentRun.uart1TxCapacity = ToUint16( uart1TxBuffer->capacity );
+    currentRun.uart1TxHighWaterMark = ToUint16( cb_getHighWaterMark( uart1TxBuffer ) );
+    currentRun.uart1TxBytesDropped = cb_getNumBytesDropped( uart1TxBuffer );
+    currentRun.adcNumCRCErrors = adcParser->numCRCErrors;
+#ifdef ARINC429_RX_INTERRUPT_DRIVEN
+    currentRun.arincRxADroppedWords = ArincRx_GetDroppedWordCount( A429_CHANNEL_A );
+    currentRun.arincRxBDroppedWords = ArincRx_GetDroppedWordCount( A429_CHANNEL_B );
+#endif
+
+    if (currentRun.numUpdates < UINT32_MAX)
+    {
+        currentRun.numUpdates++;
+    }
+    currentRun.checkWord = CalculateCheckWord( &currentRun );
+    return;
+}
+#LinkStatistics_Update
+
+#LinkStatistics_SerializeRecord
+/* Function: LinkStatistics_SerializeRecord
+ *
+ * Description: Writes a record to a frame for transmission, multi-byte
+ *      values MSB first:
+ *          LINK_STATISTICS_FRAME_HEADER
+ *          Record ID
+ *          1 if the record is valid, 0 if not
+ *          Frames the record was updated in, 4 bytes
+ *          UART1 receive buffer capacity, high water mark and dropped bytes,
+ *              2 bytes each
+ *          UART1 transmit buffer capacity, high water mark and dropped bytes,
+ *              2 bytes each
+ *          ADC RS422 frames rejected on CRC, 2 bytes
+ *          ARINC transceiver A and B receive ring dropped words, 2 bytes each
+ *
+ * Return: Number of bytes written, 0 if the frame is too small or the record
+ *      ID is invalid
+ */
+uint16_t LinkStatistics_SerializeRecord( const LinkStatisticsRecordId recordId,
+                                         uint8_t * const frame, /* Buffer for the serialized record */
+                                         const uint16_t frameSize ) /* Size of the buffer */
+{
+    const LinkStatisticsRecord * const record = GetRecord( recordId );
+    uint16_t frameIdx = 0;
+
+    if ((NULL == record) || (frameSize < LINK_STATISTICS_FRAME_SIZE))
+    {
+        return 0;
+    }
+
+    frame[frameIdx++] = LINK_STATISTICS_FRAME_HEADER;
+    frame[frameIdx++] = (uint8_t) recordId;
+    frame[frameIdx++] = IsRecordValid( record ) ? 1u : 0u;
+    frameIdx += WriteUint32( &frame[frameIdx], record->numUpdates );
+    frameIdx += WriteUint16( &frame[frameIdx], record->uart1RxCapacity );
+    frameIdx += WriteUint16( &frame[frameIdx], record->uart1RxHighWaterMark );
+    frameIdx += WriteUint16( &frame[frameIdx], record->uart1RxBytesDropped );
+    frameIdx += WriteUint16( &frame[frameIdx], record->uart1TxCapacity );
+    frameIdx += WriteUint16( &frame[frameIdx], record->uart1TxHighWaterMark );
+    frameIdx += WriteUint16( &frame[frameIdx], record->uart1TxBytesDropped );
+    frameIdx += WriteUint16( &frame[frameIdx], record->adcNumCRCErrors );
+    frameIdx += WriteUint16( &frame[frameIdx], record->arincRxADroppedWords );
+    frameIdx += WriteUint16( &frame[frameIdx], record->arincRxBDroppedWords );
+    return frameIdx;
+}
+#LinkStatistics_SerializeRecord
+
+/**************  Static Function Definitions *************/
+#ClearRecord
+/* Function: ClearRecord
+ *
+ * Description: Empties a record and makes its check word valid.
+ *
+ * Return: None (void)
+ */
+static void ClearRecord( LinkStatisticsRecord * const record )
+{
+    record->numUpdates = 0;
+    record->uart1RxCapacity = 0;
+    record->uart1RxHighWaterMark = 0;
+    record->uart1RxBytesDropped = 0;
+    record->uart1TxCapacity = 0;
+    record->uart1TxHighWaterMark = 0;
+    record->uart1TxBytesDropped = 0;
+    record->adcNumCRCErrors = 0;
+    record->arincRxADroppedWords = 0;
+    record->arincRxBDroppedWords = 0;
+    record->checkWord = CalculateCheckWord( record );
+    return;
+}
+#ClearRecord
+
+#CalculateCheckWord
+/* Function: CalculateCheckWord
+ *
+ * Description: XORs the 16 bit halves of the record's fields into a seeded,
+ *      rotated check word.
+ *
+ * Return: Check word of the record
+ */
+static uint16_t CalculateCheckWord( const LinkStatisticsRecord * const record )
+{
+    const uint16_t fields[] = {
+        (uint16_t) (record->numUpdates >> 16),
+        (uint16_t) record->numUpdates,
+        record->uart1RxCapacity,
+        record->uart1RxHighWaterMark,
+        record->uart1RxBytesDropped,
+        record->uart1TxCapacity,
+        record->uart1TxHighWaterMark,
+        record->uart1TxBytesDropped,
+        record->adcNumCRCErrors,
+        record->arincRxADroppedWords,
+        record->arincRxBDroppedWords
+    };
+    uint16_t checkWord = LINK_STATISTICS_CHECK_SEED;
+    uint8_t idx;
+
+    for (idx = 0; idx < (sizeof (fields) / sizeof (fields[0])); idx++)
+    {
+        checkWord ^= fields[idx];
+        checkWord = (uint16_t) ((checkWord << 1) | (checkWord >> 15));
+    }
+    return checkWord;
+}
+#CalculateCheckWord
+
+#IsRecordValid
+/* Function: IsRecordValid
+ *
+ * Description: Checks a record against its check word, which rejects the
+ *      random contents of persistent RAM after a power up.
+ *
+ * Return: True if the record is valid
+ */
+static bool IsRecordValid( const LinkStatisticsRecord * const record )
+{
+    return (CalculateCheckWord( record ) == record->checkWord);
+}
+#IsRecordValid
+
+#GetRecord
+/* Function: GetRecord
+ *
+ * Description: Maps a record ID to its record.
+ *
+ * Return: Pointer to the record, NULL if the record ID is invalid
+ */
+static const LinkStatisticsRecord * GetRecord( const LinkStatisticsRecordId recordId )
+{
+    const LinkStatisticsRecord * record = NULL;
+
+    if (LINK_STATISTICS_CURRENT_RUN == recordId)
+    {
+        record = &currentRun;
+    }
+    else if (LINK_STATISTICS_LAST_RUN == recordId)
+    {
+        record = &lastRun;
+    }
+    return record;
+}
+#GetRecord
+
+#ToUint16
+/* Function: ToUint16
+ *
+ * Description: Narrows a byte count to 16 bits, saturating.
+ *
+ * Return: Byte count, at most UINT16_MAX
+ */
+static uint16_t ToUint16( const size_t value )
+{
+    return (value > UINT16_MAX) ? UINT16_MAX : (uint16_t) value;
+}
+#ToUint16
+
+#WriteUint32
+/* Function: WriteUint32
+ *
+ * Description: Writes a 32 bit value to a frame, MSB first.
+ *
+ * Return: Number of bytes written
+ */
+static uint16_t WriteUint32( uint8_t * const frame,
+                             const uint32_t value )
+{
+    frame[0] = (uint8_t) (value >> 24);
+    frame[1] = (uint8_t) (value >> 16);
+    frame[2] = (uint8_t) (value >> 8);
+    frame[3] = (uint8_t) value;
+    return 4u;
+}
+#WriteUint32
+
+#WriteUint16
+/* Function: WriteUint16
+ *
+ * Description: Writes a 16 bit value to a frame, MSB first.
+ *
+ * Return: Number of bytes written
+ */
+static uint16_t WriteUint16( uint8_t * const frame,
+                             const uint16_t value )
+{
+    frame[0] = (uint8_t) (value >> 8);
+    frame[1] = (uint8_t) value;
+    return 2u;
+}
+#WriteUint16
+/* End of LinkStatistics.c source file */
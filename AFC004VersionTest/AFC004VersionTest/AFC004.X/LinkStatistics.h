@@ -0,0 +1,52 @@
+/*
+ * Filename: LinkStatistics.h
+ *
+ * Author: Brett Augsburger
+ *
+ * Date: 17 October 2026
+ *
+ * Description: External interface for the link statistics record. Keeps the
+ *      UART1 circular buffer overrun counts and high water marks, the ADC
+ *      RS422 parser CRC error count and the ARINC receive ring dropped word
+ *      counts of the main loop for maintenance mode.
+ *
+ * All rights reserved. Copyright Archangel Systems Inc. 2026
+ */
+
+#ifndef LINK_STATISTICS_H
+#define LINK_STATISTICS_H
+
+/**************  Included Files **************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "CircularBuffer.h"
+#include "EclipseRS422messages.h"
+
+
+/**************  Macro Definitions ***********************/
+#define LINK_STATISTICS_FRAME_HEADER 0xC0u /* First byte of a serialized link statistics record */
+#define LINK_STATISTICS_FRAME_SIZE (3u + 4u + (9u * 2u))
+
+
+/**************  Type Definitions ************************/
+typedef enum
+{
+    LINK_STATISTICS_CURRENT_RUN = 0, /* Statistics of this boot's main loop */
+    LINK_STATISTICS_LAST_RUN /* Statistics of the previous boot's main loop, kept through a reset */
+} LinkStatisticsRecordId;
+
+
+/**************  Function Prototypes *********************/
+void LinkStatistics_Initialize(void);
+
+void LinkStatistics_Update(const circBuffer_t * const uart1RxBuffer, /* ADC receive circular buffer */
+        const circBuffer_t * const uart1TxBuffer, /* ADC transmit circular buffer */
+        const EclipseRS422parser * const adcParser); /* ADC receive parser */
+
+uint16_t LinkStatistics_SerializeRecord(const LinkStatisticsRecordId recordId,
+        uint8_t * const frame, /* Buffer for the serialized record */
+        const uint16_t frameSize); /* Size of the buffer */
+
+
+#endif
+/* End of LinkStatistics.h header file*/
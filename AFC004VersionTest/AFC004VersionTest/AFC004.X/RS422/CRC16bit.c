@@ -80,4 +80,21 @@ uint16_t CRC16_Calculate16bitCRC(const uint8_t* const data, /* Pointer to data a
     return (crc);
 }
 
+/* Function: CRC16_Update16bitCRC
+ * 
+ * Description: Folds a single byte into a running 16 bit CRC using the lookup
+ *      table. Feeding every byte of an array through this function from the
+ *      seed value gives the same result as CRC16_Calculate16bitCRC, which lets
+ *      a stream be checked as each byte arrives.
+ *
+ * Return: Updated 16 bit CRC
+ *
+ * Requirement Implemented : INT1.0102.S.IOP.1.005
+ */
+uint16_t CRC16_Update16bitCRC(const uint16_t crc, /* Running CRC value */
+                              const uint8_t data) /* Next data byte */
+{
+    return ((crc << 8) ^ CRCtbl[((crc >> 8) ^ data) & 0x00FF]);
+}
+
 /* End of CRC16bit.c source file */
\ No newline at end of file
@@ -23,5 +23,8 @@ uint16_t CRC16_Calculate16bitCRC(const uint8_t* const data, /* Pointer to data a
                                  const size_t size, /* Size of input array */
                                  const uint16_t seed); /* CRC seed value */
 
+uint16_t CRC16_Update16bitCRC(const uint16_t crc, /* Running CRC value */
+                              const uint8_t data); /* Next data byte */
+
 #endif
 /* End of CRC16bit.h header file */
\ No newline at end of file
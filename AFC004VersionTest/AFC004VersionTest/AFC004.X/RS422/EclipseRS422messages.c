@@ -26,13 +26,13 @@
 #define ECLIPSE_RS422_MESSAGE_LENGTH_INDEX                     3
 #define ECLIPSE_RS422_MESSAGE_CMD_INDEX                        4
 #define ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET                5
-#define ECLIPSE_RS422_MESSAGE_MIN_TOTAL_LENGTH                 5
 #define ECLIPSE_RS422_MESSAGE_LENGTH_HEADER_AND_CRC            6
+#define ECLIPSE_RS422_MESSAGE_CRC_LENGTH                       2
 #define ECLIPSE_RS422_CRC_SEED_VALUE                           0xFFFF
 
 /* Misc definitions */
 #define NUM_BITS_IN_BYTE 8u
-#define SIZE_OF_TX_CIRCBUFF_BYTES 100
+#define SIZE_OF_TX_CIRCBUFF_BYTES 128
 #define MAX_NUM_ARINC_WORDS_CONSTRUCT_MSG  (SIZE_OF_TX_CIRCBUFF_BYTES - ECLIPSE_RS422_MESSAGE_LENGTH_HEADER_AND_CRC)/4
 #define NUM_BITS_IN_UINT32 32
 
@@ -49,164 +49,706 @@
 #define min(x, y) (((x) < (y)) ? (x) : (y))
 #endif 
 
+/**************  Type Definition(s) ************************/
+/* Writes a transmit message into space reserved in a circular buffer */
+typedef struct {
+    circBufferSpan_t spans[CB_NUM_SPANS]; // Reserved space
+    uint8_t spanIdx; // Span currently being written
+    size_t byteIdx; // Next byte to write in the current span
+    uint16_t crc; // Running CRC of the bytes written
+} EclipseRS422txWriter;
 
-/**************  Function Definition(s) ********************/
 
-/* 
- * Function: EclipseRS422messages_ProcessNew
- * 
- * Description: Searches the length of a receive circular buffer for a matching 
- *      Eclipse RS422 receive message. If a matching header is found (0xEA),
- *      search each message in the receive message array for a matching message
- *      configuration (source, destination, cmd, length). 
- * 
- *      If a message header is found, determine if enough bytes occupy the circ 
- *      buffer to compose a valid message. 
- * 
- *      If a valid message length is found, calculate the CRC of the message. 
- *      The function accounts for head-tail wrap around, and can calculate the 
- *      CRC for a message that wraps around. If the CRC is valid, flush out 
- *      the data to the rxMsg's data array and advance the tail past the valid 
- *      message. 
+/**************  Static Function Prototypes (s) ***********/
+static void EclipseRS422_ParseNewBytes( EclipseRS422parser * const parser,
+                                        const circBuffer_t * const rxCircBuffer,
+                                        const uint8_t rxMsgsSize,
+                                        const EclipseRS422msg * const rxMsgs );
+
+static uint16_t EclipseRS422_MatchHeaderByte( const EclipseRS422parseState state,
+                                              const uint8_t dataByte,
+                                              const uint16_t candidateMsgs,
+                                              const uint8_t rxMsgsSize,
+                                              const EclipseRS422msg * const rxMsgs );
+
+static void EclipseRS422_RebaseParser( EclipseRS422parser * const parser,
+                                       const size_t numBytesRemoved );
+
+static void EclipseRS422_DiscardUnusedBytes( EclipseRS422parser * const parser,
+                                             circBuffer_t * const rxCircBuffer );
+
+static bool EclipseRS422_TakeNextFrame( EclipseRS422parser * const parser,
+                                        circBuffer_t * const rxCircBuffer,
+                                        const uint8_t rxMsgsSize,
+                                        const EclipseRS422msg * const rxMsgs,
+                                        EclipseRS422frame * const frame );
+
+static void EclipseRS422_RemoveFrame( EclipseRS422parser * const parser,
+                                      circBuffer_t * const rxCircBuffer,
+                                      EclipseRS422msg * const rxMsgs,
+                                      const EclipseRS422frame * const frame );
+
+static void EclipseRS422_CreateARINCWordsInPlace( const circBuffer_t * const rxCircBuffer,
+                                                  const EclipseRS422frame * const frame,
+                                                  const EclipseRS422msgConfig * const msgConfig,
+                                                  ARINC429_RxMsgArray * const ArincMsgArray );
+
+static void EclipseRS422_WriteTxByte( EclipseRS422txWriter * const writer,
+                                      const uint8_t dataByte );
+
+static bool EclipseRS422_CarriesARINCWords( const EclipseRS422cmd cmd );
+
+
+/**************  Static Function Definition(s) ************/
+
+/*
+ * Function: EclipseRS422_ParseNewBytes
  * 
- *      If a valid message is found, return true and set the input pointer value 
- *      to the EclipseRS422msg array's valid message index. 
+ * Description: Runs the receive parser over every byte in the circular buffer 
+ *      that it has not yet seen, or until the frame queue is full. A header 
+ *      field that matches no configured message abandons the frame; if that 
+ *      byte is itself a preamble a new frame is started on it. Configured 
+ *      header field values are never the preamble, so no frame start can be 
+ *      skipped while a header is being matched. Payload and CRC bytes can be 
+ *      the preamble, so the first one seen in a frame is remembered. If the 
+ *      frame's CRC then fails (it was corrupted, or truncated by a frame that 
+ *      started inside it), parsing resumes at that preamble candidate. With 
+ *      no candidate, resuming at the frame's last byte skips nothing. 
  * 
- *      This function is also used to search for the software version reply
- *      for Eclipse's systems. In this implementation, the input parameter 
- *      returnMsgIndex is not required, and can be a dummy variable. 
+ * Return: None 
  * 
- * Return: True if a message was successfully processed, false if invalid message. 
- *
  * Requirement Implemented : INT1.0102.S.IOP.1.001
  */
-
-bool EclipseRS422_ProcessNewMessage( circBuffer_t * const rxCircBuffer, // circular buffer object
-                                     const uint8_t rxMsgsSize, // Number of received messages in array
-                                     EclipseRS422msg * const rxMsgs, // received messages array
-                                     size_t * const returnMsgIndex ) // return parameter for a message index if a valid msg was found. 
+static void EclipseRS422_ParseNewBytes( EclipseRS422parser * const parser,
+                                        const circBuffer_t * const rxCircBuffer,
+                                        const uint8_t rxMsgsSize,
+                                        const EclipseRS422msg * const rxMsgs )
 {
-    if ((NULL == rxCircBuffer) ||
-            (NULL == rxMsgs))
+    const size_t bytesUsed = cb_bytesUsed( rxCircBuffer );
+    size_t dataIdx = rxCircBuffer->tail + parser->scanOffset;
+    if (dataIdx >= rxCircBuffer->capacity)
     {
-        return false;
+        dataIdx -= rxCircBuffer->capacity;
     }
 
-    while (true)
+    while ((parser->scanOffset < bytesUsed) &&
+            (parser->numQueuedFrames < ECLIPSE_RS422_FRAME_QUEUE_SIZE))
     {
-        size_t incomingSize = cb_bytesUsed( rxCircBuffer );
-        bool wasMsgStartFound = false; // Indicates whether the matching start sequence of as message has been found
-        size_t msgIndex = 0; // Index into the received messages array of the message currently being processed
+        const uint8_t dataByte = rxCircBuffer->data[dataIdx];
+        dataIdx++;
+        if (dataIdx >= rxCircBuffer->capacity)
+        {
+            dataIdx = 0;
+        }
 
-        /* Scan for a start condition for every byte in the msg. The start of a packet is indicated by the message preamble character */
-        size_t dataByte_index;
-        for (dataByte_index = 0; dataByte_index < incomingSize; dataByte_index++)
+        switch (parser->state)
         {
-            if (ECLIPSE_RS422_MESSAGE_PREAMBLE == cb_peek( rxCircBuffer, dataByte_index ))
-            {
-                if ((dataByte_index + ECLIPSE_RS422_MESSAGE_MIN_TOTAL_LENGTH) > incomingSize)
+            case ECLIPSE_RS422_PARSE_PREAMBLE:
+                break;
+
+            case ECLIPSE_RS422_PARSE_DESTINATION:
+            case ECLIPSE_RS422_PARSE_SOURCE:
+            case ECLIPSE_RS422_PARSE_LENGTH:
+            case ECLIPSE_RS422_PARSE_CMD:
+                parser->candidateMsgs = EclipseRS422_MatchHeaderByte( parser->state,
+                                                                      dataByte,
+                                                                      parser->candidateMsgs,
+                                                                      rxMsgsSize,
+                                                                      rxMsgs );
+                if (0 == parser->candidateMsgs)
                 {
-                    break; // Preamble was located but not enough data has been received for a complete message
+                    parser->state = ECLIPSE_RS422_PARSE_PREAMBLE;
                 }
-
-                // Search for a matching message inside the circular buffer, for the entire length of an expected message. 
-                for (msgIndex = 0; msgIndex < rxMsgsSize; msgIndex++)
+                else if (ECLIPSE_RS422_PARSE_CMD == parser->state)
                 {
-                    /* Look for match for command, destination, source and length */
-                    if ((cb_peek( rxCircBuffer, dataByte_index + ECLIPSE_RS422_MESSAGE_CMD_INDEX ) == rxMsgs[msgIndex].msgConfig->cmd) &&
-                            (cb_peek( rxCircBuffer, dataByte_index + ECLIPSE_RS422_MESSAGE_LENGTH_INDEX ) == rxMsgs[msgIndex].msgConfig->length) &&
-                            ((cb_peek( rxCircBuffer, dataByte_index + ECLIPSE_RS422_MESSAGE_DESTINATION_INDEX ) == rxMsgs[msgIndex].msgConfig->leftDestination) ||
-                            (cb_peek( rxCircBuffer, dataByte_index + ECLIPSE_RS422_MESSAGE_DESTINATION_INDEX ) == rxMsgs[msgIndex].msgConfig->rightDestination)) &&
-                            ((cb_peek( rxCircBuffer, dataByte_index + ECLIPSE_RS422_MESSAGE_SOURCE_INDEX ) == rxMsgs[msgIndex].msgConfig->leftSource) ||
-                            (cb_peek( rxCircBuffer, dataByte_index + ECLIPSE_RS422_MESSAGE_SOURCE_INDEX ) == rxMsgs[msgIndex].msgConfig->rightSource)))
+                    /* Use the first matching message, as the header is now complete */
+                    parser->msgIndex = 0;
+                    while (0 == ((parser->candidateMsgs >> parser->msgIndex) & 1u))
+                    {
+                        parser->msgIndex++;
+                    }
+                    parser->crc = CRC16_Update16bitCRC( parser->crc, dataByte );
+                    parser->bytesRemaining = rxMsgs[parser->msgIndex].msgConfig->length - 1;
+                    parser->state = (0 != parser->bytesRemaining) ? ECLIPSE_RS422_PARSE_PAYLOAD : ECLIPSE_RS422_PARSE_CRC;
+                    if (ECLIPSE_RS422_PARSE_CRC == parser->state)
                     {
-                        wasMsgStartFound = true; // Indicate that a prospective message has been found
-                        break; // Breaks for loop 
+                        parser->bytesRemaining = ECLIPSE_RS422_MESSAGE_CRC_LENGTH;
                     }
                 }
+                else
+                {
+                    parser->crc = CRC16_Update16bitCRC( parser->crc, dataByte );
+                    parser->state++;
+                }
+                break;
 
-                if (true == wasMsgStartFound)
+            case ECLIPSE_RS422_PARSE_PAYLOAD:
+                if ((ECLIPSE_RS422_MESSAGE_PREAMBLE == dataByte) && (0 == parser->resyncOffset))
                 {
-                    break;
+                    parser->resyncOffset = parser->scanOffset;
                 }
-            }
-        }
+                parser->crc = CRC16_Update16bitCRC( parser->crc, dataByte );
+                parser->bytesRemaining--;
+                if (0 == parser->bytesRemaining)
+                {
+                    parser->bytesRemaining = ECLIPSE_RS422_MESSAGE_CRC_LENGTH;
+                    parser->state = ECLIPSE_RS422_PARSE_CRC;
+                }
+                break;
 
-        /* Advance the tail to the first ECLIPSE_RS422_MESSAGE_PREAMBLE character (or all the way to head if none were found) */
-        cb_advanceTail( rxCircBuffer, dataByte_index );
+            case ECLIPSE_RS422_PARSE_CRC:
+                if ((ECLIPSE_RS422_MESSAGE_PREAMBLE == dataByte) && (0 == parser->resyncOffset))
+                {
+                    parser->resyncOffset = parser->scanOffset;
+                }
+                parser->crc = CRC16_Update16bitCRC( parser->crc, dataByte );
+                parser->bytesRemaining--;
+                if (0 == parser->bytesRemaining)
+                {
+                    parser->state = ECLIPSE_RS422_PARSE_PREAMBLE;
 
-        if (false == wasMsgStartFound)
-        {
-            break; // All available data was processed and no matching message header sequence was found
+                    /* A valid frame, including its CRC, has a CRC of zero */
+                    if (0x0 == parser->crc)
+                    {
+                        parser->frameQueue[parser->numQueuedFrames].frameOffset = parser->frameOffset;
+                        parser->frameQueue[parser->numQueuedFrames].msgIndex = parser->msgIndex;
+                        parser->numQueuedFrames++;
+                        parser->scanOffset++;
+                        continue; // The last byte of a valid frame can't start a new frame
+                    }
+                    if (parser->numCRCErrors < UINT16_MAX)
+                    {
+                        parser->numCRCErrors++;
+                    }
+
+                    /* Rescan from the first preamble candidate inside the rejected frame */
+                    if (0 != parser->resyncOffset)
+                    {
+                        parser->scanOffset = parser->resyncOffset;
+                        dataIdx = rxCircBuffer->tail + parser->scanOffset;
+                        if (dataIdx >= rxCircBuffer->capacity)
+                        {
+                            dataIdx -= rxCircBuffer->capacity;
+                        }
+                        continue;
+                    }
+                }
+                break;
+
+            default:
+                parser->state = ECLIPSE_RS422_PARSE_PREAMBLE;
+                break;
         }
 
-        /* Determine if sufficient data has been received for the message */
-        incomingSize = cb_bytesUsed( rxCircBuffer );
-        if (incomingSize < (rxMsgs[msgIndex].msgConfig->length + ECLIPSE_RS422_MESSAGE_LENGTH_HEADER_AND_CRC))
+        /* Start a new frame on any preamble found while searching for one */
+        if ((ECLIPSE_RS422_PARSE_PREAMBLE == parser->state) &&
+                (ECLIPSE_RS422_MESSAGE_PREAMBLE == dataByte))
         {
-            break;
+            parser->frameOffset = parser->scanOffset;
+            parser->resyncOffset = 0;
+            parser->crc = CRC16_Update16bitCRC( ECLIPSE_RS422_CRC_SEED_VALUE, dataByte );
+            parser->candidateMsgs = (uint16_t) ((1ul << rxMsgsSize) - 1u);
+            parser->state = ECLIPSE_RS422_PARSE_DESTINATION;
         }
+        parser->scanOffset++;
+    }
+    return;
+}
 
-        /* Verify CRC */
-        uint16_t calculatedCRC;
-        size_t totalMsgLength = rxMsgs[msgIndex].msgConfig->length + ECLIPSE_RS422_MESSAGE_LENGTH_HEADER_AND_CRC;
+/*
+ * Function: EclipseRS422_MatchHeaderByte
+ * 
+ * Description: Removes every message from the candidate bitmask whose 
+ *      configuration doesn't match the header byte for the current parser 
+ *      state. Destination and source may match either the left or right 
+ *      device. 
+ * 
+ * Return: Bitmask of received messages that still match the header 
+ * 
+ * Requirement Implemented : INT1.0102.S.IOP.1.001
+ */
+static uint16_t EclipseRS422_MatchHeaderByte( const EclipseRS422parseState state,
+                                              const uint8_t dataByte,
+                                              const uint16_t candidateMsgs,
+                                              const uint8_t rxMsgsSize,
+                                              const EclipseRS422msg * const rxMsgs )
+{
+    uint16_t matchingMsgs = 0;
+    uint8_t msgIndex;
+    for (msgIndex = 0; msgIndex < rxMsgsSize; msgIndex++)
+    {
+        const uint16_t msgBit = (uint16_t) (1u << msgIndex);
+        if (0 == (candidateMsgs & msgBit))
+        {
+            continue;
+        }
 
-        /* If "tail" < "head" then the CRC can be calculated all in one go. */
-        if (rxCircBuffer->tail < rxCircBuffer->head)
+        const EclipseRS422msgConfig * const msgConfig = rxMsgs[msgIndex].msgConfig;
+        bool isMatch;
+        switch (state)
         {
-            calculatedCRC = CRC16_Calculate16bitCRC( rxCircBuffer->data + rxCircBuffer->tail,
-                                                     totalMsgLength, // change this to -2 to calc valid crc 
-                                                     ECLIPSE_RS422_CRC_SEED_VALUE );
+            case ECLIPSE_RS422_PARSE_DESTINATION:
+                isMatch = (dataByte == msgConfig->leftDestination) || (dataByte == msgConfig->rightDestination);
+                break;
+            case ECLIPSE_RS422_PARSE_SOURCE:
+                isMatch = (dataByte == msgConfig->leftSource) || (dataByte == msgConfig->rightSource);
+                break;
+            case ECLIPSE_RS422_PARSE_LENGTH:
+                isMatch = (dataByte == msgConfig->length);
+                break;
+            case ECLIPSE_RS422_PARSE_CMD:
+                isMatch = (dataByte == msgConfig->cmd);
+                break;
+            default:
+                isMatch = false;
+                break;
         }
-        else /* Head loops around end of buffer so CRC may need to be calculated in two steps */
+
+        if (true == isMatch)
         {
-            size_t bytesToVerify = min( totalMsgLength, rxCircBuffer->capacity - rxCircBuffer->tail );
+            matchingMsgs |= msgBit;
+        }
+    }
+    return matchingMsgs;
+}
+
+/*
+ * Function: EclipseRS422_RebaseParser
+ * 
+ * Description: Adjusts the parser's tail relative offsets after bytes have 
+ *      been removed from the front of the circular buffer. 
+ * 
+ * Return: None 
+ * 
+ * Requirement Implemented : INT1.0102.S.IOP.1.001
+ */
+static void EclipseRS422_RebaseParser( EclipseRS422parser * const parser,
+                                       const size_t numBytesRemoved )
+{
+    uint8_t queueIdx;
+    for (queueIdx = 0; queueIdx < parser->numQueuedFrames; queueIdx++)
+    {
+        parser->frameQueue[queueIdx].frameOffset -= numBytesRemoved;
+    }
+    parser->frameOffset = (parser->frameOffset > numBytesRemoved) ? parser->frameOffset - numBytesRemoved : 0;
+    parser->scanOffset = (parser->scanOffset > numBytesRemoved) ? parser->scanOffset - numBytesRemoved : 0;
+    parser->resyncOffset = (parser->resyncOffset > numBytesRemoved) ? parser->resyncOffset - numBytesRemoved : 0;
+    return;
+}
+
+/*
+ * Function: EclipseRS422_DiscardUnusedBytes
+ * 
+ * Description: Advances the circular buffer tail past parsed bytes that are 
+ *      not part of a queued frame or the frame currently being parsed. Bytes
+ *      between queued frames are released once the earlier frame is removed. 
+ * 
+ * Return: None 
+ * 
+ * Requirement Implemented : INT1.0102.S.IOP.1.001
+ */
+static void EclipseRS422_DiscardUnusedBytes( EclipseRS422parser * const parser,
+                                             circBuffer_t * const rxCircBuffer )
+{
+    size_t numBytesToDiscard;
+    if (0 != parser->numQueuedFrames)
+    {
+        numBytesToDiscard = parser->frameQueue[0].frameOffset;
+    }
+    else if (ECLIPSE_RS422_PARSE_PREAMBLE != parser->state)
+    {
+        numBytesToDiscard = parser->frameOffset;
+    }
+    else
+    {
+        numBytesToDiscard = parser->scanOffset;
+    }
 
-            calculatedCRC = CRC16_Calculate16bitCRC( rxCircBuffer->data + rxCircBuffer->tail,
-                                                     bytesToVerify,
-                                                     ECLIPSE_RS422_CRC_SEED_VALUE );
+    if (0 != numBytesToDiscard)
+    {
+        cb_advanceTail( rxCircBuffer, numBytesToDiscard );
+        EclipseRS422_RebaseParser( parser, numBytesToDiscard );
+    }
+    return;
+}
 
-            size_t bytesRemaining = totalMsgLength - bytesToVerify;
 
-            if (bytesRemaining > 0)
+/*
+ * Function: EclipseRS422_TakeNextFrame
+ * 
+ * Description: Parses any new bytes in the receive circular buffer and takes 
+ *      the oldest verified frame off the parser's frame queue. The frame is 
+ *      left in the circular buffer until EclipseRS422_RemoveFrame is called. 
+ *      If no frame is available, parsed bytes that can't be part of a frame 
+ *      are discarded. 
+ * 
+ * Return: True if a verified frame was taken off the queue 
+ * 
+ * Requirement Implemented : INT1.0102.S.IOP.1.001
+ */
+static bool EclipseRS422_TakeNextFrame( EclipseRS422parser * const parser,
+                                        circBuffer_t * const rxCircBuffer,
+                                        const uint8_t rxMsgsSize,
+                                        const EclipseRS422msg * const rxMsgs,
+                                        EclipseRS422frame * const frame )
+{
+    if ((NULL == parser) ||
+            (NULL == rxCircBuffer) ||
+            (NULL == rxMsgs) ||
+            (rxMsgsSize > ECLIPSE_RS422_MAX_NUM_RX_MSGS))
+    {
+        return false;
+    }
+
+    /* The circular buffer was reset underneath the parser. Start again at the tail. */
+    if (parser->scanOffset > cb_bytesUsed( rxCircBuffer ))
+    {
+        EclipseRS422_ResetParser( parser );
+    }
+
+    EclipseRS422_ParseNewBytes( parser, rxCircBuffer, rxMsgsSize, rxMsgs );
+
+    if (0 == parser->numQueuedFrames)
+    {
+        EclipseRS422_DiscardUnusedBytes( parser, rxCircBuffer );
+        return false;
+    }
+
+    /* Remove the oldest frame from the queue */
+    *frame = parser->frameQueue[0];
+    uint8_t queueIdx;
+    parser->numQueuedFrames--;
+    for (queueIdx = 0; queueIdx < parser->numQueuedFrames; queueIdx++)
+    {
+        parser->frameQueue[queueIdx] = parser->frameQueue[queueIdx + 1];
+    }
+    return true;
+}
+
+/*
+ * Function: EclipseRS422_RemoveFrame
+ * 
+ * Description: Copies a frame's data out to the rxMsg's data array, if it has 
+ *      one, and flags the data as new. Then advances the circular buffer tail 
+ *      past the frame and any unused bytes that follow it. Resets the rxMsg's 
+ *      bus timeout count. 
+ * 
+ * Return: None 
+ * 
+ * Requirement Implemented : INT1.0102.S.IOP.1.001
+ */
+static void EclipseRS422_RemoveFrame( EclipseRS422parser * const parser,
+                                      circBuffer_t * const rxCircBuffer,
+                                      EclipseRS422msg * const rxMsgs,
+                                      const EclipseRS422frame * const frame )
+{
+    EclipseRS422msg * const rxMsg = &rxMsgs[frame->msgIndex];
+
+    if (NULL != rxMsg->data)
+    {
+        circBufferSpan_t spans[CB_NUM_SPANS];
+        uint8_t * dest = rxMsg->data;
+        size_t spanIdx;
+        size_t byteIdx;
+
+        cb_peekSpans( rxCircBuffer,
+                      frame->frameOffset + ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET,
+                      rxMsg->msgConfig->length - 1,
+                      spans );
+        for (spanIdx = 0; spanIdx < CB_NUM_SPANS; spanIdx++)
+        {
+            for (byteIdx = 0; byteIdx < spans[spanIdx].length; byteIdx++)
             {
-                calculatedCRC = CRC16_Calculate16bitCRC( rxCircBuffer->data,
-                                                         totalMsgLength - bytesToVerify,
-                                                         calculatedCRC );
+                *dest = spans[spanIdx].data[byteIdx];
+                dest++;
             }
         }
+        rxMsg->isNewDataAvailable = true;
+    }
 
-        /* If the CRC of the received message was invalid, advance the tail and return false. */
-        if (0x0 != calculatedCRC)
+    const size_t numBytesRemoved = frame->frameOffset + rxMsg->msgConfig->length + ECLIPSE_RS422_MESSAGE_LENGTH_HEADER_AND_CRC;
+    cb_advanceTail( rxCircBuffer, numBytesRemoved );
+    EclipseRS422_RebaseParser( parser, numBytesRemoved );
+    EclipseRS422_DiscardUnusedBytes( parser, rxCircBuffer );
+
+    rxMsg->timeStamp_counts = 0;
+    return;
+}
+
+/*
+ * Function: EclipseRS422_CreateARINCWordsInPlace
+ * 
+ * Description: Composes ARINC429 words straight from a verified frame's data 
+ *      while it is still held in the receive circular buffer. The data is in
+ *      at most two contiguous spans; a word split across the end of the 
+ *      buffer is assembled a byte at a time. Each word is input to the 
+ *      ProcessReceivedMessage function, as in EclipseRS422_CreateARINCWords. 
+ * 
+ * Return: None 
+ * 
+ * Requirement Implemented : INT1.0102.S.IOP.1.002
+ */
+static void EclipseRS422_CreateARINCWordsInPlace( const circBuffer_t * const rxCircBuffer,
+                                                  const EclipseRS422frame * const frame,
+                                                  const EclipseRS422msgConfig * const msgConfig,
+                                                  ARINC429_RxMsgArray * const ArincMsgArray )
+{
+    const uint8_t numARINCMessages = (msgConfig->length - 1) / NUM_BYTES_ARINC_MSG;
+    if (numARINCMessages > MAX_NUM_ARINC_MESSAGES)
+    {
+        return; // Error, shouldn't happen. 
+    }
+
+    circBufferSpan_t spans[CB_NUM_SPANS];
+    const size_t numDataBytes = (size_t) numARINCMessages * NUM_BYTES_ARINC_MSG;
+    if (numDataBytes != cb_peekSpans( rxCircBuffer,
+                                      frame->frameOffset + ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET,
+                                      numDataBytes,
+                                      spans ))
+    {
+        return;
+    }
+
+    const uint8_t * data = spans[0].data;
+    size_t bytesInSpan = spans[0].length;
+    uint8_t counter;
+    uint32_t arincWord;
+    for (counter = 0; counter < numARINCMessages; counter++)
+    {
+        if (bytesInSpan >= NUM_BYTES_ARINC_MSG)
         {
-            cb_advanceTail( rxCircBuffer, 1 ); /* Message is invalid, discard */
-            return false;
+            // Note: Received label is in flipped format 
+            arincWord = ((uint32_t) (data[0]) |
+                    ((uint32_t) (data[1]) << ARINC_BYTE_ONE_OFFSET) |
+                    ((uint32_t) (data[2]) << ARINC_BYTE_TWO_OFFSET) |
+                    ((uint32_t) (data[3]) << ARINC_BYTE_THREE_OFFSET));
+            data += NUM_BYTES_ARINC_MSG;
+            bytesInSpan -= NUM_BYTES_ARINC_MSG;
         }
         else
         {
-            /* CRC is good. Copy message data. */
-            cb_advanceTail( rxCircBuffer,
-                            ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET );
-
-            if (NULL != rxMsgs[msgIndex].data)
+            /* Word wraps around the end of the buffer */
+            uint8_t byteIdx;
+            arincWord = 0;
+            for (byteIdx = 0; byteIdx < NUM_BYTES_ARINC_MSG; byteIdx++)
             {
-                cb_flushOut( rxCircBuffer,
-                             rxMsgs[msgIndex].data, // linear buffer where data from circular buffer is loaded to
-                             rxMsgs[msgIndex].msgConfig->length - 1 ); // number of bytes to be loaded from circular buffer into destination buffer (limited to data available in circular buffer)
+                if (0 == bytesInSpan)
+                {
+                    data = spans[1].data;
+                    bytesInSpan = spans[1].length;
+                }
+                arincWord |= (uint32_t) (*data) << (byteIdx * NUM_BITS_IN_BYTE);
+                data++;
+                bytesInSpan--;
             }
-            rxMsgs[msgIndex].timeStamp_counts = 0;
-            cb_advanceTail( rxCircBuffer, 2 );
-            *returnMsgIndex = msgIndex;
-            return true;
         }
+
+        if (0 == bytesInSpan)
+        {
+            data = spans[1].data;
+            bytesInSpan = spans[1].length;
+        }
+        ARINC429_ProcessReceivedMessage( ArincMsgArray, arincWord );
     }
-    return false; // Generic end condition for all above breaks in while true loop
+    return;
+}
+
+
+/*
+ * Function: EclipseRS422_WriteTxByte
+ * 
+ * Description: Writes the next byte of a transmit message into the reserved 
+ *      space, moving on to the second span when the first is full, and folds 
+ *      it into the message's running CRC. The caller reserves space for the 
+ *      whole message before writing. 
+ * 
+ * Return: None 
+ * 
+ * Requirement Implemented: INT1.0102.S.IOP.1.003
+ */
+static void EclipseRS422_WriteTxByte( EclipseRS422txWriter * const writer,
+                                      const uint8_t dataByte )
+{
+    if (writer->byteIdx >= writer->spans[writer->spanIdx].length)
+    {
+        writer->spanIdx = 1;
+        writer->byteIdx = 0;
+    }
+    writer->spans[writer->spanIdx].data[writer->byteIdx] = dataByte;
+    writer->byteIdx++;
+    writer->crc = CRC16_Update16bitCRC( writer->crc, dataByte );
+    return;
+}
+
+/*
+ * Function: EclipseRS422_CarriesARINCWords
+ * 
+ * Description: Tells whether a message's data field is a sequence of ARINC429 
+ *      words. Version replies carry ASCII and serial number bytes instead, and 
+ *      are only copied out to their data array. 
+ * 
+ * Return: True if the message's data is composed into ARINC429 words 
+ * 
+ * Requirement Implemented : INT1.0102.S.IOP.1.002
+ */
+static bool EclipseRS422_CarriesARINCWords( const EclipseRS422cmd cmd )
+{
+    return ((ADC_COMPUTED_DATA_CMD == cmd) ||
+            (ADC_STATUS_CMD == cmd) ||
+            (AHRS_CURRENT_DATA_CMD == cmd)) ? true : false;
+}
+
+
+/**************  Function Definition(s) ********************/
+
+/*
+ * Function: EclipseRS422_ResetParser
+ * 
+ * Description: Returns a receive parser to its initial state. Any partially 
+ *      parsed or queued frames are forgotten, but no bytes are removed from 
+ *      the receive circular buffer. The next call to 
+ *      EclipseRS422_ProcessNewMessage starts parsing again at the buffer's tail. 
+ *      The CRC error count is kept, as a circular buffer's statistics are kept
+ *      by cb_reset, so a resynchronization does not hide the errors on the 
+ *      link. It is only zeroed by the parser's initializer.
+ * 
+ * Return: None 
+ *
+ * Requirement Implemented : INT1.0102.S.IOP.1.001
+ */
+void EclipseRS422_ResetParser( EclipseRS422parser * const parser )
+{
+    if (NULL == parser)
+    {
+        return;
+    }
+
+    parser->state = ECLIPSE_RS422_PARSE_PREAMBLE;
+    parser->crc = ECLIPSE_RS422_CRC_SEED_VALUE;
+    parser->candidateMsgs = 0;
+    parser->msgIndex = 0;
+    parser->numQueuedFrames = 0;
+    parser->scanOffset = 0;
+    parser->frameOffset = 0;
+    parser->resyncOffset = 0;
+    parser->bytesRemaining = 0;
+    return;
+}
+
+/* 
+ * Function: EclipseRS422messages_ProcessNew
+ * 
+ * Description: Parses new bytes in a receive circular buffer for Eclipse RS422 
+ *      receive messages. Each byte is parsed exactly once by the input parser's 
+ *      state machine (preamble, destination, source, length, cmd, payload, CRC), 
+ *      with the 16 bit CRC updated as each byte is parsed. The header fields 
+ *      are matched against every message configuration in the receive message 
+ *      array (source, destination, cmd, length) as they arrive. Bytes left over
+ *      from a partial frame stay in the buffer and parsing resumes from where 
+ *      it stopped on the next call. 
+ * 
+ *      Verified frames are added to the parser's frame queue and left in the 
+ *      circular buffer. Parsing stops when the queue is full. The oldest queued 
+ *      frame is then removed: its data is copied out to the rxMsg's data array 
+ *      and the tail is advanced past it. Bytes that can't be part of a frame 
+ *      are discarded. 
+ * 
+ *      If a valid message is found, return true and set the input pointer value 
+ *      to the EclipseRS422msg array's valid message index. 
+ * 
+ * Return: True if a message was successfully processed, false if invalid message. 
+ *
+ * Requirement Implemented : INT1.0102.S.IOP.1.001
+ */
+
+bool EclipseRS422_ProcessNewMessage( EclipseRS422parser * const parser, // receive parser state for this circular buffer
+                                     circBuffer_t * const rxCircBuffer, // circular buffer object
+                                     const uint8_t rxMsgsSize, // Number of received messages in array
+                                     EclipseRS422msg * const rxMsgs, // received messages array
+                                     size_t * const returnMsgIndex ) // return parameter for a message index if a valid msg was found. 
+{
+    if (NULL == returnMsgIndex)
+    {
+        return false;
+    }
+
+    EclipseRS422frame frame;
+    if (false == EclipseRS422_TakeNextFrame( parser, rxCircBuffer, rxMsgsSize, rxMsgs, &frame ))
+    {
+        return false;
+    }
+
+    EclipseRS422_RemoveFrame( parser, rxCircBuffer, rxMsgs, &frame );
+    *returnMsgIndex = frame.msgIndex;
+    return true;
+}
+
+/*
+ * Function: EclipseRS422_ProcessAllNewMessages
+ * 
+ * Description: Processes every complete message in a receive circular buffer
+ *      in one call, composing each into ARINC429 words. Messages that arrive 
+ *      back to back are therefore not left in the buffer for a later pass. 
+ * 
+ *      Messages whose rxMsg has no data array are decoded in place, straight 
+ *      from the one or two contiguous spans of the circular buffer that hold 
+ *      the frame, before the tail is advanced past it. Messages with a data 
+ *      array are copied out and composed with EclipseRS422_CreateARINCWords 
+ *      before the next message can overwrite the array. 
+ * 
+ *      Messages that don't carry ARINC429 words, such as the software and 
+ *      hardware version replies, are only copied out to their data array and 
+ *      flagged as new for the module that requested them. 
+ * 
+ *      Frames rejected on CRC are counted in the parser's running CRC error 
+ *      count. 
+ * 
+ * Return: None 
+ *
+ * Requirement Implemented : INT1.0102.S.IOP.1.002
+ */
+void EclipseRS422_ProcessAllNewMessages( EclipseRS422parser * const parser, /* Receive parser state for this circular buffer */
+                                        circBuffer_t * const rxCircBuffer, /* Receive circular buffer */
+                                        const uint8_t rxMsgsSize, /* Number of received messages in array */
+                                        EclipseRS422msg * const rxMsgs, /* Received messages array */
+                                        ARINC429_RxMsgArray * const ArincMsgArray ) /* Pointer to ARINC msg array */
+{
+    if ((NULL == parser) ||
+            (NULL == ArincMsgArray))
+    {
+        return;
+    }
+
+    EclipseRS422frame frame;
+    while (true == EclipseRS422_TakeNextFrame( parser, rxCircBuffer, rxMsgsSize, rxMsgs, &frame ))
+    {
+        const bool hasARINCWords = EclipseRS422_CarriesARINCWords( rxMsgs[frame.msgIndex].msgConfig->cmd );
+        const bool isDecodedInPlace = (NULL == rxMsgs[frame.msgIndex].data);
+        if ((true == hasARINCWords) && (true == isDecodedInPlace))
+        {
+            EclipseRS422_CreateARINCWordsInPlace( rxCircBuffer,
+                                                  &frame,
+                                                  rxMsgs[frame.msgIndex].msgConfig,
+                                                  ArincMsgArray );
+        }
+
+        EclipseRS422_RemoveFrame( parser, rxCircBuffer, rxMsgs, &frame );
+
+        if ((true == hasARINCWords) && (false == isDecodedInPlace))
+        {
+            EclipseRS422_CreateARINCWords( rxMsgs,
+                                           ArincMsgArray,
+                                           frame.msgIndex,
+                                           rxMsgsSize );
+        }
+    }
+    return;
 }
 
 /*
  * Function: EclipseRS422messages_ConstructTxMsg 
  * 
- * Description: Constructs an RS422 transmit message and flushes to the 
+ * Description: Constructs an RS422 transmit message directly in the 
  *          transmit circular buffer. Inputs an array of ARINC429 words,
  *          a pointer to an EclipseRS422 message array, a pointer to the 
  *          desired transmit circular buffer, the number of ARINC429 words
@@ -215,9 +757,13 @@ bool EclipseRS422_ProcessNewMessage( circBuffer_t * const rxCircBuffer, // circu
  *          flush to the transmit circular buffer. The number of bytes to flush
  *          equals the message length of the desired transmit message. 
  * 
- *          Message construction adds Eclipse's header, source, destination, msg 
- *          length, command, data, and appends the 16 bit crc to the end of the 
- *          message before flushing into the transmit circular buffer. 
+ *          Space for the whole message is reserved in the transmit circular 
+ *          buffer and Eclipse's header, source, destination, msg length, command,
+ *          data and 16 bit crc are written into it in place, with the crc 
+ *          calculated as each byte is written. The header is committed as soon 
+ *          as it is written, so a transmit interrupt that is still sending 
+ *          the previous message can start on it while the rest is built. 
+ *          The message is not sent if the buffer can't hold all of it. 
  * 
  *          Guards against constructing a tx array larger than a circular buffer
  *          can handle. This must be maintained based on the circular buffer size. 
@@ -249,15 +795,23 @@ void EclipseRS422_ConstructTxMsg( EclipseRS422msg * const rs422TxMsg, /* Pointer
         return;
     }
 
-    /* Modify the arinc array to calculate odd parity for each respective ARINC word */
-    size_t counter;
-    uint32_t * thisARINCWord = arincArray;
-    uint32_t tempARINCWord = *thisARINCWord; // Create a copy of, but not a reference to, the input ARINC array. 
+    /* The message is sent whole or not at all */
+    EclipseRS422txWriter writer;
+    const size_t msgLength = ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET + (numArincWords * NUM_BYTES_ARINC_MSG) + ECLIPSE_RS422_MESSAGE_CRC_LENGTH;
+    if ((numBytesToFlush != msgLength) ||
+            (msgLength != cb_reserve( txBuff, msgLength, writer.spans )))
+    {
+        return;
+    }
+    writer.spanIdx = 0;
+    writer.byteIdx = 0;
+    writer.crc = ECLIPSE_RS422_CRC_SEED_VALUE;
 
     /* Calculate and append (if needed) the odd parity of each ARINC Word */
+    size_t counter;
     for (counter = 0; counter < numArincWords; counter++)
     {
-        tempARINCWord &= 0x7FFFFFFF; // This should be unnecessary. 
+        uint32_t tempARINCWord = arincArray[counter] & 0x7FFFFFFF; // This mask should be unnecessary. 
         tempARINCWord ^= tempARINCWord >> 1;
         tempARINCWord ^= tempARINCWord >> 2;
         tempARINCWord = (tempARINCWord & 0x11111111U) * 0x11111111U;
@@ -267,60 +821,51 @@ void EclipseRS422_ConstructTxMsg( EclipseRS422msg * const rs422TxMsg, /* Pointer
          */
         if (0 == ((tempARINCWord >> 28) &1))
         {
-            *thisARINCWord |= ARINC_PARITY_SET;
+            arincArray[counter] |= ARINC_PARITY_SET;
         }
-
-        thisARINCWord++;
-        tempARINCWord = *thisARINCWord;
     }
 
     /* Assemble header of messages */
-    rs422TxMsg->data[ECLIPSE_RS422_MESSAGE_PREAMBLE_INDEX] = ECLIPSE_RS422_MESSAGE_PREAMBLE;
+    uint8_t destination;
+    uint8_t source;
     switch (magHeadingSDI)
     {
         case (0x01): // left case
-            rs422TxMsg->data[ECLIPSE_RS422_MESSAGE_DESTINATION_INDEX] = rs422TxMsg->msgConfig->leftDestination;
-            rs422TxMsg->data[ECLIPSE_RS422_MESSAGE_SOURCE_INDEX] = rs422TxMsg->msgConfig->leftSource;
+            destination = rs422TxMsg->msgConfig->leftDestination;
+            source = rs422TxMsg->msgConfig->leftSource;
             break;
         case (0x03): // right case
-            rs422TxMsg->data[ECLIPSE_RS422_MESSAGE_DESTINATION_INDEX] = rs422TxMsg->msgConfig->rightDestination;
-            rs422TxMsg->data[ECLIPSE_RS422_MESSAGE_SOURCE_INDEX] = rs422TxMsg->msgConfig->rightSource;
+            destination = rs422TxMsg->msgConfig->rightDestination;
+            source = rs422TxMsg->msgConfig->rightSource;
             break;
         default:
             // look back at this. SDI is an optional field, and lack of SDI shouldn't invalidate a tx msg 
-            rs422TxMsg->data[ECLIPSE_RS422_MESSAGE_DESTINATION_INDEX] = rs422TxMsg->msgConfig->leftDestination;
-            rs422TxMsg->data[ECLIPSE_RS422_MESSAGE_SOURCE_INDEX] = rs422TxMsg->msgConfig->leftSource;
+            destination = rs422TxMsg->msgConfig->leftDestination;
+            source = rs422TxMsg->msgConfig->leftSource;
             break;
     }
-    rs422TxMsg->data[ECLIPSE_RS422_MESSAGE_LENGTH_INDEX] = rs422TxMsg->msgConfig->length;
-    rs422TxMsg->data[ECLIPSE_RS422_MESSAGE_CMD_INDEX] = rs422TxMsg->msgConfig->cmd;
-
-    /* Create a pointer to the data portion of the eclipse txMsg */
-    uint8_t* txMsgBuff = rs422TxMsg->data + ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET;
-
-    /* Iterate through ARINC raw word struct and store values, byte by byte, into rs422 output stream. */
+    EclipseRS422_WriteTxByte( &writer, ECLIPSE_RS422_MESSAGE_PREAMBLE );
+    EclipseRS422_WriteTxByte( &writer, destination );
+    EclipseRS422_WriteTxByte( &writer, source );
+    EclipseRS422_WriteTxByte( &writer, rs422TxMsg->msgConfig->length );
+    EclipseRS422_WriteTxByte( &writer, rs422TxMsg->msgConfig->cmd );
+    cb_commit( txBuff, ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET );
+
+    /* Write ARINC words, byte by byte, into the rs422 output stream. */
     uint8_t arincWordCounter;
-
     for (arincWordCounter = 0; arincWordCounter < numArincWords; arincWordCounter++)
     {
-        txMsgBuff[3] = (uint8_t) ((arincArray[arincWordCounter] >> ARINC_BYTE_THREE_OFFSET) & LS_BYTE_BITMASK);
-        txMsgBuff[2] = (uint8_t) ((arincArray[arincWordCounter] >> ARINC_BYTE_TWO_OFFSET) & LS_BYTE_BITMASK);
-        txMsgBuff[1] = (uint8_t) ((arincArray[arincWordCounter] >> ARINC_BYTE_ONE_OFFSET) & LS_BYTE_BITMASK);
-        txMsgBuff[0] = (uint8_t) (arincArray[arincWordCounter] & LS_BYTE_BITMASK);
-        txMsgBuff += NUM_BYTES_ARINC_MSG;
+        EclipseRS422_WriteTxByte( &writer, (uint8_t) (arincArray[arincWordCounter] & LS_BYTE_BITMASK) );
+        EclipseRS422_WriteTxByte( &writer, (uint8_t) ((arincArray[arincWordCounter] >> ARINC_BYTE_ONE_OFFSET) & LS_BYTE_BITMASK) );
+        EclipseRS422_WriteTxByte( &writer, (uint8_t) ((arincArray[arincWordCounter] >> ARINC_BYTE_TWO_OFFSET) & LS_BYTE_BITMASK) );
+        EclipseRS422_WriteTxByte( &writer, (uint8_t) ((arincArray[arincWordCounter] >> ARINC_BYTE_THREE_OFFSET) & LS_BYTE_BITMASK) );
     }
 
-    /* Calculate and append the CRC of the message */
-    uint16_t crc = CRC16_Calculate16bitCRC( rs422TxMsg->data,
-                                            txMsgBuff - rs422TxMsg->data,
-                                            ECLIPSE_RS422_CRC_SEED_VALUE );
-    txMsgBuff[0] = (uint8_t) ((crc >> NUM_BITS_IN_BYTE) & LS_BYTE_BITMASK);
-    txMsgBuff[1] = crc & LS_BYTE_BITMASK;
-
-    /* Flush the assembled RS422 tx message to the input tx message's data */
-    cb_flushIn( txBuff,
-                rs422TxMsg->data, /* Note: This is the FULL msg, not just the data portion */
-                numBytesToFlush );
+    /* Append the CRC of the message and commit the rest of it */
+    const uint16_t crc = writer.crc;
+    EclipseRS422_WriteTxByte( &writer, (uint8_t) ((crc >> NUM_BITS_IN_BYTE) & LS_BYTE_BITMASK) );
+    EclipseRS422_WriteTxByte( &writer, crc & LS_BYTE_BITMASK );
+    cb_commit( txBuff, msgLength - ECLIPSE_RS422_MESSAGE_DATA_START_OFFSET );
     return;
 }
 
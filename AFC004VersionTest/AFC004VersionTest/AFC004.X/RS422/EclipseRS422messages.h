@@ -28,6 +28,10 @@
 #define ECLIPSE_RS422_ADC_COMPUTED_DATA_MSG_LENGTH  0x51 // Expected length field value for ADC computed data command
 #define ECLIPSE_RS422_ADC_STATUS_MSG_LENGTH         0x05 // Expected length field value for ADC status command
 #define ECLIPSE_RS422_AHRS_CURRENT_DATA_MSG_LENGTH 0x15 /* Messages lengths to transmit. Length includes header, crc, etc. */
+#define ECLIPSE_RS422_ADC_SWVERSION_REPLY_MSG_LENGTH 0x19 // Expected length field value for ADC software version reply
+#define ECLIPSE_RS422_ADC_HWVERSION_REPLY_MSG_LENGTH 0x09 // Expected length field value for ADC hardware serial number reply
+#define ECLIPSE_RS422_FRAME_QUEUE_SIZE              4u   // Number of verified frames the receive parser can hold before it stops parsing
+#define ECLIPSE_RS422_MAX_NUM_RX_MSGS               16u  // Receive message array size supported by the parser's candidate bitmask
 
 /**************  Type Definition(s) ************************/
 /* Device codes for Eclipse's RS422 systems */
@@ -63,16 +67,54 @@ typedef struct {
 /* Eclipse message structure */
 typedef struct {
     const EclipseRS422msgConfig* msgConfig;
-    uint8_t* data; /* Can be configured to transmit or receive */
+    uint8_t* data; /* Can be configured to transmit or receive. NULL rx data is decoded in place from the circular buffer */
     uint32_t timeStamp_counts; // Counts in 10ms increments. 
     const uint32_t timeStamp_max_counts; // max timeout stamps that can occur before bus failure;
     bool hasBusFailed; // important- this must be initialized to true on startup. 
+    bool isNewDataAvailable; // Set when a received frame is copied to the data array. Cleared by the reader of the data. 
 } EclipseRS422msg;
 
+/* Receive parser states, in the order the fields of a frame arrive */
+typedef enum EclipseRS422parseState_t {
+    ECLIPSE_RS422_PARSE_PREAMBLE = 0,
+    ECLIPSE_RS422_PARSE_DESTINATION,
+    ECLIPSE_RS422_PARSE_SOURCE,
+    ECLIPSE_RS422_PARSE_LENGTH,
+    ECLIPSE_RS422_PARSE_CMD,
+    ECLIPSE_RS422_PARSE_PAYLOAD,
+    ECLIPSE_RS422_PARSE_CRC
+} EclipseRS422parseState;
+
+/* Verified frame still held in the receive circular buffer */
+typedef struct {
+    size_t frameOffset; // Offset of the frame's preamble from the circular buffer tail
+    uint8_t msgIndex; // Index of the matching message in the received messages array
+} EclipseRS422frame;
+
+/* Incremental receive parser. One is required per receive circular buffer and 
+ * received messages array pairing. A zero initialized parser is ready for use. */
+typedef struct {
+    EclipseRS422parseState state;
+    uint16_t crc; // Running CRC of the frame being parsed
+    uint16_t candidateMsgs; // Bitmask of received messages whose header still matches
+    uint8_t msgIndex; // Matched message index once the cmd field has been parsed
+    uint8_t numQueuedFrames;
+    size_t scanOffset; // Number of bytes past the circular buffer tail already parsed
+    size_t frameOffset; // Offset of the current frame's preamble from the circular buffer tail
+    size_t resyncOffset; // Offset of the first preamble byte inside the current frame's payload or CRC, 0 if none
+    size_t bytesRemaining; // Bytes left in the current payload or CRC field
+    uint16_t numCRCErrors; // Running count of frames rejected on CRC, saturates. Not cleared by EclipseRS422_ResetParser
+    EclipseRS422frame frameQueue[ECLIPSE_RS422_FRAME_QUEUE_SIZE]; // Oldest frame first
+} EclipseRS422parser;
+
 
 /**************  Function Prototype(s) *********************/
+/* Return a receive parser to its initial state */
+void EclipseRS422_ResetParser(EclipseRS422parser * const parser);
+
 /* Parse the UART2 receive circular buffer for new Eclipse Aviation RS422 messages */
-bool EclipseRS422_ProcessNewMessage(circBuffer_t * const rxCircBuffer, // circular buffer object
+bool EclipseRS422_ProcessNewMessage(EclipseRS422parser * const parser, // receive parser state for this circular buffer
+        circBuffer_t * const rxCircBuffer, // circular buffer object
         const uint8_t rxMsgsSize, // Number of received messages in array
         EclipseRS422msg * const rxMsgs, // received messages array
         size_t * const returnMsgIndex); // return parameter for a message index if a valid msg was found. 
@@ -90,6 +132,13 @@ void EclipseRS422_CreateARINCWords(const EclipseRS422msg * const RS422Msg, /* Po
         const size_t msgIdx, /* Number of ARINC words to process */
         const size_t numMsgsInRS422Array); /* Total number of members in input EclipseRS422msg array */
 
+/* Process every complete message in the receive circular buffer into ARINC words */
+void EclipseRS422_ProcessAllNewMessages(EclipseRS422parser * const parser, /* Receive parser state for this circular buffer */
+        circBuffer_t * const rxCircBuffer, /* Receive circular buffer */
+        const uint8_t rxMsgsSize, /* Number of received messages in array */
+        EclipseRS422msg * const rxMsgs, /* Received messages array */
+        ARINC429_RxMsgArray * const ArincMsgArray); /* Pointer to ARINC msg array */
+
 bool EclipseRS422_processBusFailure(EclipseRS422msg * const RS422Msg,
         const size_t numMsgs);
 
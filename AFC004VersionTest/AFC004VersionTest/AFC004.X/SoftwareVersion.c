@@ -15,7 +15,6 @@
 #include "SoftwareVersion.h"
 #include "EclipseRS422messages.h"
 #include "COMUART1.h"
-#include "Timer23.h"
 #include <string.h>
 #include "IOPConfig.h"
 
@@ -31,8 +30,8 @@
 /* Eclipse-specific macros */
 #define ECLIPSE_RS422_VERSION_REQUEST_TXMSG_LENGTH 0x7 // length of entire tx msg. used for both hw and sw. 
 #define ECLIPSE_RS422_VERSION_REQUEST_MSG_LENGTH 0x01  // length of data + cmd field
-#define ECLIPSE_RS422_ADC_SWVERSION_REPLY_MSG_LENGTH 0x19 // bytes
-#define ECLIPSE_RS422_ADC_HWVERSION_REPLY_MSG_LENGTH 0x09 // bytes
+#define ECLIPSE_RS422_VERSION_REQUEST_SDI 0x01 // SDI passed to the tx msg constructor. Unused by a request with no data. 
+#define MAX_NUM_VERSION_REQUESTS 10 // Requests sent, one per frame, before a version is given up on
 
 /* Message lengths specific to Eclipse's SCI version system */
 #define ECLIPSE_RS422_SWVERSION_DATA_LENGTH 12
@@ -60,6 +59,14 @@ enum
     CC_PAOA = 0x17
 } SW_VER_Subsystem_Index;
 
+/* Version gathering steps, advanced once per frame by SWVer_ProcessGathering */
+typedef enum
+{
+    SWVER_GATHER_SW_VERSION = 0,
+    SWVER_GATHER_HW_VERSION,
+    SWVER_GATHER_COMPLETE
+} SWVer_GatherState;
+
 
 
 /**************  Local Variable(s) *************************/
@@ -67,6 +74,18 @@ static uint8_t swVersions[NUM_AFC004_SCI][NUM_BYTES_PER_SCI_VERSION];
 static size_t msg_idx = 0; // Should be function-static, but is global for unit testing
 static size_t sys_idx = 0; // Should be function-static, but is global for unit testing
 
+/* Version gathering state. Starts complete so nothing is sent before SWVer_StartGathering */
+static struct
+{
+    SWVer_GatherState state;
+    size_t requestCount; // Requests sent for the version being gathered
+    circBuffer_t * txBuff; // ADC transmit circular buffer
+    EclipseRS422msg * swVersionReplyMsg; // Reply messages, filled in by the main loop's RS422 parser
+    EclipseRS422msg * hwVersionReplyMsg;
+} gather = {
+    .state = SWVER_GATHER_COMPLETE
+};
+
 
 /**************  Local Constant(s) *************************/
 /* Indices used to index the 2d array*/
@@ -75,13 +94,41 @@ static const size_t adcSCIidx = 1;
 static const size_t paoaSCIidx = 2;
 static const uint8_t subsystemVersionArray[NUM_AFC004_SCI] = { CC_AFC004, CC_ADC, CC_PAOA };
 
+/* Software Version Request Configuration */
+static const EclipseRS422msgConfig swVerADCRequestCfg = {
+    .cmd = SOFTWARE_VERSION_CMD,
+    .leftSource = LEFT_AHRS,
+    .rightSource = RIGHT_AHRS,
+    .leftDestination = LEFT_ADC,
+    .rightDestination = RIGHT_ADC,
+    .length = ECLIPSE_RS422_VERSION_REQUEST_MSG_LENGTH
+};
+
+/* Hardware Version Request Configuration */
+static const EclipseRS422msgConfig hwVerADCRequestCfg = {
+    .cmd = HARDWARE_SERIAL_NUMBER_CMD,
+    .leftSource = LEFT_AHRS,
+    .rightSource = RIGHT_AHRS,
+    .leftDestination = LEFT_ADC,
+    .rightDestination = RIGHT_ADC,
+    .length = ECLIPSE_RS422_VERSION_REQUEST_MSG_LENGTH
+};
+
+/* Tx messages are constructed in place in the tx circular buffer, so have no data array. */
+static EclipseRS422msg swVersionRequestADCMsg = {
+    .msgConfig = &swVerADCRequestCfg,
+    .data = NULL
+};
+
+static EclipseRS422msg hwVersionRequestADCMsg = {
+    .msgConfig = &hwVerADCRequestCfg,
+    .data = NULL
+};
+
 
 /**************  Function Prototype(s) *********************/
-static bool SWVer_GatherRequest( EclipseRS422msg * const rs422txMsg, // REquest message
-                                 EclipseRS422msg * const rs422rxMsg, // Received reply message
-                                 circBuffer_t * const txBuff, // Transmit circular buffer
-                                 circBuffer_t * const rxBuff, // Receive circular buffer  
-                                 const uint8_t magHeadingSDI ); // SDI of magnetic heading 
+static bool SWVer_StepRequest( EclipseRS422msg * const rs422txMsg, // Request message
+                               const EclipseRS422msg * const rs422rxMsg ); // Received reply message
 
 
 
@@ -102,89 +149,70 @@ uint8_t asciiConverter( const uint8_t val )
 }
 
 /*
- * Function: SWVer_GatherRequest
+ * Function: SWVer_StepRequest
  * 
- * Description: Composes an RS422 transmit message to request a subsystem's 
- *      software and hardware version. The input EclipseRS422 tx message 
- *      is the request message. This txMsg pointer is input to the EclipseRS422_ConstructTxMsg
- *      function, where it composes a valid EclipseRS422 message with the appended 
- *      16 bit CRC. This composed message is flushed into the transmit circular 
- *      buffer and transmission is started. A 5ms wait period is entered, then 
- *      the reply is searched for in the receive circular buffer. Repeat, for a 
- *      maximum of ten times, to search for a valid reply. 
+ * Description: Runs one frame of a version request. If the reply has been 
+ *      received by the main loop's RS422 parser since the last request was 
+ *      sent, the request is finished. Otherwise the request is composed with 
+ *      EclipseRS422_ConstructTxMsg, which appends the 16 bit CRC and flushes 
+ *      it into the transmit circular buffer, and transmission is started. The 
+ *      reply is looked for on the next frame. After a maximum of ten requests 
+ *      without a reply, the request is finished without one. 
  * 
- *  
- * Return: True if a valid version was received. 
+ * Return: True if the request is finished. 
  * 
  * Requirement Implemented: INT1.0101.S.IOP.6.001
  * 
  */
-static bool SWVer_GatherRequest( EclipseRS422msg * const rs422txMsg, // Request message
-                                 EclipseRS422msg * const rs422rxMsg, // Received reply message
-                                 circBuffer_t * const txBuff, // Transmit circular buffer
-                                 circBuffer_t * const rxBuff, // Receive circular buffer  
-                                 const uint8_t magHeadingSDI ) // SDI of magnetic heading 
+static bool SWVer_StepRequest( EclipseRS422msg * const rs422txMsg, // Request message
+                               const EclipseRS422msg * const rs422rxMsg ) // Received reply message
 {
-    const size_t maxNumRequestRetries = 10;
-    size_t requestCount = 0;
-    bool wasReplyFound;
+    bool isRequestFinished = false;
 
-    while (requestCount < maxNumRequestRetries)
+    if ((true == rs422rxMsg->isNewDataAvailable) ||
+            (gather.requestCount >= MAX_NUM_VERSION_REQUESTS))
     {
-        size_t dummyData;
-        wasReplyFound = false;
-
-        /* Construct the transmit message: sw version request*/
+        isRequestFinished = true;
+    }
+    else
+    {
+        /* Construct the transmit message: version request */
         EclipseRS422_ConstructTxMsg( rs422txMsg,
-                                     txBuff,
+                                     gather.txBuff,
                                      NULL,
                                      0,
-                                     magHeadingSDI,
+                                     ECLIPSE_RS422_VERSION_REQUEST_SDI,
                                      ECLIPSE_RS422_VERSION_REQUEST_TXMSG_LENGTH ); //transmit msg always 1
         UART1_TxStart( );
-        Timer23_Delay_ms( 5 );
-        UART1_ReadToRxCircBuff( );
-        wasReplyFound = EclipseRS422_ProcessNewMessage( rxBuff, //receive circular buffer - rx uart
-                                                        1, // rx message size. All are singular
-                                                        rs422rxMsg, // rx message with data pointer to flush data out 
-                                                        &dummyData ); //dummy data
-        if (wasReplyFound)
-        {
-            break;
-        }
-        else
-        {
-            requestCount++;
-        }
+        gather.requestCount++;
     }
-    return wasReplyFound;
+    return isRequestFinished;
 }
 
 
 /**************  Function Definition(s) ********************/
 
 /*
- * Function: SWVer_GatherSWVersions
+ * Function: SWVer_StartGathering
  * 
- * Description: Function used to send and receive software version requests/replies
- *      from Eclipse's RS422 subsystems. Inputs the transmit and receive circular 
- *      buffers linked to the UART peripherals. 
+ * Description: Creates the AFC004's software version from the program memory 
+ *      CRC and starts gathering the ADC's software and hardware versions over 
+ *      RS422. The requests are sent and their replies collected by 
+ *      SWVer_ProcessGathering, one step per frame, so startup isn't held up 
+ *      waiting for the ADC. The reply messages must be in the rx message array 
+ *      parsed by the main loop, which copies each reply to the message's data 
+ *      array and flags it as new. 
  * 
- * Note: Here, UART1 is ADC subsystem, UART2 is GPS subsystem 
+ * Note: Here, UART1 is ADC subsystem 
  * 
  * Return: None 
  * 
  * Requirement Implemented: INT1.0101.S.IOP.6.002
  */
-void SWVer_GatherSWVersions( circBuffer_t * const adcRxBuff,
-                             circBuffer_t * const adcTxBuff )
+void SWVer_StartGathering( circBuffer_t * const adcTxBuff,
+                           EclipseRS422msg * const swVersionReplyMsg,
+                           EclipseRS422msg * const hwVersionReplyMsg )
 {
-    if ((NULL == adcTxBuff) ||
-        (NULL == adcRxBuff))
-    {
-        return;
-    }
-
     /* Zero the local array */
     size_t x;
     size_t y;
@@ -196,112 +224,6 @@ void SWVer_GatherSWVersions( circBuffer_t * const adcRxBuff,
         }
     }
 
-    /*Software Version Request Configuration */
-    const EclipseRS422msgConfig swVerADCRequestCfg = {
-        .cmd = SOFTWARE_VERSION_CMD,
-        .leftSource = LEFT_AHRS,
-        .rightSource = RIGHT_AHRS,
-        .leftDestination = LEFT_ADC,
-        .rightDestination = RIGHT_ADC,
-        .length = ECLIPSE_RS422_VERSION_REQUEST_MSG_LENGTH
-    };
-
-    const EclipseRS422msgConfig swVerADCReplyCfg = {
-        .cmd = SOFTWARE_VERSION_CMD,
-        .leftSource = LEFT_ADC,
-        .rightSource = RIGHT_ADC,
-        .leftDestination = LEFT_AHRS,
-        .rightDestination = RIGHT_AHRS,
-        .length = ECLIPSE_RS422_ADC_SWVERSION_REPLY_MSG_LENGTH
-    };
-
-    const EclipseRS422msgConfig hwVerADCRequestCfg = {
-        .cmd = HARDWARE_SERIAL_NUMBER_CMD,
-        .leftSource = LEFT_AHRS,
-        .rightSource = RIGHT_AHRS,
-        .leftDestination = LEFT_ADC,
-        .rightDestination = RIGHT_ADC,
-        .length = ECLIPSE_RS422_VERSION_REQUEST_MSG_LENGTH
-    };
-
-    const EclipseRS422msgConfig hwVerADCReplyCfg = {
-        .cmd = HARDWARE_SERIAL_NUMBER_CMD,
-        .leftSource = LEFT_ADC,
-        .rightSource = RIGHT_ADC,
-        .leftDestination = LEFT_AHRS,
-        .rightDestination = RIGHT_AHRS,
-        .length = ECLIPSE_RS422_ADC_HWVERSION_REPLY_MSG_LENGTH
-    };
-
-    /* Holds the actual data received. The ADC has twice the "normal" msg length */
-    uint8_t adcSwVersionReplyData[ECLIPSE_RS422_ADC_SWVERSION_REPLY_MSG_LENGTH - 1];
-    uint8_t adcHwVersionReplyData[ECLIPSE_RS422_ADC_HWVERSION_REPLY_MSG_LENGTH - 1];
-
-    /* Tx message data. This will be flushed into the tx circular buffer through the construct msg function. */
-    uint8_t adcSwVersionRequestData[ECLIPSE_RS422_VERSION_REQUEST_TXMSG_LENGTH];
-    uint8_t adcHwVersionRequestData[ECLIPSE_RS422_VERSION_REQUEST_TXMSG_LENGTH];
-
-    /* Set all declared local arrays to zero. */
-    size_t i;
-    for (i = 0; i < ECLIPSE_RS422_ADC_SWVERSION_REPLY_MSG_LENGTH - 1; i++)
-    {
-        adcSwVersionReplyData[i] = 0;
-        adcHwVersionReplyData[i] = 0;
-    }
-    for (i = 0; i < ECLIPSE_RS422_VERSION_REQUEST_TXMSG_LENGTH - 1; i++)
-    {
-        adcSwVersionRequestData[i] = 0;
-        adcHwVersionRequestData[i] = 0;
-    }
-
-
-    EclipseRS422msg swVersionRequestADCMsg = {
-        .msgConfig = &swVerADCRequestCfg,
-        .data = adcSwVersionRequestData
-    };
-
-    EclipseRS422msg swVersionReplyADCMsg = {
-        .msgConfig = &swVerADCReplyCfg,
-        .data = adcSwVersionReplyData
-    };
-
-    EclipseRS422msg hwVersionRequesADCtMsg = {
-        .msgConfig = &hwVerADCRequestCfg,
-        .data = adcHwVersionRequestData
-    };
-    EclipseRS422msg hwVersionReplyADCMsg = {
-        .msgConfig = &hwVerADCReplyCfg,
-        .data = adcHwVersionReplyData
-    };
-
-    if (true == SWVer_GatherRequest( &swVersionRequestADCMsg,
-                                     &swVersionReplyADCMsg,
-                                     adcTxBuff,
-                                     adcRxBuff,
-                                     0x01 ))
-    {
-        /* Copy the ADC software version to the local array */
-        memcpy( &(swVersions[adcSCIidx][0]), &adcSwVersionReplyData, ECLIPSE_RS422_SWVERSION_DATA_LENGTH );
-
-        /* Copy the Pitot/AOA hardware versionresults to the local array */
-        uint8_t * pitotAOASwverion = adcSwVersionReplyData + ECLIPSE_RS422_SWVERSION_DATA_LENGTH; //advance 12 bytes
-        memcpy( &(swVersions[paoaSCIidx][0]), pitotAOASwverion, ECLIPSE_RS422_SWVERSION_DATA_LENGTH );
-
-    }
-    if (true == SWVer_GatherRequest( &hwVersionRequesADCtMsg,
-                                     &hwVersionReplyADCMsg,
-                                     adcTxBuff,
-                                     adcRxBuff,
-                                     0x01 ))
-    {
-        /* Copy the ADC hardware version to the local array*/
-        memcpy( &(swVersions[adcSCIidx][ECLIPSE_RS422_HWVERSION_OFFSET]), &adcHwVersionReplyData, ECLIPSE_RS422_HWVERSION_DATA_LENGTH );
-
-        /* Copy the Pitot/AOA hardware version results to the local array */
-        uint8_t * pitotAOAHWVerion = adcHwVersionReplyData + ECLIPSE_RS422_HWVERSION_DATA_LENGTH;
-        memcpy( &(swVersions[paoaSCIidx][ECLIPSE_RS422_HWVERSION_OFFSET]), pitotAOAHWVerion, ECLIPSE_RS422_HWVERSION_DATA_LENGTH );
-    }
-
     /* Create the AFC004's software version using the program's CRC */
     size_t crcCounter;
     uint8_t msgNibble;
@@ -316,6 +238,90 @@ void SWVer_GatherSWVersions( circBuffer_t * const adcRxBuff,
     {
         swVersions[afcSCIidx][crcCounter + ECLIPSE_RS422_SWVERSION_CRC_POS_OFFSET] = (uint8_t) ((u32PM_CRC >> (8 * crcCounter)) & 0xFF);
     }
+
+    if ((NULL == adcTxBuff) ||
+            (NULL == swVersionReplyMsg) ||
+            (NULL == hwVersionReplyMsg) ||
+            (NULL == swVersionReplyMsg->data) ||
+            (NULL == hwVersionReplyMsg->data))
+    {
+        gather.state = SWVER_GATHER_COMPLETE;
+        return;
+    }
+
+    /* Ignore any reply copied out before the first request is sent */
+    swVersionReplyMsg->isNewDataAvailable = false;
+    hwVersionReplyMsg->isNewDataAvailable = false;
+
+    gather.txBuff = adcTxBuff;
+    gather.swVersionReplyMsg = swVersionReplyMsg;
+    gather.hwVersionReplyMsg = hwVersionReplyMsg;
+    gather.requestCount = 0;
+    gather.state = SWVER_GATHER_SW_VERSION;
+    return;
+}
+
+/*
+ * Function: SWVer_ProcessGathering
+ * 
+ * Description: Advances version gathering by one frame. Must be called once 
+ *      per frame, after the main loop has parsed the ADC's RS422 messages. The 
+ *      software version is requested first, then the hardware version. Each 
+ *      reply is copied to the local array as it is received, so its version 
+ *      words are transmitted by SWVer_GetNextVersionARINCMsg from then on. 
+ *      Does nothing once both versions are gathered or given up on. 
+ * 
+ * Return: None 
+ * 
+ * Requirement Implemented: INT1.0101.S.IOP.6.002
+ */
+void SWVer_ProcessGathering( void )
+{
+    switch (gather.state)
+    {
+        case SWVER_GATHER_SW_VERSION:
+            if (true == SWVer_StepRequest( &swVersionRequestADCMsg, gather.swVersionReplyMsg ))
+            {
+                if (true == gather.swVersionReplyMsg->isNewDataAvailable)
+                {
+                    /* Copy the ADC software version to the local array */
+                    const uint8_t * const adcSwVersionReplyData = gather.swVersionReplyMsg->data;
+                    memcpy( &(swVersions[adcSCIidx][0]), adcSwVersionReplyData, ECLIPSE_RS422_SWVERSION_DATA_LENGTH );
+
+                    /* Copy the Pitot/AOA software version to the local array */
+                    const uint8_t * const pitotAOASwverion = adcSwVersionReplyData + ECLIPSE_RS422_SWVERSION_DATA_LENGTH; //advance 12 bytes
+                    memcpy( &(swVersions[paoaSCIidx][0]), pitotAOASwverion, ECLIPSE_RS422_SWVERSION_DATA_LENGTH );
+                    gather.swVersionReplyMsg->isNewDataAvailable = false;
+                }
+                gather.requestCount = 0;
+                gather.state = SWVER_GATHER_HW_VERSION;
+            }
+            break;
+
+        case SWVER_GATHER_HW_VERSION:
+            if (true == SWVer_StepRequest( &hwVersionRequestADCMsg, gather.hwVersionReplyMsg ))
+            {
+                if (true == gather.hwVersionReplyMsg->isNewDataAvailable)
+                {
+                    /* Copy the ADC hardware version to the local array*/
+                    const uint8_t * const adcHwVersionReplyData = gather.hwVersionReplyMsg->data;
+                    memcpy( &(swVersions[adcSCIidx][ECLIPSE_RS422_HWVERSION_OFFSET]), adcHwVersionReplyData, ECLIPSE_RS422_HWVERSION_DATA_LENGTH );
+
+                    /* Copy the Pitot/AOA hardware version results to the local array */
+                    const uint8_t * const pitotAOAHWVerion = adcHwVersionReplyData + ECLIPSE_RS422_HWVERSION_DATA_LENGTH;
+                    memcpy( &(swVersions[paoaSCIidx][ECLIPSE_RS422_HWVERSION_OFFSET]), pitotAOAHWVerion, ECLIPSE_RS422_HWVERSION_DATA_LENGTH );
+                    gather.hwVersionReplyMsg->isNewDataAvailable = false;
+                }
+                gather.requestCount = 0;
+                gather.state = SWVER_GATHER_COMPLETE;
+            }
+            break;
+
+        case SWVER_GATHER_COMPLETE:
+        default:
+            break;
+    }
+    return;
 }
 
 /*
@@ -327,9 +333,9 @@ void SWVer_GatherSWVersions( circBuffer_t * const adcRxBuff,
  *      a value of 16, the value is reset to zero. When msg_idx resets to zero, 
  *      sys_idx is incremented. If sys_idx reaches 4, it is reset to zero. 
  * 
- *      During startup, the swVersions array is initialized to zero, so if a 
- *      valid response was not received, only NULL characters (0) will be   
- *      transmitted. 
+ *      During startup, the swVersions array is initialized to zero, so until 
+ *      a valid response is received, or if none is, only NULL characters (0) 
+ *      will be transmitted. 
  * 
  * Return: Formatted 32bit ARINC429 word - Note: parity is calculated in hardware. 
  * 
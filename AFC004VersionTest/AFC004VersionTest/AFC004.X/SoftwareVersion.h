@@ -18,12 +18,15 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "circularBuffer.h"
+#include "EclipseRS422messages.h"
 
 
 /**************  Function Prototype(s) *********************/
 uint32_t SWVer_GetNextVersionARINCMsg(uint8_t sdi);
-void SWVer_GatherSWVersions(circBuffer_t * const adcRxBuff,
-        circBuffer_t * const adcTxBuff);
+void SWVer_StartGathering(circBuffer_t * const adcTxBuff,
+        EclipseRS422msg * const swVersionReplyMsg,
+        EclipseRS422msg * const hwVersionReplyMsg);
+void SWVer_ProcessGathering(void);
 
 uint8_t asciiConverter( const uint8_t val );
 
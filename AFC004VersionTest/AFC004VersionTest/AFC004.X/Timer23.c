@@ -140,6 +140,78 @@ uint32_t Timer23_GetTimestamp_ms( )
 }
 #Timer23_GetTimestamp_ms
 
+#Timer23_GetTimestamp_ticks
+/* Function: Timer23_GetTimestamp_ticks
+ *
+ * Description: Reads the TMR2 register followed by TMR3HLD (see 
+ *      Timer23_GetTimestamp_ms) and returns the concatenated 32bit count 
+ *      without scaling. Avoids the software 32bit division of the 
+ *      millisecond timestamp, so time critical callers should compare 
+ *      tick differences against intervals converted once with 
+ *      Timer23_ConvertMsToTicks. Unsigned tick differences remain valid 
+ *      across a timer roll over. 
+ * 
+ * Return: Running timestamp in timer ticks 
+ * 
+ * Requirement Implemented: REL.0104.S.IOP.7.002
+ */
+uint32_t Timer23_GetTimestamp_ticks( void )
+{
+    uint32_t returnVal;
+    if (true == isTimer23Initialized)
+    {
+        uint16_t lsWord = TMR2;
+        uint32_t msWord = TMR3HLD;
+        returnVal = ((msWord << 16) | lsWord);
+    }
+    else
+    {
+        returnVal = 0;
+    }
+    return returnVal;
+}
+#Timer23_GetTimestamp_ticks
+
+#Timer23_GetTimestampFromInterrupt_ticks
+/* Function: Timer23_GetTimestampFromInterrupt_ticks
+ *
+ * Description: As Timer23_GetTimestamp_ticks, for use inside an interrupt. 
+ *      Reading TMR2 reloads TMR3HLD, so an interrupt landing between the 
+ *      TMR2 and TMR3HLD reads of an interrupted timestamp would hand it a 
+ *      newer most significant word. The interrupted read's TMR3HLD value 
+ *      is put back before returning. 
+ * 
+ * Return: Running timestamp in timer ticks 
+ * 
+ * Requirement Implemented: REL.0104.S.IOP.7.002
+ */
+uint32_t Timer23_GetTimestampFromInterrupt_ticks( void )
+{
+    uint16_t interruptedHold = TMR3HLD;
+    uint32_t returnVal = Timer23_GetTimestamp_ticks( );
+    TMR3HLD = interruptedHold;
+    return returnVal;
+}
+#Timer23_GetTimestampFromInterrupt_ticks
+
+#Timer23_ConvertMsToTicks
+/* Function: Timer23_ConvertMsToTicks
+ *
+ * Description: Converts a millisecond interval into timer ticks using the
+ *      configured scale factor. Intended to be called at initialization so
+ *      that intervals can be compared with Timer23_GetTimestamp_ticks 
+ *      differences. Must be called after Timer23_Initialize. 
+ * 
+ * Return: Interval in timer ticks, 0 if the timer is not initialized 
+ * 
+ * Requirement Implemented: REL.0104.S.IOP.7.002
+ */
+uint32_t Timer23_ConvertMsToTicks( const uint32_t milliseconds )
+{
+    return (true == isTimer23Initialized) ? (milliseconds * scaleFactor) : 0;
+}
+#Timer23_ConvertMsToTicks
+
 #Timer23_Delay_ms
 /* 
  * Function: Timer23_Delay_ms
@@ -26,6 +26,12 @@ void Timer23_Initialize(const uint16_t t2config, /* Configuration register value
 
 uint32_t Timer23_GetTimestamp_ms(); 
 
+uint32_t Timer23_GetTimestamp_ticks(void); /* Raw 32 bit timer count - no division, for time critical callers */
+
+uint32_t Timer23_GetTimestampFromInterrupt_ticks(void); /* Timer23_GetTimestamp_ticks for interrupts, keeps TMR3HLD for the interrupted code */
+
+uint32_t Timer23_ConvertMsToTicks(const uint32_t milliseconds); /* Converts an interval in ms to timer ticks */
+
 void Timer23_Delay_ms(uint32_t delayInMilliseconds);
 
 
@@ -20,21 +20,28 @@
 #include "COMUart1.h"
 #include "COMUart2.h"
 #include "COMVerifyNonVolatileMemoryCRC.h"
+#include "COMReadProgramMemory.h"
 #include "../COM/pic_h/p30F6014A.h"
 #include "circularBuffer.h"
 #include "EclipseRS422messages.h"
 #include "ARINC.h"
 #include "ArincDownload.h"
+#include "ArincLatencyTrace.h"
 #include "calculateNewARINCLabels.h"
 #include "ARINC_HI3584.h"
 #include "SoftwareVersion.h"
 #include "Timer23.h"
+#include "BootProfile.h"
+#include "FrameSchedule.h"
+#include "FrameMonitor.h"
+#include "LinkStatistics.h"
 #include "maintenanceMode.h"
 #include "IOPConfig.h"
 
 
 /**************  Macro Definition(s) ***********************/
-#define NUM_RS422_ADC_RXMSGS 2
+#define NUM_RS422_ADC_RXMSGS 4
+#define NUM_RS422_ADC_DATA_RXMSGS 2 /* Computed data and status, checked for bus failure */
 #define NUM_RS422_ADC_TXMSGS 1
 
 #define ECLIPSE_RS422_ADC_TX_MSG_LENGTH 27   
@@ -51,6 +58,8 @@
 
 #define RS422_ADC_COMPUTED_DATA_IDX 0 
 #define RS422_ADC_STATUS_IDX 1
+#define RS422_ADC_SW_VERSION_REPLY_IDX 2
+#define RS422_ADC_HW_VERSION_REPLY_IDX 3
 #define RS422_ADC_TX_CURRENT_DATA_IDX 0
 
 /* ARINC429 message defaults for RS422 transmit */
@@ -61,6 +70,34 @@
 #define VFOM_FAIL 0x0000007Au
 #define STATUS_271_FAILURE 0x6000009Du
 
+/* AHR75 receive FIFO servicing between transmits. In interrupt-driven receive mode the
+ * FIFO is drained by the ARINC receive service interrupt, so nothing is done here. */
+#ifdef ARINC429_RX_INTERRUPT_DRIVEN
+#define SERVICE_AHR75_RX_FIFO( )
+#else
+#define SERVICE_AHR75_RX_FIFO( ) DownloadMessagesFromARINCtxvrArx2( &arincAHR75array )
+#endif
+
+/* 100 Hz frame schedule: ENTRY( frame, task, period in frames, phase, load ). A task runs on the frames
+ * where frame % period == phase, frame 1 being the first 100 Hz frame. The load of a task is the most
+ * ARINC words it writes to one HI-3584 transmit FIFO. Phases are chosen so no two tasks share a frame. */
+#define AFC004_FRAME_SCHEDULE(ENTRY, frame) \
+    ENTRY( frame, TransmitAHRSWords, 4, 0, 11 ) /* 50 Hz - 20 ms */ \
+    ENTRY( frame, TransmitStatusAndADCRS422Words, 10, 7, 3 ) /* 20 Hz - 50 ms */ \
+    ENTRY( frame, TransmitA429ADCWords, 12, 2, 18 ) /* 16.67 Hz - 60 ms */ \
+    ENTRY( frame, TransmitSoftwareVersionWord, 20, 3, 1 ) /* 10 Hz - 100 ms */
+
+#define AFC004_FRAME_LOAD(frame) (0 AFC004_FRAME_SCHEDULE( FRAME_SCHEDULE_ENTRY_LOAD, frame ))
+#define AFC004_MAX_FRAME_LOAD 32u /* HI-3584 transmit FIFO depth */
+
+#if (0 AFC004_FRAME_SCHEDULE( FRAME_SCHEDULE_ENTRY_INVALID, 0 ))
+#error "Frame schedule task periods must divide FRAME_SCHEDULE_HYPERPERIOD_FRAMES, with phases less than the period"
+#endif
+
+#if !FRAME_SCHEDULE_IS_BALANCED( AFC004_FRAME_LOAD, AFC004_MAX_FRAME_LOAD )
+#error "Frame schedule overloads a frame - move a task to another phase"
+#endif
+
 /************************* Pin Assignments *************************/
 /* Fault pin for one shot circuit */
 #define FAULT_PIN_LAT           LATGbits.LATG15  
@@ -100,9 +137,14 @@ static struct
     uint8_t StoredCodeTest;
     uint8_t NoBootFault;
     uint8_t ARINCFault;
+    uint8_t FrameTimingTest;
+    uint8_t InitStatus; /* Latched results of the main operating code init section */
     uint8_t InternalFault;
 } IOPStatus;
 
+/* Program memory CRC check, completed at boot and then run continuously */
+static ProgramMemoryCRCCheck programMemoryCRCCheck;
+
 /* Bus status struct */
 static struct
 {
@@ -116,9 +158,19 @@ static struct
 static bool ReadStrapping( uint8_t * const strapping ); /* Strapping result */
 static void ConfigureUnusedPinsAsOutputs( void );
 static void TransmitAHRSWords( );
+static void TransmitComputedAHRSWord( const uint32_t txWord, const uint16_t octalSourceLabel );
 static void TransmitADCRS422Words( const uint8_t magHeadingSDI );
 static void TransmitA429ADCWords( );
 static void CalculateAndTransmitAHRSStatusWords( );
+static void TransmitStatusAndADCRS422Words( void );
+static void TransmitSoftwareVersionWord( void );
+static void StepProgramMemoryCRCCheckRow( void );
+
+/* 100 Hz frame schedule and per task execution statistics */
+static const FrameScheduleTask frameSchedule[] = {
+    AFC004_FRAME_SCHEDULE( FRAME_SCHEDULE_ENTRY_TASK, 0 )
+};
+static FrameScheduleTaskState frameScheduleStates[sizeof (frameSchedule) / sizeof (FrameScheduleTask)];
 
 /* Variable automatically located by linker at the very end of used main application program memory space. This is used to
  * determine the CRC calculation end address. */
@@ -129,9 +181,16 @@ __prog__ volatile u32 u32PM_CRC __attribute__( (section( ".PM_CRC" ), space( pro
 
 /* Master UART1 and UART2 circular buffers */
 #define UART1_RX_BUFF_SIZE 256
-#define UART1_TX_BUFF_SIZE 100
+#define UART1_TX_BUFF_SIZE 128
 #define UART2_RX_BUFF_SIZE 256
-#define UART2_TX_BUFF_SIZE 100
+#define UART2_TX_BUFF_SIZE 128
+
+#ifdef CB_POWER_OF_TWO_CAPACITY
+#if !CB_IS_POWER_OF_TWO(UART1_RX_BUFF_SIZE) || !CB_IS_POWER_OF_TWO(UART1_TX_BUFF_SIZE) || \
+    !CB_IS_POWER_OF_TWO(UART2_RX_BUFF_SIZE) || !CB_IS_POWER_OF_TWO(UART2_TX_BUFF_SIZE)
+#error "UART circular buffer sizes must be powers of two"
+#endif
+#endif
 
 /* ADC Receive Circular Buffer */
 uint8_t uart1rxCirBuffData[UART1_RX_BUFF_SIZE];
@@ -139,7 +198,17 @@ circBuffer_t UART1rxCircBuff = {
     .data = uart1rxCirBuffData,
     .capacity = sizeof (uart1rxCirBuffData),
     .head = 0,
-    .tail = 0
+    .tail = 0,
+    .numBytesDropped = 0,
+    .highWaterMark = 0
+};
+
+/* ADC Receive RS422 parser state */
+EclipseRS422parser ADCRS422parser = {
+    .state = ECLIPSE_RS422_PARSE_PREAMBLE,
+    .numQueuedFrames = 0,
+    .scanOffset = 0,
+    .numCRCErrors = 0
 };
 
 /* ADC Transmit Circular Buffer */
@@ -148,30 +217,50 @@ circBuffer_t UART1txCircBuff = {
     .data = uart1txCirBuffData,
     .capacity = sizeof (uart1txCirBuffData),
     .head = 0,
-    .tail = 0
+    .tail = 0,
+    .numBytesDropped = 0,
+    .highWaterMark = 0
 };
 
 /* Maintenance UARTs */
-uint8_t uart2rxCirBuffData[UART1_RX_BUFF_SIZE];
+uint8_t uart2rxCirBuffData[UART2_RX_BUFF_SIZE];
 circBuffer_t UART2rxCircBuff = {
     .data = uart2rxCirBuffData,
     .capacity = sizeof (uart2rxCirBuffData),
     .head = 0,
-    .tail = 0
+    .tail = 0,
+    .numBytesDropped = 0,
+    .highWaterMark = 0
 };
 
-uint8_t uart2txCirBuffData[UART1_TX_BUFF_SIZE];
+uint8_t uart2txCirBuffData[UART2_TX_BUFF_SIZE];
 circBuffer_t UART2txCircBuff = {
     .data = uart2txCirBuffData,
     .capacity = sizeof (uart2txCirBuffData),
     .head = 0,
-    .tail = 0
+    .tail = 0,
+    .numBytesDropped = 0,
+    .highWaterMark = 0
 };
 
 int16_t main( void )
 {
     int16_t returnVal = 1;
 
+    v_HardwareResetConfiguartion( );
+
+    /* Timer 2-3 - millisecond counter. Started ahead of the built in tests so that every boot stage can be timed */
+    Timer23_Initialize( IOPConfig.hardwareSettings.TMR23Config,
+                        IOPConfig.hardwareSettings.TMR23Period,
+                        IOPConfig.hardwareSettings.TMR23ScaleFactor );
+    BootProfile_Start( );
+
+    /* Keep the previous boot's frame timing, task execution times and link statistics for maintenance mode. Timer 4 counts from 0 to its
+     * period register. */
+    FrameMonitor_Initialize( IOPConfig.hardwareSettings.TMR4CounterPeriod + 1u );
+    LinkStatistics_Initialize( );
+    FrameSchedule_InitializeRecord( );
+
     /* RAM Test Function. */
     IOPStatus.RAMTest = u16_asmRAMTestResult( IOPConfig.hardwareSettings.RAMTestStartAddress, /* RAM Test Start Address. */
                                               IOPConfig.hardwareSettings.RAMTestEndAddress, /* Ram Test End memory address. */
@@ -179,21 +268,23 @@ int16_t main( void )
                                               IOPConfig.hardwareSettings.RAMTestReadWord1, /* Ram Test Memory Read Word 1. */
                                               IOPConfig.hardwareSettings.RAMTestWriteWord2, /* Ram Test Memory Write Word 2. */
                                               IOPConfig.hardwareSettings.RAMTestReadWord2 ); /* Ram Test Memory Read Word 2. */
+    BootProfile_EndStage( BOOT_STAGE_RAM_TEST );
+
+    /* The 32-bit CRC table is precomputed in program memory, so the configured key must be the one it was built for.
+     * The configuration block can be loaded apart from the code, so a block of another layout, or with a zero slice,
+     * which never completes a pass, is also rejected here. */
+    const uint8_t isCRCConfigValid = ((CRC32_TABLE_POLYNOMIAL_KEY == IOPConfig.hardwareSettings.CRCGenerationKey) &&
+            (IOP_CONFIG_LAYOUT_VERSION == IOPConfig.layoutVersion) &&
+            (0u != IOPConfig.addedHardwareSettings.PMCRCSliceInstructions)) ? 1 : 0;
+
+    /* The first pass of the program memory CRC check runs in the ARINC loopback test waits and is completed before the
+     * main loop. The continuous checks after it run a slice per 100 Hz frame. */
+    v_StartProgramMemoryCRCCheck( &programMemoryCRCCheck,
+                                  ZERO, /* Program start address */
+                                  LAST_PM_ADDR_USED, /* Last program address used */
+                                  PM_CRC_ADDR ); /* Address of program memory CRC */
+    IOPStatus.StoredCodeTest = isCRCConfigValid;
 
-    /* Generate the CRC table used for calculating the 32-bit CRC remainders */
-    v_Generate32BitCRCTable( IOPConfig.hardwareSettings.CRCGenerationKey ); /* CRC Generation Key. */
-
-#ifdef __DEBUG
-    // Skip CRC checks if debugging
-    IOPStatus.StoredCodeTest = 1;
-#else
-    /* Verify CRC of program code */
-    IOPStatus.StoredCodeTest = u8_VerifyProgramMemoryCRC( ZERO, /* Program start address */
-                                                          LAST_PM_ADDR_USED, /* Last program address used */
-                                                          PM_CRC_ADDR ); /* Address of program memory CRC */
-#endif
-
-    v_HardwareResetConfiguartion( );
     ADPCFG = 0xFFFF; /* Configure all ANx pins as digital I/O */
     ConfigureUnusedPinsAsOutputs( );
 
@@ -210,10 +301,21 @@ int16_t main( void )
     /* ARINC Channel setup - same for both configurations */
     ARINC429_HI3584_txvrA_Initialize( ); // AHR75
     ARINC429_HI3584_txvrB_Initialize( ); // PFD
+    BootProfile_EndStage( BOOT_STAGE_HARDWARE_SETUP );
+
+    /* Perform ARINC Loopback Tests on both transceivers at once, checking program memory while test words loop back */
+    IOPStatus.ARINCFault = ARINC429_HI3584_LoopbackTest( StepProgramMemoryCRCCheckRow ) ? 1 : 0;
+    BootProfile_EndStage( BOOT_STAGE_ARINC_LOOPBACK_TESTS );
 
-    /* Perform ARINC Loopback Tests  */
-    IOPStatus.ARINCFault = ARINC429_HI3584_txvrA_LoopbackTest( ) ? 1 : 0;
-    IOPStatus.ARINCFault &= ARINC429_HI3584_txvrB_LoopbackTest( ) ? 1 : 0;
+#ifndef __DEBUG
+    /* Verify CRC of program code - finish the first pass to the end of the image. Skip CRC checks if debugging */
+    while (0u == programMemoryCRCCheck.u16NumPassesCompleted)
+    {
+        (void) u8_StepProgramMemoryCRCCheck( &programMemoryCRCCheck, HEX_FFFF );
+    }
+    IOPStatus.StoredCodeTest &= programMemoryCRCCheck.u8PassResult;
+#endif
+    BootProfile_EndStage( BOOT_STAGE_STORED_CODE_TEST );
 
     IOPStatus.ARINCFault &= ARINC429_HI3584_txvrA_LoadCtrlReg( IOPConfig.hardwareSettings.hi3584txvrAconfig ) ? 1 : 0;
     IOPStatus.ARINCFault &= ARINC429_HI3584_txvrB_LoadCtrlReg( IOPConfig.hardwareSettings.hi3584txvrBconfig ) ? 1 : 0;
@@ -226,16 +328,17 @@ int16_t main( void )
     HI_8586_TXRB_TRIS = 0;
     HI_8586_TXRB_LAT = 1;
 
-    /* Timer 2-3 - millisecond counter */
-    Timer23_Initialize( IOPConfig.hardwareSettings.TMR23Config,
-                        IOPConfig.hardwareSettings.TMR23Period,
-                        IOPConfig.hardwareSettings.TMR23ScaleFactor );
-
     /* Timer 4: System Frequency Timer used in all modes */
     v_InitializeTMR4( IOPConfig.hardwareSettings.TMR4CounterConfig,
                       IOPConfig.hardwareSettings.TMR4CounterPeriod,
                       IOPConfig.hardwareSettings.TMR4InterruptConfig );
 
+    /* UART circular buffers, checked here and latched into the init status below */
+    const bool areUARTCircBuffsValid = (cb_init( &UART1rxCircBuff ) &
+                                        cb_init( &UART1txCircBuff ) &
+                                        cb_init( &UART2rxCircBuff ) &
+                                        cb_init( &UART2txCircBuff ));
+
     /* Initialize UART1 for received ADC Msgs */
     UART1_Initialize( IOPConfig.hardwareSettings.UART1InterruptConfig,
                       IOPConfig.hardwareSettings.UART1BaudRate,
@@ -263,11 +366,13 @@ int16_t main( void )
     /* IIR Filter setup */
     SetupNormAccelIIRFilter( IOPConfig.iirFilter.IIRFilterK1,
                              IOPConfig.iirFilter.IIRFilterK2 );
+    BootProfile_EndStage( BOOT_STAGE_PERIPHERAL_SETUP );
 
     /* Read Strapping */
     uint8_t strappingValue;
 
     const bool isStrappingValid = ReadStrapping( &strappingValue );
+    BootProfile_EndStage( BOOT_STAGE_READ_STRAPPING );
     if (isStrappingValid)
     {
         if (0x07 == strappingValue)
@@ -291,95 +396,115 @@ int16_t main( void )
         while (1);
     }
 
+    IOPStatus.FrameTimingTest = 1;
+    IOPStatus.InitStatus = areUARTCircBuffsValid;
     IOPStatus.InternalFault = IOPStatus.NoBootFault;
 
     /*************************************** Main operating code init section ************************************/
 
-    /* Verified ARINC429 messages received from the ADC via RS422. 
-     * Does not include msg header, cmd, etc.  */
-    uint8_t ADCComputedData_data[ECLIPSE_RS422_ADC_COMPUTED_DATA_MSG_LENGTH - 1];
-    uint8_t ADCadcStatusMsg_data[ECLIPSE_RS422_ADC_STATUS_MSG_LENGTH - 1];
-
-    /* Set the ADC RS422 message array to link to the declared array. */
-    ADCRS422rxMsgs[RS422_ADC_COMPUTED_DATA_IDX].data = ADCComputedData_data;
-    ADCRS422rxMsgs[RS422_ADC_STATUS_IDX].data = ADCadcStatusMsg_data;
-
-    uint8_t AHRSCurrentDataMessage [ECLIPSE_RS422_ADC_TX_MSG_LENGTH];
-    ADCRS422txMsg[RS422_ADC_TX_CURRENT_DATA_IDX].data = AHRSCurrentDataMessage;
-
-    SWVer_GatherSWVersions( &UART1rxCircBuff,
-                            &UART1txCircBuff );
-
-    /* Setup label filters. Functions return true if label filter setup was successful. Negate this 
-     * value to set the internal fault flag */
-    IOPStatus.InternalFault &= (ARINC429_HI3584_SetupLabelFiltersTxvrA( &arincAHR75array ));
-    IOPStatus.InternalFault &= (ARINC429_HI3584_SetupLabelFiltersTxvrB( &arincPFDarray ));
+    /* ADC versions are requested and their replies collected by the main loop, one step per frame */
+    SWVer_StartGathering( &UART1txCircBuff,
+                          &ADCRS422rxMsgs[RS422_ADC_SW_VERSION_REPLY_IDX],
+                          &ADCRS422rxMsgs[RS422_ADC_HW_VERSION_REPLY_IDX] );
+    BootProfile_EndStage( BOOT_STAGE_SW_VERSION_GATHER );
+
+    /* Build the label lookup tables used to match received ARINC words and label reads to their configured messages,
+     * and convert the label transmit intervals to Timer23 ticks */
+    IOPStatus.InitStatus &= ARINC429_InitializeRxMsgArray( &arincADCarray );
+    IOPStatus.InitStatus &= ARINC429_InitializeRxMsgArray( &arincAHR75array );
+    IOPStatus.InitStatus &= ARINC429_InitializeRxMsgArray( &arincPFDarray );
+
+    /* Precompute the fixed-point codecs of the transmitted BNR and BCD words. A word without its codec is encoded in floating point. */
+    IOPStatus.InitStatus &= SetupTransmitLabelCodecs( );
+
+    /* Setup label filters. Functions return true if label filter setup was successful. A failure is latched
+     * in the init status, which is part of every frame's internal fault */
+    IOPStatus.InitStatus &= (ARINC429_HI3584_SetupLabelFiltersTxvrA( &arincAHR75array ));
+    IOPStatus.InitStatus &= (ARINC429_HI3584_SetupLabelFiltersTxvrB( &arincPFDarray ));
+    IOPStatus.InternalFault &= IOPStatus.InitStatus;
+
+#ifdef ARINC429_RX_INTERRUPT_DRIVEN
+    /* Start servicing the ARINC receivers from interrupt now that the boot time bus accesses are done */
+    ArincRx_InitializeInterruptMode( IOPConfig.addedHardwareSettings.TMR5Config,
+                                     IOPConfig.addedHardwareSettings.TMR5Period,
+                                     IOPConfig.addedHardwareSettings.TMR5InterruptConfig );
+#endif
+#ifdef ARINC429_LATENCY_TRACE
+    ArincLatencyTrace_Initialize( );
+#endif
+    FrameSchedule_Initialize( frameSchedule,
+                              frameScheduleStates,
+                              sizeof (frameSchedule) / sizeof (FrameScheduleTask) );
+    BootProfile_EndStage( BOOT_STAGE_LABEL_SETUP );
 
-    uint32_t rateCounter = 0;
-    size_t adcMsgIdx;
+    bool isFirstFrame = true;
 
     /* Main operating loop */
     while (true)
     {
         /* ARINC: AHR75 is channel A, PFD is channel B */
+#ifdef ARINC429_RX_INTERRUPT_DRIVEN
+        ProcessARINCRxRings( &arincAHR75array, &arincPFDarray );
+#else
         DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
+#endif
 
-        /* Process RS422 ADC Data into ARINC words if a valid message was processed */
+        /* Process all complete RS422 ADC messages into ARINC words and version replies */
         UART1_ReadToRxCircBuff( );
-        if (EclipseRS422_ProcessNewMessage( &UART1rxCircBuff,
+        EclipseRS422_ProcessAllNewMessages( &ADCRS422parser,
+                                            &UART1rxCircBuff,
                                             sizeof (ADCRS422rxMsgs) / sizeof (EclipseRS422msg),
                                             ADCRS422rxMsgs,
-                                            &adcMsgIdx ))
-        {
-            EclipseRS422_CreateARINCWords( ADCRS422rxMsgs,
-                                           &arincADCarray,
-                                           adcMsgIdx,
-                                           sizeof (ADCRS422rxMsgs) / sizeof (EclipseRS422msg) );
-        }
+                                            &arincADCarray );
 
+#ifndef ARINC429_RX_INTERRUPT_DRIVEN
         /* Download ARINC Words from PFD - no on event words are expected from PFD, so use NULL and 0 */
         DownloadMessagesFromARINCtxvrBrx2( &arincPFDarray );
+#endif
 
         if (u16_ReadSystemFrequencyFlag( ))
         {
             /* 100 Hz Commands */
             FAULT_PIN_LAT = (true == IOPStatus.InternalFault) ? 1 : 0;
             v_ResetSystemFrequencyFlag( );
-            rateCounter++;
+            FrameMonitor_StartFrame( );
+            if (isFirstFrame)
+            {
+                BootProfile_EndStage( BOOT_STAGE_FIRST_FRAME_WAIT );
+                isFirstFrame = false;
+            }
             /* Process bus failure conditions */
-            busStatus.hasRS422ADCRxBusFailed = EclipseRS422_processBusFailure( ADCRS422rxMsgs, sizeof (ADCRS422rxMsgs) / sizeof (EclipseRS422msg) );
+            busStatus.hasRS422ADCRxBusFailed = EclipseRS422_processBusFailure( ADCRS422rxMsgs, NUM_RS422_ADC_DATA_RXMSGS );
             busStatus.hasAHR75RxBusFailed = ProcessARINCBusFailure( &arincAHR75array );
             busStatus.hasPFDRxBusFailed = ProcessARINCBusFailure( &arincPFDarray );
 
-            if (0 == (rateCounter % 4))/* 50 Hz - 20 ms*/
-            {
-                DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
-                TransmitAHRSWords( );
-            }
+            /* Request ADC versions and collect replies parsed above */
+            SWVer_ProcessGathering( );
 
-            if (7 == (rateCounter % 10)) /* 20 Hz - 50 ms */
-            {
-                DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
-                CalculateAndTransmitAHRSStatusWords( );
-                TransmitADCRS422Words( arincAHR75array.rxMsgs[2].data.SDI ); //mag heading SDI 
-            }
+            /* 50, 20, 16.67 and 10 Hz tasks due this frame */
+            FrameSchedule_RunFrame( frameSchedule,
+                                    frameScheduleStates,
+                                    sizeof (frameSchedule) / sizeof (FrameScheduleTask) );
 
+            SERVICE_AHR75_RX_FIFO( );
 
-            if (2 == (rateCounter % 12)) /* 16.67 Hz - 60 ms */
+#ifndef __DEBUG
+            /* Continuous program memory test - a failed pass is latched. Skip CRC checks if debugging */
+            if (u8_StepProgramMemoryCRCCheck( &programMemoryCRCCheck, IOPConfig.addedHardwareSettings.PMCRCSliceInstructions ))
             {
-                DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
-                TransmitA429ADCWords( );
+                IOPStatus.StoredCodeTest &= programMemoryCRCCheck.u8PassResult;
             }
+#endif
 
-            if (3 == (rateCounter % 20)) /* 10 Hz - 100 ms */
-            {
-                ARINC429_HI3584_txvrB_TransmitWord( SWVer_GetNextVersionARINCMsg( arincAHR75array.rxMsgs[2].data.SDI ) );
-                DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
-            }
+            /* UART1 overruns and high water marks, ADC frames rejected on CRC and ARINC receive ring drops, for maintenance mode */
+            LinkStatistics_Update( &UART1rxCircBuff, &UART1txCircBuff, &ADCRS422parser );
 
-            DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
+            /* Frame busy time and slack. A frame whose work was skipped is latched as a fault. */
+            FrameMonitor_EndFrame( );
+            IOPStatus.FrameTimingTest &= FrameMonitor_HasMissedFrames( ) ? 0 : 1;
 
-            IOPStatus.InternalFault = IOPStatus.NoBootFault;
+            IOPStatus.InternalFault = (IOPStatus.InitStatus & IOPStatus.NoBootFault & IOPStatus.StoredCodeTest &
+                    IOPStatus.FrameTimingTest);
             // TODO add other internal fault checks here
 
             /* Drive the Digital fault line low, at the end of the code execution cycle. Provided there is no system fault. */
@@ -398,6 +523,8 @@ int16_t main( void )
  */
 static void TransmitA429ADCWords( )
 {
+    SERVICE_AHR75_RX_FIFO( );
+
     /* If baro correction is failed, or if baro correction times out, don't send air data */
     uint32_t baroWord;
     bool isBaroWordValid = ARINC429_GetLatestARINC429Word( &arincPFDarray, 235, &baroWord );
@@ -418,7 +545,7 @@ static void TransmitA429ADCWords( )
         TransmitLatestARINCMsgIfValid( &arincADCarray, 215, A429_CHANNEL_B ); /* Corrected Impact Pressure */
     }
 
-    DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
+    SERVICE_AHR75_RX_FIFO( );
 
     if (isAirDataValid)
     {
@@ -444,19 +571,21 @@ static void TransmitA429ADCWords( )
  */
 static void TransmitAHRSWords( )
 {
+    SERVICE_AHR75_RX_FIFO( );
+
     /* Newly calculated words */
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateTurnRate( &arincAHR75array ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateSlipAngle( &arincAHR75array ) );
+    TransmitComputedAHRSWord( CalculateTurnRate( &arincAHR75array ), 320 );
+    TransmitComputedAHRSWord( CalculateSlipAngle( &arincAHR75array ), 332 );
 
     /* Modified ARINC Words */
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateNewMagneticHeadingARINCWord( &arincAHR75array ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateNewPitchAngleARINCWord( &arincAHR75array ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateNewRollAngleARINCWord( &arincAHR75array ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateNewBodyLateralAccelARINCWord( &arincAHR75array ) );
-    ARINC429_HI3584_txvrB_TransmitWord( CalculateNewNormalAccelerationARINCWord( &arincAHR75array ) );
+    TransmitComputedAHRSWord( CalculateNewMagneticHeadingARINCWord( &arincAHR75array ), 320 );
+    TransmitComputedAHRSWord( CalculateNewPitchAngleARINCWord( &arincAHR75array ), 324 );
+    TransmitComputedAHRSWord( CalculateNewRollAngleARINCWord( &arincAHR75array ), 325 );
+    TransmitComputedAHRSWord( CalculateNewBodyLateralAccelARINCWord( &arincAHR75array ), 332 );
+    TransmitComputedAHRSWord( CalculateNewNormalAccelerationARINCWord( &arincAHR75array ), 333 );
 
     /* Read AHRS FIFO */
-    DownloadMessagesFromARINCtxvrArx2( &arincAHR75array );
+    SERVICE_AHR75_RX_FIFO( );
 
     /* As-is ARINC words to transmit */
     TransmitLatestARINCMsgIfValid( &arincAHR75array, 331, A429_CHANNEL_B ); /* Body Longitudinal Acceleration */
@@ -471,6 +600,21 @@ static void TransmitAHRSWords( )
     return;
 }
 
+/* Function: TransmitComputedAHRSWord
+ *
+ * Description: Transmits a word computed from AHR75 data to the AHR75 and,
+ *      when ARINC429_LATENCY_TRACE is defined, traces it against the receive
+ *      time of the label it was computed from.
+ * 
+ * Return: None 
+ */
+static void TransmitComputedAHRSWord( const uint32_t txWord, const uint16_t octalSourceLabel )
+{
+    ARINC429_HI3584_txvrB_TransmitWord( txWord );
+    ARINC_LATENCY_TRACE_COMPUTED_TRANSMIT( txWord, A429_CHANNEL_B, &arincAHR75array, octalSourceLabel );
+    return;
+}
+
 /* Function: TransmitADCRS422Words
  *
  * Description: Transmits message to ADC 
@@ -521,6 +665,55 @@ static void CalculateAndTransmitAHRSStatusWords( )
     ARINC429_HI3584_txvrB_TransmitWord( CalculateARINCLabel275( &arincAHR75array ) );
 }
 
+/* Function: TransmitStatusAndADCRS422Words
+ *
+ * Description: Transmits the AHRS status words and the RS422 message to the ADC. 
+ * 
+ * Return: None 
+ */
+static void TransmitStatusAndADCRS422Words( void )
+{
+    SERVICE_AHR75_RX_FIFO( );
+    CalculateAndTransmitAHRSStatusWords( );
+    TransmitADCRS422Words( ARINC429_ExtractSDIbits( arincAHR75array.msgStates[2].data.rawARINCword ) ); //mag heading SDI 
+    return;
+}
+
+/* Function: TransmitSoftwareVersionWord
+ *
+ * Description: Transmits the next software version word. 
+ * 
+ * Return: None 
+ */
+static void TransmitSoftwareVersionWord( void )
+{
+    ARINC429_HI3584_txvrB_TransmitWord( SWVer_GetNextVersionARINCMsg( ARINC429_ExtractSDIbits( arincAHR75array.msgStates[2].data.rawARINCword ) ) );
+    SERVICE_AHR75_RX_FIFO( );
+    return;
+}
+
+/* Function: StepProgramMemoryCRCCheckRow
+ *
+ * Description: Advances the program memory CRC check by one program memory
+ *      row. Called while the startup ARINC loopback tests wait for their test
+ *      words, so boot has less of the first pass left to complete after them.
+ *      A failed pass is latched, as in the main loop.
+ * 
+ * Return: None (void)
+ * 
+ * Requirement Implemented: REL.0135.S.COM.7.003
+ */
+static void StepProgramMemoryCRCCheckRow( void )
+{
+#ifndef __DEBUG
+    if (u8_StepProgramMemoryCRCCheck( &programMemoryCRCCheck, PROGRAM_MEMORY_ROW_INSTRUCTIONS ))
+    {
+        IOPStatus.StoredCodeTest &= programMemoryCRCCheck.u8PassResult;
+    }
+#endif
+    return;
+}
+
 /* Function: ReadStrapping
  *
  * Description: Strapping pins:
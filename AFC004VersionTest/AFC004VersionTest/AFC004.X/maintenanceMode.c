@@ -3,6 +3,11 @@
 #include "COMSystemTimer.h"
 #include "COMUart2.h"
 #include "Timer23.h"
+#include "BootProfile.h"
+#include "FrameMonitor.h"
+#include "FrameSchedule.h"
+#include "LinkStatistics.h"
+#include "ArincLatencyTrace.h"
 
 
 
@@ -25,6 +30,19 @@ typedef enum
 
 } DEV_ID;
 
+/* Records sent after the test array, one per pass, as they don't fit the transmit buffer together */
+typedef enum
+{
+    MX_RECORD_BOOT_PROFILE,
+    MX_RECORD_FRAME_MONITOR,
+    MX_RECORD_LINK_STATISTICS,
+    MX_RECORD_FRAME_SCHEDULE,
+#ifdef ARINC429_LATENCY_TRACE
+    MX_RECORD_LATENCY_TRACE,
+#endif
+    NUM_MX_RECORDS
+} MX_RECORD;
+
 void maintenanceMode( circBuffer_t * txBuff, circBuffer_t * rxBuff )
 {
 
@@ -39,14 +57,70 @@ void maintenanceMode( circBuffer_t * txBuff, circBuffer_t * rxBuff )
     // Test program memory CRC    
 
     uint8_t testArray[5] = { 0x01, 0xFF, 0xF2, 0xA5, 0xB2 };
+    uint8_t bootProfileFrame[BOOT_PROFILE_FRAME_SIZE];
+    uint16_t bootProfileFrameSize;
+    uint8_t frameMonitorFrame[FRAME_MONITOR_FRAME_SIZE];
+    uint16_t frameMonitorFrameSize;
+    uint8_t linkStatisticsFrame[LINK_STATISTICS_FRAME_SIZE];
+    uint16_t linkStatisticsFrameSize;
+    uint8_t frameScheduleFrame[FRAME_SCHEDULE_FRAME_SIZE];
+    uint16_t frameScheduleFrameSize;
+#ifdef ARINC429_LATENCY_TRACE
+    uint8_t latencyTraceFrame[ARINC_LATENCY_TRACE_FRAME_SIZE];
+    uint16_t latencyTraceFrameSize;
+    uint8_t latencyTraceFirstLabel = 0; /* First label accumulator of the next latency trace record */
+#endif
+    MX_RECORD recordTurn = MX_RECORD_BOOT_PROFILE;
 
 
 
     while (true)
     {
         cb_flushIn( txBuff, testArray, 5 );
+
+        /* The records don't fit the transmit buffer together, so take turns */
+        switch (recordTurn)
+        {
+            case MX_RECORD_FRAME_MONITOR:
+                /* Frame count, missed frames, overruns, busy time and slack of the last boot to run the main loop */
+                frameMonitorFrameSize = FrameMonitor_SerializeRecord( FRAME_MONITOR_LAST_RUN, frameMonitorFrame, sizeof (frameMonitorFrame) );
+                cb_flushIn( txBuff, frameMonitorFrame, frameMonitorFrameSize );
+                break;
+            case MX_RECORD_LINK_STATISTICS:
+                /* UART1 overruns and high water marks, ADC frames rejected on CRC and ARINC receive ring drops of the last boot to run the main loop */
+                linkStatisticsFrameSize = LinkStatistics_SerializeRecord( LINK_STATISTICS_LAST_RUN, linkStatisticsFrame, sizeof (linkStatisticsFrame) );
+                cb_flushIn( txBuff, linkStatisticsFrame, linkStatisticsFrameSize );
+                break;
+            case MX_RECORD_FRAME_SCHEDULE:
+                /* Period, table load, runs and latest and longest execution ticks of each frame schedule task of the last boot to run the main loop */
+                frameScheduleFrameSize = FrameSchedule_SerializeRecord( FRAME_SCHEDULE_LAST_RUN, frameScheduleFrame, sizeof (frameScheduleFrame) );
+                cb_flushIn( txBuff, frameScheduleFrame, frameScheduleFrameSize );
+                break;
+#ifdef ARINC429_LATENCY_TRACE
+            case MX_RECORD_LATENCY_TRACE:
+                /* Age-at-transmit count, min, max and sum of the last boot to run the main loop, a few labels per turn */
+                latencyTraceFrameSize = ArincLatencyTrace_SerializeRecord( latencyTraceFirstLabel, latencyTraceFrame, sizeof (latencyTraceFrame) );
+                cb_flushIn( txBuff, latencyTraceFrame, latencyTraceFrameSize );
+                latencyTraceFirstLabel += ARINC_LATENCY_TRACE_LABELS_PER_FRAME;
+                if (latencyTraceFirstLabel >= ArincLatencyTrace_GetNumLabels( ))
+                {
+                    latencyTraceFirstLabel = 0;
+                }
+                break;
+#endif
+            case MX_RECORD_BOOT_PROFILE:
+            default:
+                /* Boot stage durations of this boot, which stops at strapping, and of the last boot to reach its first frame */
+                bootProfileFrameSize = BootProfile_SerializeRecord( BOOT_PROFILE_CURRENT_BOOT, bootProfileFrame, sizeof (bootProfileFrame) );
+                cb_flushIn( txBuff, bootProfileFrame, bootProfileFrameSize );
+                bootProfileFrameSize = BootProfile_SerializeRecord( BOOT_PROFILE_LAST_COMPLETED_BOOT, bootProfileFrame, sizeof (bootProfileFrame) );
+                cb_flushIn( txBuff, bootProfileFrame, bootProfileFrameSize );
+                break;
+        }
+        recordTurn = ((NUM_MX_RECORDS - 1) == recordTurn) ? MX_RECORD_BOOT_PROFILE : (MX_RECORD) (recordTurn + 1);
+
+        /* The transmit interrupt drains the buffer well within the delay, so it is not reset here */
         UART2_TxStart( );
-        cb_reset( txBuff );
         Timer23_Delay_ms( 100 );
     }
     return;
@@ -14,6 +14,8 @@
  *        <tr><td> 10Mar2008 <td>   <center>"</center>     <td> <center>KN</center> <td> ADHR83-COM PR_CR_017
  *        <tr><td> 23Sep2008 <td>  <center> 1.0 </center>   <td> <center>JD</center> <td> Baseline Release
  *        <tr><td> 20Nov2008 <td>  <center> 1.1 </center>   <td> <center>YC</center> <td> ADHR281
+ *        <tr><td> 16Oct2026 <td>  <center> 1.2 </center>   <td> <center>BA</center> <td> Removed v_Generate32BitCRCTable
+ *        <tr><td> 16Oct2026 <td>  <center> 1.3 </center>   <td> <center>BA</center> <td> Added u32_Calculate32BitCRCOfInstructions
  *  </table>
  *  <BR>
  *  @note $Id: COMCRCModule.h 6008 2008-12-09 23:01:49Z yijing $ <BR>
@@ -36,9 +38,13 @@
     */
    #define MS_BIT 0x80000000
 
+/* Label for the CRC polynomial key used to precompute the CRC look up table. */
+   /**
+    * This value represents the 32 bit CRC polynomial key of the CRC look up table held in program memory.
+    */
+   #define CRC32_TABLE_POLYNOMIAL_KEY 0x04C11DB7U
+
 /*********************   Function Prototype declaration. *********************************/
-/* This function generates the CRC look up table. */
-   void v_Generate32BitCRCTable ( u32 u32CRCPolynomialKey ) ;
 
 /* This function calculates the CRC remainder. */
    u32 u32_Calculate32BitCRC (
@@ -47,6 +53,12 @@
       u16 u16StopPositionOfCRC ,   /* End Index position of CRC calculation Message. */
       u32 u32InitilizeCRCRemainder ) ; /* CRC remainder to be initialized in the function. */
 
+/* This function calculates the CRC remainder of program memory instructions. */
+   u32 u32_Calculate32BitCRCOfInstructions (
+      const u16 *u16paInstructions , /* Lower/upper word pairs of the instructions. */
+      u16 u16NumInstructions ,       /* Number of instructions. */
+      u32 u32InitilizeCRCRemainder ) ; /* CRC remainder to be initialized in the function. */
+
 /* Message Header and CRC verification function. **/
    void v_LoadMessageHeaderAndCRCResult (
       u8 *u8paCRCCalculationMessage ,     /* Pointer to the Message */
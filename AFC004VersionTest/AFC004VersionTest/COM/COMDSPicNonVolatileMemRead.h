@@ -16,6 +16,7 @@
  *        <tr><td> 11Mar2008 <td>   <center>"</center>     <td> <center>KN</center> <td> PR_CR_012
  *        <tr><td> 23Sep2008 <td>  <center> 1.0 </center>   <td> <center>JD</center> <td> Baseline Release
  *        <tr><td> 06Nov2008 <td>  <center> 1.1 </center>   <td> <center>YC</center> <td> ADHR281- PR_CR_066
+ *        <tr><td> 16Oct2026 <td>  <center> 1.2 </center>   <td> <center>BA</center> <td> Added v_ReadProgramMemoryRow
  *  </table>
  *  <BR>
  *  @note $Id: COMDSPicNonVolatileMemRead.h 6008 2008-12-09 23:01:49Z yijing $ <BR>
@@ -28,6 +29,7 @@
 
 extern u16 u16_ReadNonVolatileLowWord ( u32 u32Address ) ;
 extern u16 u16_ReadNonVolatileHighWord ( u32 u32Address ) ;
+extern void v_ReadProgramMemoryRow ( u32 u32Address, u16 u16NumInstructions, u16 *u16paInstructions ) ;
 
 #endif
 
@@ -10,11 +10,13 @@
  *  @par <b> Description: </b>
  *     - Reads the Lower Word from the DSPics NonVolatile Memory.
  *     - Reads the Upper Word from the DSPics NonVolatile Memory.
+ *     - Reads a block of consecutive program memory instructions.
  *
  *  @par <b> Table of Contents: </b>
  *     The following functions are defined in this file:
  *     - _u16_ReadNonVolatileLowWord
  *     - _u16_ReadNonVolatileHighWord
+ *     - _v_ReadProgramMemoryRow
  *
  *  @par <b> Change History: </b> <BR>
  *     This file is part of the compact math library for the dsPIC30.
@@ -26,6 +28,7 @@
  *        <tr><td> 23Sep2008 <td>  <center> 1.0 </center>   <td> <center>JD</center> <td> Baseline Release
  *        <tr><td> 03Nov2008 <td>  <center> 1.1 </center>   <td> <center>YC</center> <td> ADHR281: PR_CR_268
  *        <tr><td> 19Feb2009 <td>  <center> 1.2 </center>   <td> <center>KN</center> <td> ADHR343
+ *        <tr><td> 16Oct2026 <td>  <center> 1.3 </center>   <td> <center>BA</center> <td> Added _v_ReadProgramMemoryRow
  *  </table>
  *  <BR>
  *
@@ -89,4 +92,41 @@ _u16_ReadNonVolatileHighWord:
    POP W4
    return
 
+
+
+/**
+ * @brief This function reads a block of consecutive instructions from program memory.
+ *
+ * @par <b> Detailed Description: </b>
+ *      - This function takes 3 parameters, the 32 bit program memory address of the first instruction (W1:W0),
+ *        the number of instructions to read (W2) and the buffer the instructions are read into (W3).
+ *      - Each instruction is stored as two words, the lower word then the upper word, which is the same
+ *        layout as the 32 bit value returned by u32_ReadProgramMemory. The phantom byte reads as zero.
+ *      - The block must not cross a TBLPAG boundary. A block that stays within one program memory row
+ *        never does.
+ *      - A simple loop is used instead of a DO loop so the routine does not disturb the DO loop
+ *        registers of interrupted code.
+ *
+ * @author Brett Augsburger
+ *
+ * @par <b> Requirement(s) Implemented: </b> <BR>
+ *	    REL.0135.S.COM.7.003.D02 \n
+ *	    REL.0135.S.COM.7.003.D03 \n
+ *
+ * @par <b> Parameters: </b> <br>
+ *    <i> None </i> (void)
+ */
+
+_v_ReadProgramMemoryRow:
+   CP0 W2
+   BRA Z, ReadProgramMemoryRowDone
+   MOV W1,TBLPAG
+ReadProgramMemoryRowLoop:
+   TBLRDL [W0],[W3++]
+   TBLRDH [W0++],[W3++]
+   DEC W2,W2
+   BRA NZ, ReadProgramMemoryRowLoop
+ReadProgramMemoryRowDone:
+   return
+
 ;   END OF FILE (COMDSPicNonVolatileMemRead.s)
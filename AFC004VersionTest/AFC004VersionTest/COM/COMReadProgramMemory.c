@@ -11,6 +11,7 @@
  *  @par <b> Table of Contents: </b>
  *     The following functions are defined in this file:
  *       - u32_ReadProgramMemory
+ *       - v_ReadProgramMemoryRow
  *
  *  @par <b> Change History: </b> <BR>
  *     <table>
@@ -22,6 +23,7 @@
  *        <tr><td> 03Nov2008 <td>  <center> 1.1 </center>   <td> <center>YC</center> <td> ADHR281: PR_CR_246,
  *        <tr><td> 19Feb2009 <td>  <center> 1.2 </center>   <td> <center>KN</center> <td> ADHR343
  *        <tr><td> 27Jan2019 <td>  <center> 2.0 </center>   <td> <center>BA</center> <td> Changed to use __dsPIC30F__ #ifdef
+ *        <tr><td> 16Oct2026 <td>  <center> 2.1 </center>   <td> <center>BA</center> <td> Added v_ReadProgramMemoryRow
  *  </table>
  *  <BR>
  *
@@ -80,3 +82,40 @@ u32 u32_ReadProgramMemory ( u32 u32Address ) /* address in program memory */
 #   endif
 
 }
+
+#ifndef __dsPIC30F__
+/**
+ * @brief This function reads a block of consecutive instructions from Program memory
+ *
+ * @par <b> Detailed Description: </b>
+ * Stores each instruction as its lower word followed by its upper word. When used in a dsPIC, the assembly routine
+ * _v_ReadProgramMemoryRow in COMDSPicNonVolatileMemRead.s is linked instead.
+ *
+ * @author Brett Augsburger
+ *
+ * @par <b> Requirement(s) Implemented: </b> <BR>
+ *       REL.0135.S.COM.7.003.D01 \n
+ *
+ * @param [in] u32Address  address in program memory of the first instruction
+ * @param [in] u16NumInstructions  number of instructions to read
+ * @param [out] u16paInstructions  lower/upper word pairs of the instructions read
+ */
+void v_ReadProgramMemoryRow ( u32 u32Address, u16 u16NumInstructions, u16 *u16paInstructions )
+{
+   u32_val u32Value ; /* contents of program memory location */
+
+   while ( u16NumInstructions > ZERO )
+   {
+      u32Value.Val = u32_ReadProgramMemory ( u32Address ) ;
+
+      *u16paInstructions++ = u32Value.word.LW ;
+      *u16paInstructions++ = u32Value.word.HW ;
+
+      u32Address += TWO ;
+      u16NumInstructions-- ;
+   }
+
+   return ;
+   /** @return \a None (void) */
+}
+#endif
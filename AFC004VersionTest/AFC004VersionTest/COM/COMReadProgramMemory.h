@@ -15,6 +15,7 @@
  *        <tr><td> 23Sep2008 <td>  <center> 1.0 </center>   <td> <center>JD</center> <td> Baseline Release
  *        <tr><td> 02Dec2008 <td>  <center> 1.1 </center>   <td> <center>YC</center> <td> ADHR281
  *        <tr><td> 27Jan2019 <td>  <center> 2.0 </center>   <td> <center>BA</center> <td> Changed to use __dsPIC30F__ #ifdef
+ *        <tr><td> 16Oct2026 <td>  <center> 2.1 </center>   <td> <center>BA</center> <td> Added v_ReadProgramMemoryRow
  *  </table>
  *  <BR>
  *
@@ -28,12 +29,26 @@
 
 #include "COMtypedefs.h"
 
+/**
+ * This value represents the number of instructions in a program memory row.
+ */
+#define PROGRAM_MEMORY_ROW_INSTRUCTIONS 32U
+
+/**
+ * This value represents the number of program memory addresses spanned by a program memory row.
+ */
+#define PROGRAM_MEMORY_ROW_ADDRESS_SPAN ( 2U * PROGRAM_MEMORY_ROW_INSTRUCTIONS )
+
 #ifdef __dsPIC30F__
 extern u16 u16_ReadNonVolatileLowWord ( u32 u32Address ) ;
 extern u16 u16_ReadNonVolatileHighWord ( u32 u32Address ) ;
 #endif
 u32 u32_ReadProgramMemory ( u32 u32Address ) ;
 
+/* Reads u16NumInstructions instructions, within one program memory row, as lower/upper word pairs. The assembly routine
+   in COMDSPicNonVolatileMemRead.s is used when building for a dsPIC. */
+void v_ReadProgramMemoryRow ( u32 u32Address, u16 u16NumInstructions, u16 *u16paInstructions ) ;
+
 #endif
 
 /* End of COMReadProgramMemory.h header file. */
\ No newline at end of file
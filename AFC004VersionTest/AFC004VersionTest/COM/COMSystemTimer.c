@@ -10,6 +10,7 @@
  *       - This function services the Interrupt service routine.
  *       - This function returns the  system frequency flag.
  *       - This function resets the system frequency flag.
+ *       - These functions return the number of system frequency interrupts and the timer count within the frame.
  *
  *  @par <b> Table of Contents: </b>
  *     The following functions are defined in this file:
@@ -17,6 +18,8 @@
  *       - v_T4Interrupt
  *       - u16_ReadSystemFrequencyFlag
  *       - v_ResetSystemFrequencyFlag
+ *       - u16_ReadSystemFrameCount
+ *       - u16_ReadSystemFrameTimerCount
  *
  *  @par <b> Change History: </b> <BR>
  *     <table>
@@ -25,6 +28,7 @@
  *        <tr><td> 17Sep2008 <td>   <center>"</center>     <td> <center>JD</center> <td> ADHR259
  *        <tr><td> 23Sep2008 <td>  <center> 1.0 </center>   <td> <center>JD</center> <td> Baseline Release
  *        <tr><td> 02Dec2008 <td>  <center> 1.1 </center>   <td> <center>YC</center> <td> ADHR281
+ *        <tr><td> 17Oct2026 <td>  <center> 1.2 </center>   <td> <center>BA</center> <td> Count system frequency interrupts so missed frames can be detected
  *  </table>
  *  <BR>
  *
@@ -39,6 +43,9 @@
 /* The System frequency flag is set in the ISR and cleared in the polling function. */
    static u16 u16SystemFrequencyFlag ; /**< File level variable. */
 
+/* Number of system frequency interrupts, incremented in the ISR. Wraps at 16 bits. A 16 bit access is atomic. */
+   static volatile u16 u16SystemFrameCount ; /**< File level variable. */
+
 
 
 /**
@@ -63,6 +70,7 @@ void v_InitializeTMR4 ( u16 u16TMR4Config ,     /* TIMER4 Port configuration reg
 {
  /* Initialize the System Frequency Flag */
    u16SystemFrequencyFlag = ( u16 ) CLEAR ;
+   u16SystemFrameCount = ( u16 ) ZERO ;
 
 /* Clear timer1 register to start counting from Zero. */
    TMR4 = ( u16 ) ZERO ;
@@ -90,7 +98,8 @@ void v_InitializeTMR4 ( u16 u16TMR4Config ,     /* TIMER4 Port configuration reg
  * @brief This Interrupt Service Routine Services the TIMER4 peripheral at System Frequency.
  *
  * @par <b> Detailed Description: </b>
- * The interrupt flag is cleared and the System frequency flag is set.
+ * The interrupt flag is cleared, the System frequency flag is set and the frame count is incremented.
+ * The flag stays set when a frame is not serviced before the next interrupt, so only the count shows the lost frame.
  *
  * @author Vamshi Gangumalla
  *
@@ -110,6 +119,9 @@ void v_T4Interrupt ( void )
 /* Assert the 100 Hz interrupt flag. */
    u16SystemFrequencyFlag = ( u16 ) SET ;
 
+/* Count the frame. */
+   u16SystemFrameCount++ ;
+
    return ;/** @return \a None (void) */
 }/* End of v_T4Interrupt Interrupt Service Routine. */
 
@@ -159,6 +171,53 @@ void v_ResetSystemFrequencyFlag ( void )
    return ; /** @return \a None (void) */
 }/* End of v_ResetSystemFrequencyFlag function. */
 
+/**
+ * @brief This function returns the number of system frequency interrupts.
+ *
+ * @par <b> Detailed Description: </b>
+ * The count is incremented by every Timer 4 interrupt and wraps at 16 bits. The difference between two reads is
+ * the number of frames that started in between, so a frame started while the previous one was still running is
+ * not lost.
+ *
+ * @author Brett Augsburger
+ *
+ * @par <b> Requirement(s) Implemented: </b> <BR>
+ *       REL.0135.S.COM.17.003 \n
+ *
+ * @par <b> Parameters: </b> <br>
+ *    <i> None </i> (void)
+ */
+
+u16 u16_ReadSystemFrameCount ( void )
+{
+   return ( u16SystemFrameCount ) ;
+   /** @return \a u16SystemFrameCount - Number of system frequency interrupts since initialization. */
+
+}/* End of u16_ReadSystemFrameCount function. */
+
+/**
+ * @brief This function returns the Timer 4 count within the current frame.
+ *
+ * @par <b> Detailed Description: </b>
+ * Timer 4 counts from zero at each system frequency interrupt up to its period register, so its count is the time
+ * elapsed in the current frame, in Timer 4 counts.
+ *
+ * @author Brett Augsburger
+ *
+ * @par <b> Requirement(s) Implemented: </b> <BR>
+ *       REL.0135.S.COM.17.003 \n
+ *
+ * @par <b> Parameters: </b> <br>
+ *    <i> None </i> (void)
+ */
+
+u16 u16_ReadSystemFrameTimerCount ( void )
+{
+   return ( TMR4 ) ;
+   /** @return \a TMR4 - Timer 4 counts elapsed since the last system frequency interrupt. */
+
+}/* End of u16_ReadSystemFrameTimerCount function. */
+
 
 /* End of COMSystemTimer.c Module. */
 
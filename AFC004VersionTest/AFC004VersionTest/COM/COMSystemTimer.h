@@ -6,6 +6,7 @@
  *     - This function services the Interrupt service routine.
  *     - This function returns the  system frequency flag.
  *     - This function resets the system frequency flag.
+ *     - These functions return the number of system frequency interrupts and the timer count within the frame.
  *
  *  @date 18May2006
  *  @author Vamshi Gangumalla
@@ -16,6 +17,7 @@
  *        <tr><td> 01Jun2006 <td> <center>Draft</center>   <td> <center>VM</center> <td> Initial Draft
  *        <tr><td> 23Sep2008 <td>  <center> 1.0 </center>   <td> <center>JD</center> <td> Baseline Release
  *        <tr><td> 20Nov2008 <td>  <center> 1.1 </center>   <td> <center>YC</center> <td> ADHR281
+ *        <tr><td> 17Oct2026 <td>  <center> 1.2 </center>   <td> <center>BA</center> <td> Count system frequency interrupts so missed frames can be detected
  *  </table>
  *  <BR>
  *
@@ -53,6 +55,12 @@ u16 u16_ReadSystemFrequencyFlag(void);
 /* This function resets the system frequency flag. */
 void v_ResetSystemFrequencyFlag(void);
 
+/* Function to read the number of system frequency interrupts. */
+u16 u16_ReadSystemFrameCount(void);
+
+/* Function to read the Timer 4 count elapsed in the current frame. */
+u16 u16_ReadSystemFrameTimerCount(void);
+
 #endif
 /* End of COMSPI1.h Module. */
 
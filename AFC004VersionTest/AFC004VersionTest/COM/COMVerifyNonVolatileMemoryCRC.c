@@ -6,10 +6,13 @@
  *  @author Stephen Hallacy
  *
  *  @par <b> Description: </b>
- *       - CRC is computed in 40-byte blocks defined by the symbol MAXIMUM_BYTES_FOR_CRC
+ *       - EEPROM CRC is computed in 40-byte blocks defined by the symbol MAXIMUM_BYTES_FOR_CRC
+ *       - Program memory CRC is computed up to a program memory row at a time
  *
  *  @par <b> Table of Contents: </b>
  *     The following functions are defined in this file:
+ *       - v_StartProgramMemoryCRCCheck - Starts a resumable Program Memory CRC check
+ *       - u8_StepProgramMemoryCRCCheck - Advances a resumable Program Memory CRC check
  *       - u8_VerifyProgramCRC - Verifies Program Memory CRC
  *       - u8_VerifyEepromCRC - Verifies EEPROM Memory CRC
  *       - u32_ComputeEEPROMCRC - Computes EEPROM Memory CRC
@@ -32,6 +35,9 @@
  *        <tr><td> 06May2009 <td>  <center> 1.9 </center>   <td> <center>YC</center> <td> PR_LLR_054
  *        <tr><td> 27Jan2019 <td>  <center> 2.0 </center>   <td> <center>BA</center> <td> Updated verify prog. memory CRC function
  *                                                                                        to use passed addresses
+ *        <tr><td> 16Oct2026 <td>  <center> 2.1 </center>   <td> <center>BA</center> <td> Program memory CRC computed by a resumable
+ *                                                                                        check that can run a slice per frame
+ *        <tr><td> 16Oct2026 <td>  <center> 2.2 </center>   <td> <center>BA</center> <td> Program memory read and CRC'd a row at a time
  *  </table>
  *  <BR>
  *
@@ -62,90 +68,162 @@
 
 #ifndef TIDSP
 /**
- * @brief Computes the CRC over the specified program memory range and compares result to a previously computed CRC value.
+ * @brief Starts a program memory CRC check that is computed a bounded number of instructions at a time.
  *
  * @par <b> Detailed Description: </b>
- * Step 1: Get StartAddress, EndAddress., and initial CRC.
- * Step 2: Init ByteIndex, Address to zero.
- * Step 3: Init pointer to program instruction value to zero.
- * Step 4: Init a Done flag and a return value flag to zero.
- * Step 5: Init computed CRC value to zero
- * Step 6: IF EndAddress is greater than (StartAddress + 2), THEN go to Step 7. ELSE go to Step 17?
- * Step 7: IF Address is less than or equal to EndAddress, set ByteIndex to zero.
- * Step 8: IF ByteIndex is less than 40 bytes, THEN go to Step 9. ELSE go to Step 14.
- * Step 9. Read program memory, call function u32_ReadProgramMemory
- * Step 10. Store 4 bytes form program memory into ByteArray, and increase ByteIndex by 4.
- * Step 11. IF Address is equal to the EndAddress, THEN go to Step 12. ELSE go to Step 13
- * Step 12. Set the Done flag to True, THEN go to Step 14.
- * Step 13. Address is added to 2, THEN go to Step 8.
- * Step 14. Computed CRC value, call function u32_Calculate32BitCRC.
- * Step 15. IF Done flag is set True, THEN go to step 16. ELSE go to Step 7.
- * Step 16. If  computed CRC value is equal to initial CRC, THEN set the return  flag to success,ELSE goto next step
- * Step 17. Set the return  flag to FAILURE
- * Step 18. EXIT, and return the return flag.
+ * Step 1: Store StartAddress, EndAddress and CRCAddress in the check.
+ * Step 2: Set the current address to StartAddress and the computed CRC to zero.
+ * Step 3: Clear the completed pass count and set the pass result to SUCCESS.
  *
- * u32CRC = Previously Computed (On Host PC) CRC of Program memory that starts at address u32StartAddress and ends at
- * address u32EndAddress. The Value at the end address is included in the CRC computation.
- *
- * @author Stephen Hallacy, Brett Augsburger
+ * @author Brett Augsburger
  *
  * @par <b> Requirement(s) Implemented: </b> <BR>
  *       REL.0135.S.COM.7.003 \n
  *
+ * @param [out] pCRCCheck        Check to start
  * @param [in] u32StartAddress   First Program Address in range of addresses to verify
  * @param [in] u32EndAddress     Last Program Address in range of addresses to verify
  * @param [in] u32CRCAddress     Address holding the previously computed CRC
  */
-u8 u8_VerifyProgramMemoryCRC ( u32 u32StartAddress, u32 u32EndAddress, u32 u32CRCAddress )
+void v_StartProgramMemoryCRCCheck ( ProgramMemoryCRCCheck *pCRCCheck, u32 u32StartAddress, u32 u32EndAddress,
+                                    u32 u32CRCAddress )
 {
-   u32 u32CurrentAddress ; /* Holds the working program memory address */
-   u16 u16BufferIndex ; /* index for u8aBuffer */
-   u32_val u32ProgramInstructionValue ; /* Value at the current memory address being accessed */
-   u8 u8aBuffer[MAXIMUM_BYTES_FOR_CRC] ; /* Buffer for read program data */
-   u32 u32ComputedCRC = ZERO ; /* Holds the computed CRC */
-   u8 u8ReturnValue = ZERO ; /* pass/fail return value */
-   u32_val u32StoredCRC; /* Holds the stored CRC */
+   pCRCCheck->u32StartAddress = u32StartAddress ;
+   pCRCCheck->u32EndAddress = u32EndAddress ;
+   pCRCCheck->u32CRCAddress = u32CRCAddress ;
+   pCRCCheck->u32CurrentAddress = u32StartAddress ;
+   pCRCCheck->u32ComputedCRC = ZERO ;
+   pCRCCheck->u16NumPassesCompleted = ZERO ;
+   pCRCCheck->u8PassResult = SUCCESS ;
 
-   /* Initialize working address to specified start address */
-   u32CurrentAddress = u32StartAddress ;
+   return ;
+   /** @return \a None (void) */
+} /* end v_StartProgramMemoryCRCCheck */
+
+/**
+ * @brief Advances a program memory CRC check by at most the given number of instructions.
+ *
+ * @par <b> Detailed Description: </b>
+ * Step 1: IF the instruction budget is used up, THEN go to Step 7.
+ * Step 2: Read the rest of the current program memory row, stopping early at the end of the budget or at EndAddress,
+ *         call function v_ReadProgramMemoryRow. Each instruction read advances the current address by 2.
+ * Step 3: Carry the CRC of the instructions read over into the computed CRC, call function
+ *         u32_Calculate32BitCRCOfInstructions.
+ * Step 4: IF the current address has passed EndAddress, THEN go to Step 5. ELSE go to Step 1.
+ * Step 5: Compare the computed CRC to the stored CRC. On a mismatch set the pass result to FAILURE; it is never set back
+ *         to SUCCESS. Count the completed pass.
+ * Step 6: Restart the pass at StartAddress with a computed CRC of zero, THEN go to Step 7.
+ * Step 7: EXIT, and return whether a pass was completed.
+ *
+ * The CRC of a pass is identical to the CRC computed by u8_VerifyProgramMemoryCRC over the same range, however the
+ * pass is divided into steps.
+ *
+ * @author Brett Augsburger
+ *
+ * @par <b> Requirement(s) Implemented: </b> <BR>
+ *       REL.0135.S.COM.7.003 \n
+ *
+ * @param [in,out] pCRCCheck        Check to advance
+ * @param [in] u16NumInstructions   Maximum number of program memory instructions to read in this step
+ */
+u8 u8_StepProgramMemoryCRCCheck ( ProgramMemoryCRCCheck *pCRCCheck, u16 u16NumInstructions )
+{
+   u16 u16aInstructions[TWO * PROGRAM_MEMORY_ROW_INSTRUCTIONS] ; /* Lower/upper word pairs of the row being read */
+   u16 u16NumRowInstructions ; /* Number of instructions read from the current row */
+   u32 u32NumRemainingInstructions ; /* Number of instructions left in the current pass */
+   u32_val u32StoredCRC; /* Holds the stored CRC */
+   u8 u8IsPassComplete = FALSE ; /* Set when this step completes a pass */
 
-   /* Compute CRC over address range u32StartAddress to u32EndAddress. This calculation is performed piecewise. */
-   while ( u32CurrentAddress <= u32EndAddress )
+   while ( ( u16NumInstructions > ZERO ) && ( FALSE == u8IsPassComplete ) )
    {
-      u16BufferIndex = ZERO ;
+      /* Read up to the end of the current program memory row, the end of this step's budget or end address */
+      u16NumRowInstructions = ( u16 ) ( ( PROGRAM_MEMORY_ROW_ADDRESS_SPAN -
+                                          ( pCRCCheck->u32CurrentAddress & ( PROGRAM_MEMORY_ROW_ADDRESS_SPAN - ONE ) ) ) /
+                                        TWO ) ;
+
+      if ( u16NumRowInstructions > u16NumInstructions )
+      {
+         u16NumRowInstructions = u16NumInstructions ;
+      }
 
-      /* Fill buffer up to maximum or end address if reached */
-      while ( ( u16BufferIndex < MAXIMUM_BYTES_FOR_CRC ) && ( u32CurrentAddress <= u32EndAddress ) )
+      if ( pCRCCheck->u32CurrentAddress <= pCRCCheck->u32EndAddress )
       {
+         u32NumRemainingInstructions = ( ( pCRCCheck->u32EndAddress - pCRCCheck->u32CurrentAddress ) / TWO ) + ONE ;
+         if ( u32NumRemainingInstructions < u16NumRowInstructions )
+         {
+            u16NumRowInstructions = ( u16 ) u32NumRemainingInstructions ;
+         }
+
          /* Read Program Memory */
-         u32ProgramInstructionValue.Val = u32_ReadProgramMemory ( u32CurrentAddress ) ;
+         v_ReadProgramMemoryRow ( pCRCCheck->u32CurrentAddress, u16NumRowInstructions, u16aInstructions ) ;
 
-         /* Copy to buffer */
-         u8aBuffer[u16BufferIndex++] = u32ProgramInstructionValue.v[0] ;
-         u8aBuffer[u16BufferIndex++] = u32ProgramInstructionValue.v[1] ;
-         u8aBuffer[u16BufferIndex++] = u32ProgramInstructionValue.v[2] ;
-         u8aBuffer[u16BufferIndex++] = u32ProgramInstructionValue.v[3] ;
+         /* Calculate CRC for this row of data. CRC calculation from previous row is carried over. */
+         pCRCCheck->u32ComputedCRC = u32_Calculate32BitCRCOfInstructions ( u16aInstructions, u16NumRowInstructions,
+                                                                           pCRCCheck->u32ComputedCRC ) ;
 
-         u32CurrentAddress += TWO ;
+         pCRCCheck->u32CurrentAddress += TWO * ( u32 ) u16NumRowInstructions ;
+         u16NumInstructions -= u16NumRowInstructions ;
       }
-      /* Calculate CRC for this packet of data. CRC calculation from previous packet is carried over. */
-      u32ComputedCRC = u32_Calculate32BitCRC ( u8aBuffer, ZERO, u16BufferIndex - ONE, u32ComputedCRC ) ;
-   } /* End while ( u32Address <= u32EndAddress ) */
-   
-   u32StoredCRC.word.LW = u16_ReadNonVolatileLowWord ( u32CRCAddress ) ;
-   u32StoredCRC.word.HW = u16_ReadNonVolatileLowWord ( u32CRCAddress + 2 ) ;
 
-   /* Compare CRC value to previously computed 32-bit CRC stored in program memory */
-   if ( u32ComputedCRC == u32StoredCRC.Val )
-   {
-      u8ReturnValue = SUCCESS ;
+      if ( pCRCCheck->u32CurrentAddress > pCRCCheck->u32EndAddress )
+      {
+         u32StoredCRC.word.LW = u16_ReadNonVolatileLowWord ( pCRCCheck->u32CRCAddress ) ;
+         u32StoredCRC.word.HW = u16_ReadNonVolatileLowWord ( pCRCCheck->u32CRCAddress + 2 ) ;
+
+         /* Compare CRC value to previously computed 32-bit CRC stored in program memory. A failure is latched. */
+         if ( pCRCCheck->u32ComputedCRC != u32StoredCRC.Val )
+         {
+            pCRCCheck->u8PassResult = FAILURE ;
+         }
+
+         if ( pCRCCheck->u16NumPassesCompleted < HEX_FFFF )
+         {
+            pCRCCheck->u16NumPassesCompleted++ ;
+         }
+
+         /* Start the next pass */
+         pCRCCheck->u32CurrentAddress = pCRCCheck->u32StartAddress ;
+         pCRCCheck->u32ComputedCRC = ZERO ;
+         u8IsPassComplete = TRUE ;
+      }
    }
-   else
+
+   return u8IsPassComplete ;
+   /** @return \a TRUE if this step completed a pass, and u8PassResult holds its result. Otherwise, Returns FALSE. */
+} /* end u8_StepProgramMemoryCRCCheck */
+
+/**
+ * @brief Computes the CRC over the specified program memory range and compares result to a previously computed CRC value.
+ *
+ * @par <b> Detailed Description: </b>
+ * Step 1: Start a program memory CRC check over StartAddress to EndAddress, call function v_StartProgramMemoryCRCCheck.
+ * Step 2: Advance the check, call function u8_StepProgramMemoryCRCCheck.
+ * Step 3: IF the check has completed a pass, THEN go to Step 4. ELSE go to Step 2.
+ * Step 4: EXIT, and return the pass result of the check.
+ *
+ * u32CRC = Previously Computed (On Host PC) CRC of Program memory that starts at address u32StartAddress and ends at
+ * address u32EndAddress. The Value at the end address is included in the CRC computation.
+ *
+ * @author Stephen Hallacy, Brett Augsburger
+ *
+ * @par <b> Requirement(s) Implemented: </b> <BR>
+ *       REL.0135.S.COM.7.003 \n
+ *
+ * @param [in] u32StartAddress   First Program Address in range of addresses to verify
+ * @param [in] u32EndAddress     Last Program Address in range of addresses to verify
+ * @param [in] u32CRCAddress     Address holding the previously computed CRC
+ */
+u8 u8_VerifyProgramMemoryCRC ( u32 u32StartAddress, u32 u32EndAddress, u32 u32CRCAddress )
+{
+   ProgramMemoryCRCCheck CRCCheck ; /* Check covering the whole range in one call */
+
+   v_StartProgramMemoryCRCCheck ( &CRCCheck, u32StartAddress, u32EndAddress, u32CRCAddress ) ;
+
+   while ( FALSE == u8_StepProgramMemoryCRCCheck ( &CRCCheck, HEX_FFFF ) )
    {
-      u8ReturnValue = FAILURE ;
    }
 
-   return u8ReturnValue ;
+   return CRCCheck.u8PassResult ;
    /** @return \a SUCCESS if Program CRC equals u32CRC. Otherwise, Returns FAILURE. */
 } /* end u8_VerifyProgramCRC */
 
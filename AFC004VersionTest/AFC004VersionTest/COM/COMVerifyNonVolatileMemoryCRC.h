@@ -18,6 +18,7 @@
  *        <tr><td> 19Feb2009 <td>  <center> 1.3 </center>   <td> <center>KN</center> <td> ADHR343
  *        <tr><td> 27Jan2019 <td>  <center> 2.0 </center>   <td> <center>BA</center> <td> Updated verify prog. memory CRC function
  *                                                                                        to use passed addresses
+ *        <tr><td> 16Oct2026 <td>  <center> 2.1 </center>   <td> <center>BA</center> <td> Added resumable program memory CRC check
  *  </table>
  *  <BR>
  *
@@ -68,6 +69,31 @@ extern u16 u16_ReadNonVolatileLowWord ( u32 u32Address ) ; /* NonVolatile Memory
 
 #endif
 
+#ifndef TIDSP
+
+/**
+ * State of a program memory CRC check that is computed a bounded number of instructions at a time.
+ */
+typedef struct
+{
+   u32 u32StartAddress ;       /* First program address in the range to verify */
+   u32 u32EndAddress ;         /* Last program address in the range to verify */
+   u32 u32CRCAddress ;         /* Address holding the previously computed CRC */
+   u32 u32CurrentAddress ;     /* Next program address to read in the current pass */
+   u32 u32ComputedCRC ;        /* CRC of the addresses read so far in the current pass */
+   u16 u16NumPassesCompleted ; /* Number of completed passes, saturates at HEX_FFFF */
+   u8 u8PassResult ;           /* SUCCESS until a completed pass does not match the stored CRC, then FAILURE */
+} ProgramMemoryCRCCheck ;
+
+/* Use this function to start a resumable program memory CRC check */
+void v_StartProgramMemoryCRCCheck ( ProgramMemoryCRCCheck *pCRCCheck, u32 u32StartAddress, u32 u32EndAddress,
+                                    u32 u32CRCAddress ) ;
+
+/* Use this function to advance a resumable program memory CRC check by up to u16NumInstructions */
+u8 u8_StepProgramMemoryCRCCheck ( ProgramMemoryCRCCheck *pCRCCheck, u16 u16NumInstructions ) ;
+
+#endif
+
 /* Use this function to verify the CRC of the program memory */
 u8 u8_VerifyProgramMemoryCRC ( u32 u32StartAddress, u32 u32EndAddress, u32 u32CRCAddress ) ;
 
@@ -11,12 +11,64 @@
 
 /**************  Included File(s) **************************/
 #include "CircularBuffer.h"
+#include <string.h>
 
 /**************  Macro Definition(s) ***********************/
 #ifndef min
 #define min(x, y) (((x) < (y)) ? (x) : (y))
 #endif
 
+/* Stops the compiler moving data accesses across an index update, so the 
+ * other side of the ring never sees an index before the data it covers */
+#define CB_MEMORY_BARRIER() __asm__ volatile ("" ::: "memory")
+
+#define CB_MAX_BYTES_DROPPED 0xFFFFu
+
+/* Wraps an index less than twice the capacity back into the buffer */
+#ifdef CB_POWER_OF_TWO_CAPACITY
+#define CB_WRAP_INDEX(cb, idx) ((idx) & ((cb)->capacity - 1u))
+#else
+#define CB_WRAP_INDEX(cb, idx) (((idx) >= (cb)->capacity) ? ((idx) - (cb)->capacity) : (idx))
+#endif
+
+
+/**************  Static Function Prototypes (s) ***********/
+static void cb_recordProducerStatistics( circBuffer_t * const cb,
+                                         const size_t bytesUsed,
+                                         const size_t numBytesDropped );
+
+
+/**************  Static Function Definition(s) ************/
+
+/*
+ * Function: cb_recordProducerStatistics
+ * 
+ * Description: Updates the high water mark with the bytes held after a write
+ *              and adds any bytes that didn't fit to the saturating dropped 
+ *              byte count. Called only from the producer side. 
+ * 
+ * Return: None
+ * 
+ * Requirement Implemented: INT1.0102.S.IOP.3.001
+ */
+static void cb_recordProducerStatistics( circBuffer_t * const cb,
+                                         const size_t bytesUsed,
+                                         const size_t numBytesDropped )
+{
+    if (bytesUsed > cb->highWaterMark)
+    {
+        cb->highWaterMark = bytesUsed;
+    }
+
+    if (0 != numBytesDropped)
+    {
+        const uint16_t numBytesDroppedSoFar = cb->numBytesDropped;
+        cb->numBytesDropped = (numBytesDropped >= (size_t) (CB_MAX_BYTES_DROPPED - numBytesDroppedSoFar))
+                ? CB_MAX_BYTES_DROPPED : (uint16_t) (numBytesDroppedSoFar + numBytesDropped);
+    }
+    return;
+}
+
 
 /**************  Function Definition(s) ********************/
 
@@ -32,15 +84,19 @@
 void cb_push( circBuffer_t * const cb, /* Pointer to circular buffer struct*/
               const uint8_t data ) /* Input data to be pushed */
 {
-    size_t offset = cb->head + 1;
-    if (offset >= cb->capacity)
+    const size_t head = cb->head;
+    const size_t tail = cb->tail;
+    const size_t offset = CB_WRAP_INDEX( cb, head + 1 );
+    if (offset != tail) /* Head-tail wraparound protection */
     {
-        offset = 0;
+        cb->data[head] = data;
+        CB_MEMORY_BARRIER( );
+        cb->head = offset; /* Publish the byte to the consumer */
+        cb_recordProducerStatistics( cb, CB_WRAP_INDEX( cb, offset + cb->capacity - tail ), 0 );
     }
-    if (offset != cb->tail) /* Head-tail wraparound protection */
+    else
     {
-        cb->data[cb->head] = data;
-        cb->head = offset;
+        cb_recordProducerStatistics( cb, 0, 1 );
     }
     return;
 }
@@ -57,14 +113,12 @@ void cb_push( circBuffer_t * const cb, /* Pointer to circular buffer struct*/
 uint8_t cb_pop( circBuffer_t * const cb ) /* Pointer to circular buffer struct */
 {
     uint8_t data;
-    if (cb->head != cb->tail)
+    const size_t tail = cb->tail;
+    if (cb->head != tail)
     {
-        data = cb->data[cb->tail];
-        cb->tail += 1;
-        if (cb->tail >= cb->capacity)
-        {
-            cb->tail -= cb->capacity;
-        }
+        data = cb->data[tail];
+        CB_MEMORY_BARRIER( );
+        cb->tail = CB_WRAP_INDEX( cb, tail + 1 ); /* Release the slot to the producer */
     }
     else
     {
@@ -73,6 +127,37 @@ uint8_t cb_pop( circBuffer_t * const cb ) /* Pointer to circular buffer struct *
     return data;
 }
 
+/*
+ * Function: cb_init
+ *
+ * Description: Checks a circular buffer's data pointer and capacity and sets
+ *              it empty, with its statistics cleared. With
+ *              CB_POWER_OF_TWO_CAPACITY the indices are wrapped with a mask,
+ *              so a capacity that is not a power of two is rejected. Must not
+ *              run while the producer or consumer is active.
+ *
+ * Return: True if the buffer can be used, false otherwise
+ *
+ * Requirement Implemented: INT1.0102.S.IOP.3.003
+ */
+bool cb_init( circBuffer_t * const cb ) /* Pointer to circular buffer struct */
+{
+    cb_reset( cb );
+    cb_resetStatistics( cb );
+
+    if ((NULL == cb->data) || (0u == cb->capacity))
+    {
+        return false;
+    }
+#ifdef CB_POWER_OF_TWO_CAPACITY
+    if (!CB_IS_POWER_OF_TWO( cb->capacity ))
+    {
+        return false;
+    }
+#endif
+    return true;
+}
+
 /* 
  * Function: cb_reset
  * 
@@ -101,12 +186,7 @@ void cb_reset( circBuffer_t * const cb ) /* Pointer to circular buffer struct */
 uint8_t cb_peek( const circBuffer_t * const cb, /* Pointer to circular buffer struct */
                  const size_t offset ) /* Offset value to peek at */
 {
-    size_t idx = cb->tail + offset;
-    if (idx >= cb->capacity)
-    {
-        idx -= cb->capacity;
-    }
-    return cb->data[idx];
+    return cb->data[CB_WRAP_INDEX( cb, cb->tail + offset )];
 }
 
 /*
@@ -121,7 +201,13 @@ uint8_t cb_peek( const circBuffer_t * const cb, /* Pointer to circular buffer st
  */
 size_t cb_bytesUsed( const circBuffer_t * const cb ) /* Pointer to circular buffer struct */
 {
-    return (cb->head >= cb->tail) ? cb->head - cb->tail : cb->capacity - (cb->tail - cb->head);
+    const size_t head = cb->head;
+    const size_t tail = cb->tail;
+#ifdef CB_POWER_OF_TWO_CAPACITY
+    return (head - tail) & (cb->capacity - 1u);
+#else
+    return (head >= tail) ? head - tail : cb->capacity - (tail - head);
+#endif
 }
 
 /*
@@ -136,16 +222,49 @@ size_t cb_bytesUsed( const circBuffer_t * const cb ) /* Pointer to circular buff
 void cb_advanceTail( circBuffer_t * const cb, /* Pointer to circular buffer struct */
                      const size_t num )
 {
-    size_t maxAdvance;
-    size_t advance;
-    maxAdvance = (cb->tail > cb->head) ? cb->head + cb->capacity - cb->tail : cb->head - cb->tail;
-    advance = min( num, maxAdvance );
-    cb->tail += advance;
-    if (cb->tail >= cb->capacity)
+    const size_t advance = min( num, cb_bytesUsed( cb ) );
+    CB_MEMORY_BARRIER( );
+    cb->tail = CB_WRAP_INDEX( cb, cb->tail + advance ); /* Release the space to the producer */
+    return;
+}
+
+/*
+ * Function:  cb_peekSpans
+ *
+ * Description:  Locates up to numBytes of stored data, starting offset bytes
+ *               past the tail, as one or two contiguous spans of the buffer's
+ *               data array. The first span runs to the end of the data array 
+ *               at most; the second span, if not empty, starts at index zero. 
+ *               The data is not copied and the tail is not advanced, so the 
+ *               spans remain valid until the tail is advanced past them. 
+ * 
+ * Return: Number of bytes located, limited to the data stored past the offset
+ * 
+ * Requirement Implemented:  INT1.0102.S.IOP.3.004
+ */
+size_t cb_peekSpans( const circBuffer_t * const cb, /* Pointer to circular buffer struct */
+                     const size_t offset, /* Offset from the tail of the first byte */
+                     const size_t numBytes, /* Number of bytes to locate */
+                     circBufferSpan_t spans[CB_NUM_SPANS] ) /* Returned spans */
+{
+    spans[0].data = cb->data;
+    spans[0].length = 0;
+    spans[1].data = cb->data;
+    spans[1].length = 0;
+
+    const size_t sz = cb_bytesUsed( cb );
+    if (offset >= sz)
     {
-        cb->tail -= cb->capacity;
+        return 0;
     }
-    return;
+
+    const size_t numBytesLocated = min( numBytes, sz - offset );
+    const size_t idx = CB_WRAP_INDEX( cb, cb->tail + offset );
+
+    spans[0].data = cb->data + idx;
+    spans[0].length = min( numBytesLocated, cb->capacity - idx );
+    spans[1].length = numBytesLocated - spans[0].length;
+    return numBytesLocated;
 }
 
 /*
@@ -178,42 +297,80 @@ size_t cb_flushOut( circBuffer_t * const cb, /* Pointer to circular buffer struc
         return 0;
     }
 
-    size_t sz = cb_bytesUsed( cb );
-    if (0 == sz)
-    {
-        return 0;
-    }
-    size_t contiguous = min( cb->capacity - cb->tail, sz );
-    size_t wrapped = sz - contiguous; // Equals zero if no wrap around
+    /* Copy out in at most two blocks: up to the end of the buffer, then from its start */
+    circBufferSpan_t spans[CB_NUM_SPANS];
+    const size_t written = cb_peekSpans( cb, 0, numBytesToFlush, spans );
 
-    uint8_t* cbAddr = cb->data + cb->tail;
-    size_t maxCount = min( contiguous, numBytesToFlush );
-    size_t count;
-    for (count = 0; count < maxCount; count++)
-    {
-        destBuff[count] = cbAddr[count];
-    }
+    memcpy( destBuff, spans[0].data, spans[0].length );
+    memcpy( destBuff + spans[0].length, spans[1].data, spans[1].length );
+    cb_advanceTail( cb, written );
 
-    size_t written = maxCount;
-    cb_advanceTail( cb, maxCount );
+    return written;
+}
 
-    /* Exit if failed to write everything tried to write, or if there's nothing left to write. */
-    if (written != contiguous || wrapped == 0)
+/*
+ * Function:  cb_reserve
+ *
+ * Description:  Reserves up to numBytes of free space after the head, as one or 
+ *               two contiguous spans of the buffer's data array, so data can be
+ *               written in place instead of being staged and flushed in. The 
+ *               head is not moved; written bytes become visible to the reader 
+ *               only when cb_commit is called. One slot is always left free so
+ *               that a full buffer is not mistaken for an empty one. 
+ * 
+ *               The tail may be advanced by a reader interrupt at any time, 
+ *               which only increases the free space, so it is read once. 
+ * 
+ * Return: Number of bytes reserved, limited to the free space 
+ * 
+ * Requirement Implemented:  INT1.0102.S.IOP.3.008
+ */
+size_t cb_reserve( const circBuffer_t * const cb, /* Pointer to circular buffer struct */
+                   const size_t numBytes, /* Number of bytes to reserve */
+                   circBufferSpan_t spans[CB_NUM_SPANS] ) /* Returned writable spans */
+{
+    spans[0].data = cb->data;
+    spans[0].length = 0;
+    spans[1].data = cb->data;
+    spans[1].length = 0;
+
+    const size_t head = cb->head;
+    const size_t tail = cb->tail;
+    if ((head >= cb->capacity) ||
+            (tail >= cb->capacity))
     {
-        return written;
+        /* Error! Unexpected buffer parameters */
+        return 0;
     }
 
-    maxCount = min( wrapped, numBytesToFlush - contiguous );
-    cbAddr = cb->data;
-    for (count = 0; count < maxCount; count++)
-    {
-        destBuff[count + contiguous] = cbAddr[count];
-    }
+    const size_t bytesFree = (tail > head) ? tail - head - 1 : cb->capacity - (head - tail) - 1;
+    const size_t numBytesReserved = min( numBytes, bytesFree );
 
-    written += maxCount;
-    cb_advanceTail( cb, maxCount );
+    spans[0].data = cb->data + head;
+    spans[0].length = min( numBytesReserved, cb->capacity - head );
+    spans[1].length = numBytesReserved - spans[0].length;
+    return numBytesReserved;
+}
 
-    return written;
+/*
+ * Function:  cb_commit
+ *
+ * Description:  Advances the head past bytes written to space returned by 
+ *               cb_reserve. A reservation may be committed in several steps, 
+ *               which lets the reader start on the first part while the rest 
+ *               is still being written. 
+ * 
+ * Return: None
+ * 
+ * Requirement Implemented:  INT1.0102.S.IOP.3.008
+ */
+void cb_commit( circBuffer_t * const cb, /* Pointer to circular buffer struct */
+                const size_t numBytes ) /* Number of reserved bytes written */
+{
+    CB_MEMORY_BARRIER( );
+    cb->head = CB_WRAP_INDEX( cb, cb->head + numBytes ); /* Single store, so the reader never sees a partial update */
+    cb_recordProducerStatistics( cb, cb_bytesUsed( cb ), 0 );
+    return;
 }
 
 /*
@@ -245,62 +402,65 @@ size_t cb_flushIn( circBuffer_t * const cb, /* Pointer to circular buffer struct
         return 0;
     }
 
-    size_t numBytesReadIntoCB;
-
-    /* If "head" < "tail" then there is just one block of buffer available to be written to. */
-    if (cb->head < cb->tail)
-    {
-        /* Read in every available byte, up to "bytesFree" bytes, starting at "head". */
-        numBytesReadIntoCB = min( cb->tail - cb->head - 1, numBytesToFlush );
-        uint8_t* cbAddr = cb->data + cb->head;
+    /* Copy in at most two blocks: up to the end of the buffer, then from its start */
+    circBufferSpan_t spans[CB_NUM_SPANS];
+    const size_t numBytesReadIntoCB = cb_reserve( cb, numBytesToFlush, spans );
 
-        size_t idx;
-        for (idx = 0; idx < numBytesReadIntoCB; idx++)
-        {
-            cbAddr[idx] = srcBuff[idx];
-        }
+    memcpy( spans[0].data, srcBuff, spans[0].length );
+    memcpy( spans[1].data, srcBuff + spans[0].length, spans[1].length );
+    cb_commit( cb, numBytesReadIntoCB );
+    cb_recordProducerStatistics( cb, 0, numBytesToFlush - numBytesReadIntoCB );
 
-        cb->head += numBytesReadIntoCB;
-    }
-    else
-    { /* cb->head >= cb->tail */
-        size_t blockSize = cb->capacity - cb->head;
-        if (cb->tail == 0) /* Don't read into last buffer position if "tail" is at 0 position */
-            blockSize--;
-
-        numBytesReadIntoCB = min( blockSize, numBytesToFlush );
-        uint8_t* cbAddr = cb->data + cb->head;
-
-        size_t idx;
-        for (idx = 0; idx < numBytesReadIntoCB; idx++)
-        {
-            cbAddr[idx] = srcBuff[idx];
-        }
-
-        cb->head += numBytesReadIntoCB;
-
-        if (cb->head >= cb->capacity)
-        { /* Added > condition just to be safe */
-            cb->head = 0; /* Wrapped around the buffer */
-
-            /* Try to read more starting at beginning of buffer */
-            if (cb->tail != 0)
-            { /* "tail" shouldn't normally be 0 at this point but just to be safe */
-                size_t numBytesToRead2ndStep = min( cb->tail - 1, numBytesToFlush - numBytesReadIntoCB );
-
-                uint8_t* cbAddr = cb->data;
-
-                size_t idx;
-                for (idx = 0; idx < numBytesToRead2ndStep; idx++)
-                {
-                    cbAddr[idx] = srcBuff[idx + numBytesReadIntoCB];
-                }
-
-                numBytesReadIntoCB += numBytesToRead2ndStep;
-                cb->head += numBytesToRead2ndStep;
-            }
-        }
-    }
     return numBytesReadIntoCB;
 }
+
+/*
+ * Function:  cb_getNumBytesDropped
+ *
+ * Description:  Returns the number of bytes the producer could not store 
+ *               because the buffer was full. Saturates at 0xFFFF. Lets buffer
+ *               overruns be told apart from bad data on a link. 
+ * 
+ * Return: Number of bytes dropped
+ * 
+ * Requirement Implemented:  INT1.0102.S.IOP.3.005
+ */
+uint16_t cb_getNumBytesDropped( const circBuffer_t * const cb ) /* Pointer to circular buffer struct */
+{
+    return cb->numBytesDropped;
+}
+
+/*
+ * Function:  cb_getHighWaterMark
+ *
+ * Description:  Returns the most bytes the buffer has held at once, measured 
+ *               each time the producer adds data. Used to size buffers from 
+ *               measured occupancy. 
+ * 
+ * Return: High water mark in bytes
+ * 
+ * Requirement Implemented:  INT1.0102.S.IOP.3.005
+ */
+size_t cb_getHighWaterMark( const circBuffer_t * const cb ) /* Pointer to circular buffer struct */
+{
+    return cb->highWaterMark;
+}
+
+/*
+ * Function:  cb_resetStatistics
+ *
+ * Description:  Clears the dropped byte count and high water mark. The 
+ *               statistics are not cleared by cb_reset. Must not run while 
+ *               the producer is active. 
+ * 
+ * Return: None
+ * 
+ * Requirement Implemented:  INT1.0102.S.IOP.3.003
+ */
+void cb_resetStatistics( circBuffer_t * const cb ) /* Pointer to circular buffer struct */
+{
+    cb->numBytesDropped = 0;
+    cb->highWaterMark = 0;
+    return;
+}
 /* end CircularBuffer.c */
@@ -16,15 +16,41 @@
 /**************  Included File(s) **************************/
 #include <stddef.h>
 #include <stdint.h>
+#include <stdbool.h>
+
+/**************  Macro Definition(s) ***********************/
+/* Every circular buffer capacity in the build is a power of two, so indices 
+ * are wrapped with a mask instead of a compare and subtract. cb_init rejects 
+ * a buffer whose capacity is not. Comment out to allow arbitrary capacities. */
+#define CB_POWER_OF_TWO_CAPACITY
+
+/* True if a capacity can be used with CB_POWER_OF_TWO_CAPACITY */
+#define CB_IS_POWER_OF_TWO(capacity) ((0u != (capacity)) && (0u == ((capacity) & ((capacity) - 1u))))
+
 
 /**************  Type Definition(s) ************************/
+/* Single producer, single consumer ring. Only the producer (push, reserve, 
+ * commit, flushIn) writes the head and only the consumer (pop, peek, 
+ * advanceTail, flushOut) writes the tail, so one side may run in an interrupt.
+ * Reset writes both and must not run while the other side is active. */
 typedef struct circBuffer_t {
     uint8_t* data; /* Pointer to data*/
     const size_t capacity; /* Circular buffer capacity */
-    size_t tail; /* Read pointer */
-    size_t head; /* Write pointer */
+    volatile size_t tail; /* Read pointer, written only by the consumer */
+    volatile size_t head; /* Write pointer, written only by the producer */
+    volatile uint16_t numBytesDropped; /* Bytes lost to a full buffer, saturates. Written only by the producer */
+    volatile size_t highWaterMark; /* Most bytes ever held at once. Written only by the producer */
 } circBuffer_t;
 
+/* Contiguous block of circular buffer data. Data held across the end of the 
+ * buffer is described by two spans. */
+typedef struct circBufferSpan_t {
+    uint8_t* data; /* Pointer to the first byte of the block */
+    size_t length; /* Number of bytes in the block */
+} circBufferSpan_t;
+
+#define CB_NUM_SPANS 2u /* Maximum number of spans needed to describe a block of data */
+
 
 /**************  Function Definition(s) ********************/
 /* Pushes data to a circ buffer */
@@ -34,6 +60,9 @@ void cb_push(circBuffer_t* cb, /* Pointer to circular buffer struct */
 /* Pops data and returns from circ buffer */
 uint8_t cb_pop(circBuffer_t * const cb); /* Pointer to circular buffer struct */
 
+/* Checks capacity and sets a circular buffer empty, false if it cannot be used */
+bool cb_init(circBuffer_t * const cb); /* Pointer to circular buffer struct */
+
 /* Circular buffer reset */
 void cb_reset(circBuffer_t * const cb); /* Pointer to circular buffer struct */
 
@@ -48,6 +77,30 @@ size_t cb_bytesUsed(const circBuffer_t * const cb); /* Pointer to circular buffe
 void cb_advanceTail(circBuffer_t * const cb, /* Pointer to circular buffer struct */
         const size_t num);
 
+/* Locates stored data in place, without copying it or advancing the tail */
+size_t cb_peekSpans(const circBuffer_t * const cb, /* Pointer to circular buffer struct */
+        const size_t offset, /* Offset from the tail of the first byte */
+        const size_t numBytes, /* Number of bytes to locate */
+        circBufferSpan_t spans[CB_NUM_SPANS]); /* Returned spans, second is empty unless the data wraps */
+
+/* Reserves free space after the head to be written in place */
+size_t cb_reserve(const circBuffer_t * const cb, /* Pointer to circular buffer struct */
+        const size_t numBytes, /* Number of bytes to reserve */
+        circBufferSpan_t spans[CB_NUM_SPANS]); /* Returned writable spans, second is empty unless the space wraps */
+
+/* Commits bytes written to reserved space by advancing the head */
+void cb_commit(circBuffer_t * const cb, /* Pointer to circular buffer struct */
+        const size_t numBytes); /* Number of reserved bytes written */
+
+/* Returns the number of bytes dropped because the buffer was full */
+uint16_t cb_getNumBytesDropped(const circBuffer_t * const cb); /* Pointer to circular buffer struct */
+
+/* Returns the most bytes the buffer has held at once */
+size_t cb_getHighWaterMark(const circBuffer_t * const cb); /* Pointer to circular buffer struct */
+
+/* Clears the dropped byte count and high water mark */
+void cb_resetStatistics(circBuffer_t * const cb); /* Pointer to circular buffer struct */
+
 /* Flushes a source array into a circular buffer */
 size_t cb_flushIn(circBuffer_t * const cb, /* Pointer to circular buffer struct */
         uint8_t * const srcBuff, /* Buffer to read data from */